@@ -35,6 +35,7 @@ extern "C" {
 
 extern char *strerror(int errnum);
 extern char *strtok(char *str, const char *delim);
+extern char *strstr(const char *string, const char *substring);
 
 inline int memcmp(const void *s1, const void *s2, size_t n) {
 	unsigned char u1, u2;
@@ -136,6 +136,8 @@ private:
 	void HandleTrigger();
 	void ActiveUniversesAdd(uint16_t nUniverse);
 	void ActiveUniversesClear();
+	void CopyDmxData(const uint8_t *pDmxData, uint32_t nLength);
+	bool SendDmxInPlace(uint32_t nIp, const uint8_t *pDmxData, uint32_t nLength);
 
 private:
 	TArtNetController m_ArtNetController;
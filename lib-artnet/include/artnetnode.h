@@ -71,6 +71,7 @@
 #endif
 
 #include "lightset.h"
+#include "lightsetuniverseindex.h"
 #include "hardware.h"
 #include "network.h"
 
@@ -173,6 +174,10 @@ inline lightset::FailSafe convert_failsafe(const artnetnode::FailSafe failsafe)
 
 	return  static_cast<lightset::FailSafe>(static_cast<uint32_t>(failsafe) - static_cast<uint32_t>(artnetnode::FailSafe::LAST));
 }
+
+#if defined(ARTNET_HAVE_FAILSAFE_RECORD)
+void failsafe_run();
+#endif
 }  // namespace artnetnode
 
 #if (ARTNET_VERSION >= 4)
@@ -249,6 +254,9 @@ public:
 
 #if defined (DMXCONFIGUDP_H)
 		m_DmxConfigUdp.Run();
+#endif
+#if defined(ARTNET_HAVE_FAILSAFE_RECORD)
+		artnetnode::failsafe_run();
 #endif
 	}
 
@@ -364,15 +372,15 @@ public:
 	}
 
 	bool GetOutputPort(const uint16_t nUniverse, uint32_t& nPortIndex) {
-		for (nPortIndex = 0; nPortIndex < artnetnode::MAX_PORTS; nPortIndex++) {
-			if (m_Node.Port[nPortIndex].direction != lightset::PortDir::OUTPUT) {
-				continue;
-			}
-			if ((m_Node.Port[nPortIndex].protocol == artnet::PortProtocol::ARTNET) && (nUniverse == m_Node.Port[nPortIndex].PortAddress)) {
-				return true;
-			}
+		const auto nPortMask = m_OutputPortIndex.Get(nUniverse);
+
+		if (nPortMask == 0) {
+			nPortIndex = artnetnode::MAX_PORTS;
+			return false;
 		}
-		return false;
+
+		nPortIndex = static_cast<uint32_t>(__builtin_ctz(nPortMask));
+		return true;
 	}
 
 	void SetMergeMode(const uint32_t nPortIndex, const lightset::MergeMode mergeMode);
@@ -428,6 +436,14 @@ public:
 		return 0;
 	}
 
+	bool RdmCopyTodEntry(const uint32_t nPortIndex, const uint32_t nIndex, uint8_t uid[RDM_UID_SIZE]) {
+		if (m_pArtNetRdmController != nullptr) {
+			return m_pArtNetRdmController->CopyTodEntry(nPortIndex, nIndex, uid);
+		}
+
+		return false;
+	}
+
 	bool RdmIsRunning(const uint32_t nPortIndex, bool& bIsIncremental) {
 		uint32_t nRdmnPortIndex;
 		if (m_pArtNetRdmController->IsRunning(nRdmnPortIndex, bIsIncremental)) {
@@ -620,6 +636,7 @@ private:
 	void HandleRdmSub();
 	void HandleIpProg();
 	void HandleDmxIn();
+	void SendArtDmx(const uint32_t nPortIndex, const uint8_t *pData, const uint32_t nSlots);
 	void HandleInput();
 	void SetLocalMerging();
 	void HandleRdmIn();
@@ -631,6 +648,7 @@ private:
 
 	void UpdateMergeStatus(const uint32_t nPortIndex);
 	void CheckMergeTimeouts(const uint32_t nPortIndex);
+	void UpdateOutputPortIndex();
 
 	void ProcessPollRelply(const uint32_t nPortIndex, uint32_t& NumPortsInput, uint32_t& NumPortsOutput);
 	void SendPollRelply(const uint32_t nBindIndex, const uint32_t nDestinationIp, artnet::ArtPollQueue *pQueue = nullptr);
@@ -704,6 +722,7 @@ private:
 	artnetnode::State m_State;
 	artnetnode::OutputPort m_OutputPort[artnetnode::MAX_PORTS];
 	artnetnode::InputPort m_InputPort[artnetnode::MAX_PORTS];
+	lightset::UniverseIndex<artnetnode::MAX_PORTS> m_OutputPortIndex;	///< Port-Address -> Art-Net output ports
 
 	artnet::ArtPollReply m_ArtPollReply;
 #if defined (ARTNET_HAVE_DMXIN)
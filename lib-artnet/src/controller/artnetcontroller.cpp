@@ -275,20 +275,6 @@ void ArtNetController::HandleDmxOut(uint16_t nUniverse, const uint8_t *pDmxData,
 		m_pArtDmx->Sequence = 1;
 	}
 
-#if defined(CONFIG_ARTNET_CONTROLLER_ENABLE_MASTER)
-	if (__builtin_expect((m_nMaster == DMX_MAX_VALUE), 1)) {
-#endif
-		memcpy(m_pArtDmx->Data, pDmxData, nLength);
-#if defined(CONFIG_ARTNET_CONTROLLER_ENABLE_MASTER)
-	} else if (m_nMaster == 0) {
-		memset(m_pArtDmx->Data, 0, nLength);
-	} else {
-		for (uint32_t i = 0; i < nLength; i++) {
-			m_pArtDmx->Data[i] = ((m_nMaster * static_cast<uint32_t>(pDmxData[i])) / DMX_MAX_VALUE) & 0xFF;
-		}
-	}
-#endif
-
 	uint32_t nCount = 0;
 	auto IpAddresses = const_cast<struct artnet::PollTableUniverses *>(GetIpAddress(nUniverse));
 
@@ -304,8 +290,12 @@ void ArtNetController::HandleDmxOut(uint16_t nUniverse, const uint8_t *pDmxData,
 	// If the number of universe subscribers exceeds 40 for a given universe, the transmitting device may broadcast.
 
 	if (m_bUnicast && (nCount <= 40) && !m_bForceBroadcast) {
-		for (uint32_t nIndex = 0; nIndex < nCount; nIndex++) {
-			Network::Get()->SendTo(m_nHandle, m_pArtDmx, sizeof(struct ArtDmx), IpAddresses->pIpAddresses[nIndex], artnet::UDP_PORT);
+		if ((nCount != 1) || !SendDmxInPlace(IpAddresses->pIpAddresses[0], pDmxData, nLength)) {
+			CopyDmxData(pDmxData, nLength);
+
+			for (uint32_t nIndex = 0; nIndex < nCount; nIndex++) {
+				Network::Get()->SendTo(m_nHandle, m_pArtDmx, sizeof(struct ArtDmx), IpAddresses->pIpAddresses[nIndex], artnet::UDP_PORT);
+			}
 		}
 
 		m_bDmxHandled = true;
@@ -315,7 +305,10 @@ void ArtNetController::HandleDmxOut(uint16_t nUniverse, const uint8_t *pDmxData,
 	}
 
 	if (!m_bUnicast || (nCount > 40) || !m_bForceBroadcast) {
-		Network::Get()->SendTo(m_nHandle, m_pArtDmx, sizeof(struct ArtDmx), m_ArtNetController.nIPAddressBroadcast, artnet::UDP_PORT);
+		if (!SendDmxInPlace(m_ArtNetController.nIPAddressBroadcast, pDmxData, nLength)) {
+			CopyDmxData(pDmxData, nLength);
+			Network::Get()->SendTo(m_nHandle, m_pArtDmx, sizeof(struct ArtDmx), m_ArtNetController.nIPAddressBroadcast, artnet::UDP_PORT);
+		}
 
 		m_bDmxHandled = true;
 	}
@@ -323,6 +316,49 @@ void ArtNetController::HandleDmxOut(uint16_t nUniverse, const uint8_t *pDmxData,
 	DEBUG_EXIT
 }
 
+void ArtNetController::CopyDmxData(const uint8_t *pDmxData, uint32_t nLength) {
+#if defined(CONFIG_ARTNET_CONTROLLER_ENABLE_MASTER)
+	if (__builtin_expect((m_nMaster == DMX_MAX_VALUE), 1)) {
+#endif
+		memcpy(m_pArtDmx->Data, pDmxData, nLength);
+#if defined(CONFIG_ARTNET_CONTROLLER_ENABLE_MASTER)
+	} else if (m_nMaster == 0) {
+		memset(m_pArtDmx->Data, 0, nLength);
+	} else {
+		for (uint32_t i = 0; i < nLength; i++) {
+			m_pArtDmx->Data[i] = ((m_nMaster * static_cast<uint32_t>(pDmxData[i])) / DMX_MAX_VALUE) & 0xFF;
+		}
+	}
+#endif
+}
+
+/*
+ * With a single destination the DMX data goes straight into the TX buffer,
+ * only the ArtDmx header is taken from m_pArtDmx.
+ * Several destinations, and a master other than full, use the staged m_pArtDmx->Data.
+ */
+bool ArtNetController::SendDmxInPlace(uint32_t nIp, const uint8_t *pDmxData, uint32_t nLength) {
+	static constexpr uint32_t HEADER_SIZE = sizeof(struct ArtDmx) - artnet::DMX_LENGTH;
+
+#if defined(CONFIG_ARTNET_CONTROLLER_ENABLE_MASTER)
+	if (m_nMaster != DMX_MAX_VALUE) {
+		return false;
+	}
+#endif
+
+	auto *pBuffer = Network::Get()->SendToReserve(m_nHandle, nIp, artnet::UDP_PORT);
+
+	if (__builtin_expect((pBuffer == nullptr), 0)) {
+		return false;
+	}
+
+	Network::Get()->SendToCopy(pBuffer, m_pArtDmx, HEADER_SIZE);
+	Network::Get()->SendToCopy(&pBuffer[HEADER_SIZE], pDmxData, nLength);
+	Network::Get()->SendToCommit(HEADER_SIZE + nLength);
+
+	return true;
+}
+
 void ArtNetController::HandleSync() {
 	if (m_bSynchronization && m_bDmxHandled) {
 		m_bDmxHandled = false;
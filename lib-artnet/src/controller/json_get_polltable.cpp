@@ -39,52 +39,97 @@ static uint32_t get_port(const struct ::artnet::NodeEntryUniverse *pArtNetNodeEn
 			"{\"name\":\"%s\",\"universe\":%u},",
 			pArtNetNodeEntryUniverse->ShortName, pArtNetNodeEntryUniverse->nUniverse));
 
-	if (nLength <= nOutBufferSize) {
+	if (nLength < nOutBufferSize) {
 		return nLength;
 	}
 
 	return 0;
 }
 
+/**
+ * @return 0 when the entry does not fit
+ */
 static uint32_t get_entry(const uint32_t nIndex, char *pOutBuffer, const uint32_t nOutBufferSize) {
 	const auto *pPollTable = ArtNetController::Get()->GetPollTable();
 	auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nOutBufferSize,
 			"{\"name\":\"%s\",\"ip\":\"" IPSTR "\",\"mac\":\"" MACSTR "\",\"ports\":[",
 			pPollTable[nIndex].LongName, IP2STR(pPollTable[nIndex].IPAddress), MAC2STR(pPollTable[nIndex].Mac)));
 
+	if (nLength >= nOutBufferSize) {
+		return 0;
+	}
+
 	for (uint32_t nUniverse = 0; nUniverse < pPollTable[nIndex].nUniversesCount; nUniverse++) {
 		const auto *pArtNetNodeEntryUniverse = &pPollTable[nIndex].Universe[nUniverse];
-		nLength += get_port(pArtNetNodeEntryUniverse, &pOutBuffer[nLength], nLength);
+		const auto nSize = get_port(pArtNetNodeEntryUniverse, &pOutBuffer[nLength], nOutBufferSize - nLength);
+
+		if (nSize == 0) {
+			return 0;
+		}
+
+		nLength += nSize;
+	}
+
+	if (pPollTable[nIndex].nUniversesCount != 0) {
+		nLength--;
 	}
 
-	nLength--;
-	nLength += static_cast<uint32_t>(snprintf(&pOutBuffer[nLength], nOutBufferSize - nLength, "]},"));
+	nLength += static_cast<uint32_t>(snprintf(&pOutBuffer[nLength], nOutBufferSize - nLength, "]}"));
 
-	if (nLength <= nOutBufferSize) {
+	if (nLength < nOutBufferSize) {
 		return nLength;
 	}
 
 	return 0;
 }
 
-uint32_t json_get_polltable(char *pOutBuffer, const uint32_t nOutBufferSize) {
-	const auto nBufferSize = nOutBufferSize - 2U;
-	pOutBuffer[0] = '[';
+/**
+ * The poll table is generated in parts, each part ends with a complete entry.
+ * nCursor is 0 for the first part, it is 0 again after the last part.
+ * Bit 31 of nCursor is set once an entry has been written, an entry which does
+ * not fit in an empty part is skipped and must not be followed by a separator.
+ */
+uint32_t json_get_polltable(uint32_t& nCursor, char *pOutBuffer, const uint32_t nOutBufferSize) {
+	static constexpr uint32_t IS_WRITTEN = (1U << 31);
+	assert(nOutBufferSize > 2);
+	const auto nBufferSize = nOutBufferSize - 1U;	// ']'
+	const auto nEntries = ArtNetController::Get()->GetPollTableEntries();
+	uint32_t nLength = 0;
+
+	if (nCursor == 0) {
+		pOutBuffer[nLength++] = '[';
+		nCursor = 1;
+	}
 
-	auto nLength = 1U;
+	while ((nCursor & ~IS_WRITTEN) <= nEntries) {
+		const auto nSeparator = (nCursor & IS_WRITTEN) ? 1U : 0U;
 
-	for (uint32_t nIndex = 0; (nIndex < ArtNetController::Get()->GetPollTableEntries()) && (nLength < nOutBufferSize); nIndex++) {
-		const auto nSize = nBufferSize - nLength;
-		nLength += get_entry(nIndex, &pOutBuffer[nLength], nSize);
-	}
+		if ((nLength + nSeparator) >= nBufferSize) {
+			return nLength;
+		}
 
-	if (nLength != 1) {
-		pOutBuffer[nLength - 1] = ']';
-	} else {
-		pOutBuffer[1] = ']';
-		nLength = 2;
+		const auto nSize = get_entry((nCursor & ~IS_WRITTEN) - 1, &pOutBuffer[nLength + nSeparator], nBufferSize - nLength - nSeparator);
+
+		if (nSize == 0) {
+			if (nLength != 0) {
+				return nLength;
+			}
+			/* The entry does not fit in an empty part */
+			nCursor++;
+			continue;
+		}
+
+		if (nSeparator != 0) {
+			pOutBuffer[nLength] = ',';
+		}
+
+		nLength += nSeparator + nSize;
+		nCursor = (nCursor + 1) | IS_WRITTEN;
 	}
 
+	pOutBuffer[nLength++] = ']';
+	nCursor = 0;
+
 	assert(nLength <= nOutBufferSize);
 	return nLength;
 }
@@ -58,6 +58,8 @@ void ArtNetNode::SetPortProtocol4(const uint32_t nPortIndex, const artnet::PortP
 		m_OutputPort[nPortIndex].GoodOutput &= static_cast<uint8_t>(~artnet::GoodOutput::OUTPUT_IS_SACN);
 	}
 
+	UpdateOutputPortIndex();
+
 	if (m_State.status == artnet::Status::ON) {
 		ArtNetStore::SavePortProtocol(nPortIndex, portProtocol);
 		artnet::display_port_protocol(nPortIndex, portProtocol);
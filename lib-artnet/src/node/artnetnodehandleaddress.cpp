@@ -155,6 +155,8 @@ void ArtNetNode::SetUniverseSwitch(const uint32_t nPortIndex, const lightset::Po
 		m_Node.Port[nPortIndex].direction = lightset::PortDir::OUTPUT;
 	}
 
+	UpdateOutputPortIndex();
+
 #if (ARTNET_VERSION >= 4)
 	SetUniverse4(nPortIndex, dir);
 #endif
@@ -178,6 +180,8 @@ void ArtNetNode::SetSubnetSwitch(const uint32_t nPortIndex, const uint8_t nSubne
 	m_Node.Port[nPortIndex].SubSwitch = nSubnetSwitch;
 	m_Node.Port[nPortIndex].PortAddress = MakePortAddress(m_Node.Port[nPortIndex].PortAddress, nPortIndex);
 
+	UpdateOutputPortIndex();
+
 	if (m_State.status == artnet::Status::ON) {
 		ArtNetStore::SaveSubnetSwitch(nPortIndex, nSubnetSwitch);
 	}
@@ -192,6 +196,8 @@ void ArtNetNode::SetNetSwitch(const uint32_t nPortIndex, const uint8_t nNetSwitc
 	m_Node.Port[nPortIndex].NetSwitch = nNetSwitch;
 	m_Node.Port[nPortIndex].PortAddress = MakePortAddress(m_Node.Port[nPortIndex].PortAddress, nPortIndex);
 
+	UpdateOutputPortIndex();
+
 	if (m_State.status == artnet::Status::ON) {
 		ArtNetStore::SaveNetSwitch(nPortIndex, nNetSwitch);
 	}
@@ -199,6 +205,16 @@ void ArtNetNode::SetNetSwitch(const uint32_t nPortIndex, const uint8_t nNetSwitc
 	DEBUG_EXIT
 }
 
+void ArtNetNode::UpdateOutputPortIndex() {
+	m_OutputPortIndex.Clear();
+
+	for (uint32_t nPortIndex = 0; nPortIndex < artnetnode::MAX_PORTS; nPortIndex++) {
+		if ((m_Node.Port[nPortIndex].direction == lightset::PortDir::OUTPUT) && (m_Node.Port[nPortIndex].protocol == artnet::PortProtocol::ARTNET)) {
+			m_OutputPortIndex.Add(m_Node.Port[nPortIndex].PortAddress, nPortIndex);
+		}
+	}
+}
+
 void ArtNetNode::SetMergeMode(const uint32_t nPortIndex, const lightset::MergeMode mergeMode) {
 	assert(nPortIndex < artnetnode::MAX_PORTS);
 
@@ -96,6 +96,8 @@ void ArtNetNode::SendPollRelply(const uint32_t nBindIndex, const uint32_t nDesti
 	memcpy(m_ArtPollReply.BindIp, ip.u8, sizeof(m_ArtPollReply.BindIp));
 #endif
 
+	Network::Get()->TxBatchBegin();
+
 	for (uint32_t nPortIndex = 0; nPortIndex < artnetnode::MAX_PORTS; nPortIndex++) {
 		if ((nBindIndex != 0) && (nBindIndex != (nPortIndex + 1))) {
 			continue;
@@ -147,6 +149,8 @@ void ArtNetNode::SendPollRelply(const uint32_t nBindIndex, const uint32_t nDesti
 		Network::Get()->SendTo(m_nHandle, &m_ArtPollReply, sizeof(artnet::ArtPollReply), nDestinationIp, artnet::UDP_PORT);
 	}
 
+	Network::Get()->TxBatchEnd();
+
 	m_State.IsChanged = false;
 }
 
@@ -50,6 +50,45 @@
 
 static uint32_t s_ReceivingMask = 0;
 
+/*
+ * Without local merge the DMX data goes straight into the TX buffer,
+ * only the ArtDmx header is built in m_ArtDmx.
+ */
+void ArtNetNode::SendArtDmx(const uint32_t nPortIndex, const uint8_t *pData, const uint32_t nSlots) {
+	static constexpr uint32_t HEADER_SIZE = sizeof(struct artnet::ArtDmx) - artnet::DMX_LENGTH;
+	const auto nLength = (nSlots + 1U) & ~1U;	// Even number of slots
+
+	m_ArtDmx.Sequence = static_cast<uint8_t>(1U + m_InputPort[nPortIndex].nSequenceNumber++);
+	m_ArtDmx.Physical = static_cast<uint8_t>(nPortIndex);
+	m_ArtDmx.PortAddress = m_Node.Port[nPortIndex].PortAddress;
+	m_ArtDmx.LengthHi = static_cast<uint8_t>((nLength & 0xFF00) >> 8);
+	m_ArtDmx.Length = static_cast<uint8_t>(nLength & 0xFF);
+
+	if (!m_Node.Port[nPortIndex].bLocalMerge) {
+		auto *pBuffer = Network::Get()->SendToReserve(m_nHandle, m_InputPort[nPortIndex].nDestinationIp, artnet::UDP_PORT);
+
+		if (__builtin_expect((pBuffer != nullptr), 1)) {
+			Network::Get()->SendToCopy(pBuffer, &m_ArtDmx, HEADER_SIZE);
+			Network::Get()->SendToCopy(&pBuffer[HEADER_SIZE], pData, nSlots);
+
+			if (nLength != nSlots) {
+				pBuffer[HEADER_SIZE + nSlots] = 0x00;
+			}
+
+			Network::Get()->SendToCommit(HEADER_SIZE + nLength);
+			return;
+		}
+	}
+
+	memcpy(m_ArtDmx.Data, pData, nSlots);
+
+	if (nLength != nSlots) {
+		m_ArtDmx.Data[nSlots] = 0x00;
+	}
+
+	Network::Get()->SendTo(m_nHandle, &m_ArtDmx, HEADER_SIZE + nLength, m_InputPort[nPortIndex].nDestinationIp, artnet::UDP_PORT);
+}
+
 void ArtNetNode::HandleDmxIn() {
 	for (uint32_t nPortIndex = 0; nPortIndex < artnetnode::MAX_PORTS; nPortIndex++) {
 		if  ((m_Node.Port[nPortIndex].direction == lightset::PortDir::INPUT)
@@ -59,25 +98,9 @@ void ArtNetNode::HandleDmxIn() {
 			const auto *const pDmxData = reinterpret_cast<const struct Data *>(Dmx::Get()->GetDmxChanged(nPortIndex));
 
 			if (pDmxData != nullptr) {
-				m_ArtDmx.Sequence = static_cast<uint8_t>(1U + m_InputPort[nPortIndex].nSequenceNumber++);
-				m_ArtDmx.Physical = static_cast<uint8_t>(nPortIndex);
-				m_ArtDmx.PortAddress = m_Node.Port[nPortIndex].PortAddress;
-
-				auto nLength = pDmxData->Statistics.nSlotsInPacket;
-
-				memcpy(m_ArtDmx.Data, &pDmxData->Data[1], nLength);
-
-				if ((nLength & 0x1) == 0x1) {
-					m_ArtDmx.Data[nLength] = 0x00;
-					nLength++;
-				}
-
-				m_ArtDmx.LengthHi = static_cast<uint8_t>((nLength & 0xFF00) >> 8);
-				m_ArtDmx.Length = static_cast<uint8_t>(nLength & 0xFF);
-
 				m_InputPort[nPortIndex].GoodInput = artnet::GoodInput::DATA_RECIEVED;
 
-				Network::Get()->SendTo(m_nHandle, &m_ArtDmx, sizeof(struct artnet::ArtDmx), m_InputPort[nPortIndex].nDestinationIp, artnet::UDP_PORT);
+				SendArtDmx(nPortIndex, &pDmxData->Data[1], pDmxData->Statistics.nSlotsInPacket);
 
 				SendDiag(artnet::PriorityCodes::DIAG_LOW, "%u: Input DMX sent", nPortIndex);
 
@@ -127,23 +150,7 @@ void ArtNetNode::HandleDmxIn() {
 				if (sendArtDmx) {
 					const auto *const pDmxData = reinterpret_cast<const struct Data *>(Dmx::Get()->GetDmxCurrentData(nPortIndex));
 
-					m_ArtDmx.Sequence = static_cast<uint8_t>(1U + m_InputPort[nPortIndex].nSequenceNumber++);
-					m_ArtDmx.Physical = static_cast<uint8_t>(nPortIndex);
-					m_ArtDmx.PortAddress = m_Node.Port[nPortIndex].PortAddress;
-
-					auto nLength = pDmxData->Statistics.nSlotsInPacket;
-
-					memcpy(m_ArtDmx.Data, &pDmxData->Data[1], nLength);
-
-					if ((nLength & 0x1) == 0x1) {
-						m_ArtDmx.Data[nLength] = 0x00;
-						nLength++;
-					}
-
-					m_ArtDmx.LengthHi = static_cast<uint8_t>((nLength & 0xFF00) >> 8);
-					m_ArtDmx.Length = static_cast<uint8_t>(nLength & 0xFF);
-
-					Network::Get()->SendTo(m_nHandle, &m_ArtDmx, sizeof(struct artnet::ArtDmx), m_InputPort[nPortIndex].nDestinationIp, artnet::UDP_PORT);
+					SendArtDmx(nPortIndex, &pDmxData->Data[1], pDmxData->Statistics.nSlotsInPacket);
 
 					SendDiag(artnet::PriorityCodes::DIAG_LOW, "%u: Input DMX sent (timeout)", nPortIndex);
 
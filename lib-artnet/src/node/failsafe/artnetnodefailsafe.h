@@ -39,6 +39,7 @@ static constexpr auto BYTES_NEEDED = artnetnode::MAX_PORTS * lightset::dmx::UNIV
 void failsafe_write_start();
 void failsafe_write(uint32_t nPortIndex, const uint8_t *pData);
 void failsafe_write_end();
+void failsafe_run();
 
 void failsafe_read_start();
 void failsafe_read(uint32_t nPortIndex, uint8_t *pData);
@@ -124,6 +124,11 @@ void failsafe_write_end() {
 }
 
 
+void failsafe_run() {
+	// No code needed here
+}
+
+
 void failsafe_read_start() {
 	DEBUG_ENTRY
 	DEBUG_PRINTF("isDetected=%d", isDetected);
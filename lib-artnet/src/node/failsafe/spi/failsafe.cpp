@@ -24,19 +24,39 @@
  */
 
 #include <cstdint>
+#include <cstring>
 #include <cassert>
 
 #include "artnetnode.h"
 #include "artnetnodefailsafe.h"
 
 #include "../lib-flash/include/spi/spi_flash.h"
+#include "../lib-flash/include/spi/spi_flash_layout.h"
 
 #include "debug.h"
 
 namespace artnetnode {
+/*
+ * The record is in the top sectors of the failsafe area, below the configuration sector.
+ */
+static constexpr auto FAILSAFE_PAGES = 1 + failsafe::BYTES_NEEDED / spi_flash::layout::SECTOR_SIZE;
+static_assert(FAILSAFE_PAGES <= spi_flash::layout::FAILSAFE_SECTORS, "The failsafe record does not fit in the flash layout");
+
+/*
+ * The record is copied, the erase and program run in the background with failsafe_run().
+ */
+namespace failsafe {
+enum class State {
+	IDLE, ERASE, WRITE
+};
+}  // namespace failsafe
 
 static bool s_hasFlash;
 static uint32_t nOffsetBase;
+static uint8_t s_Record[failsafe::BYTES_NEEDED];
+static bool s_isRecordPending;
+static failsafe::State s_State;
+static spi_flash_async_user s_User;
 
 static bool check_have_flash() {
 	DEBUG_ENTRY
@@ -49,14 +69,15 @@ static bool check_have_flash() {
 		}
 
 		const auto nEraseSize = spi_flash_get_sector_size();
-		assert(nEraseSize <= failsafe::BYTES_NEEDED);
-		const auto nPages = 1 + failsafe::BYTES_NEEDED / nEraseSize;
 
-		DEBUG_PRINTF("KB_NEEDED=%u, nEraseSize=%u, nPages=%u", failsafe::BYTES_NEEDED, nEraseSize, nPages);
+		DEBUG_PRINTF("KB_NEEDED=%u, nEraseSize=%u, FAILSAFE_PAGES=%u", failsafe::BYTES_NEEDED, nEraseSize, FAILSAFE_PAGES);
 
-		assert(((nPages + 1) * nEraseSize) <= spi_flash_get_size());
+		if ((nEraseSize != spi_flash::layout::SECTOR_SIZE) || (spi_flash::layout::SECTORS * spi_flash::layout::SECTOR_SIZE > spi_flash_get_size())) {
+			DEBUG_EXIT
+			return false;
+		}
 
-		nOffsetBase = spi_flash_get_size() - ((nPages + 1) * nEraseSize);
+		nOffsetBase = spi_flash::layout::get_address(spi_flash_get_size(), FAILSAFE_PAGES);
 
 		DEBUG_PRINTF("nOffsetBase=%p", nOffsetBase);
 	}
@@ -74,11 +95,10 @@ void failsafe_write_start() {
 		return;
 	}
 
-	const auto nReturn = spi_flash_cmd_erase(nOffsetBase, spi_flash_get_sector_size());
+	s_hasFlash = true;
 
-	s_hasFlash = !(nReturn < 0) ;
+	memset(s_Record, 0xFF, sizeof(s_Record));	// Same as erased flash
 
-	DEBUG_PRINTF("nReturn=%d, s_hasFlash=%d", nReturn, s_hasFlash);
 	DEBUG_EXIT
 }
 
@@ -92,11 +112,7 @@ void failsafe_write(uint32_t nPortIndex, const uint8_t *pData) {
 		return;
 	}
 
-	const auto nOffset = nOffsetBase + (nPortIndex * lightset::dmx::UNIVERSE_SIZE);
-
-	DEBUG_PRINTF("nOffsetBase=%p, nOffset=%p", nOffsetBase, nOffset);
-
-	spi_flash_cmd_write_multi(nOffset, lightset::dmx::UNIVERSE_SIZE, pData);
+	memcpy(&s_Record[nPortIndex * lightset::dmx::UNIVERSE_SIZE], pData, lightset::dmx::UNIVERSE_SIZE);
 
 	DEBUG_EXIT
 }
@@ -104,11 +120,58 @@ void failsafe_write(uint32_t nPortIndex, const uint8_t *pData) {
 void failsafe_write_end() {
 	DEBUG_ENTRY
 
-	// No code needed here
+	/*
+	 * A record made while the previous one is still written, is written again after it.
+	 */
+	s_isRecordPending = s_hasFlash;
 
 	DEBUG_EXIT
 }
 
+/**
+ * Each call is a single step of the SPI flash state machine.
+ */
+void failsafe_run() {
+	switch (s_State) {
+	case failsafe::State::IDLE:
+		if (__builtin_expect((!s_isRecordPending), 1)) {
+			return;
+		}
+
+		s_isRecordPending = false;
+		s_State = failsafe::State::ERASE;
+		break;
+	case failsafe::State::ERASE: {
+		const auto nReturn = spi_flash_async_erase_step(s_User, nOffsetBase, FAILSAFE_PAGES * spi_flash::layout::SECTOR_SIZE);
+
+		if (nReturn > 0) {
+			return;
+		}
+
+		DEBUG_PRINTF("erase nReturn=%d", nReturn);
+
+		s_State = (nReturn < 0) ? failsafe::State::IDLE : failsafe::State::WRITE;
+	}
+		break;
+	case failsafe::State::WRITE: {
+		const auto nReturn = spi_flash_async_write_step(s_User, nOffsetBase, sizeof(s_Record), s_Record);
+
+		if (nReturn > 0) {
+			return;
+		}
+
+		DEBUG_PRINTF("write nReturn=%d", nReturn);
+
+		s_State = failsafe::State::IDLE;
+	}
+		break;
+	default:
+		assert(0);
+		__builtin_unreachable();
+		break;
+	}
+}
+
 
 void failsafe_read_start() {
 	DEBUG_ENTRY
@@ -121,6 +184,17 @@ void failsafe_read_start() {
 
 	s_hasFlash = true;
 
+	/*
+	 * The flash cannot be read while it is erased or programmed.
+	 */
+	while (s_isRecordPending || (s_State != failsafe::State::IDLE)) {
+		failsafe_run();
+	}
+
+	while (spi_flash_async_is_busy()) {
+		spi_flash_async_run();
+	}
+
 	DEBUG_EXIT
 }
 
@@ -31,23 +31,53 @@
 
 namespace remoteconfig {
 namespace rdm {
-uint32_t json_get_tod(const char cPort, char *pOutBuffer, const uint32_t nOutBufferSize) {
+/**
+ * The TOD is generated in parts, nCursor is 0 for the first part, it is 0 again after the last part.
+ */
+uint32_t json_get_tod(const char cPort, uint32_t& nCursor, char *pOutBuffer, const uint32_t nOutBufferSize) {
+	static constexpr uint32_t UID_LENGTH = 16;	// ,"xxxx:xxxxxxxx"
 	const uint32_t nPortIndex = (cPort | 0x20) - 'a';
 
-	if (nPortIndex < artnetnode::MAX_PORTS) {
-		const auto nBufferSize = nOutBufferSize - 2U;
-		auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nBufferSize, "{\"port\":\"%c\",\"tod\":[" , static_cast<char>(nPortIndex + 'A')));
+	if (nPortIndex >= artnetnode::MAX_PORTS) {
+		nCursor = 0;
+		return 0;
+	}
 
-		nLength += ArtNetNode::Get()->RdmCopyTod(nPortIndex, &pOutBuffer[nLength], nBufferSize - nLength);
+	assert(nOutBufferSize > (32 + UID_LENGTH));
+	const auto nBufferSize = nOutBufferSize - 2U;	// ']}'
+	uint32_t nLength = 0;
+
+	if (nCursor == 0) {
+		nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nBufferSize, "{\"port\":\"%c\",\"tod\":[" , static_cast<char>(nPortIndex + 'A')));
+		nCursor = 1;
+	}
 
-		pOutBuffer[nLength++] = ']';
-		pOutBuffer[nLength++] = '}';
+	const auto nUidCount = ArtNetNode::Get()->RdmGetUidCount(nPortIndex);
 
-		assert(nLength <= nOutBufferSize);
-		return nLength;
+	while (nCursor <= nUidCount) {
+		if ((nLength + UID_LENGTH) >= nBufferSize) {
+			return nLength;
+		}
+
+		uint8_t uid[RDM_UID_SIZE];
+		ArtNetNode::Get()->RdmCopyTodEntry(nPortIndex, nCursor - 1, uid);
+
+		if (nCursor != 1) {
+			pOutBuffer[nLength++] = ',';
+		}
+
+		nLength += static_cast<uint32_t>(snprintf(&pOutBuffer[nLength], nBufferSize - nLength,
+				"\"%.2x%.2x:%.2x%.2x%.2x%.2x\"",
+				uid[0], uid[1], uid[2], uid[3], uid[4], uid[5]));
+		nCursor++;
 	}
 
-	return 0;
+	pOutBuffer[nLength++] = ']';
+	pOutBuffer[nLength++] = '}';
+	nCursor = 0;
+
+	assert(nLength <= nOutBufferSize);
+	return nLength;
 }
 }  // namespace rdm
 }  // namespace remoteconfig
@@ -73,24 +73,29 @@ bool StoreDevice::Read(uint32_t nOffset, uint32_t nLength, uint8_t *pBuffer, sto
 	return true;
 }
 
-bool StoreDevice::Erase(uint32_t nOffset, uint32_t nLength, storedevice::result& nResult) {
-	DEBUG_ENTRY
+/*
+ * Erase and Write return false while the operation is in progress.
+ * Each call is a single step of the SPI flash state machine, which is shared
+ * with the firmware installer and the failsafe record.
+ */
+static spi_flash_async_user s_User;
+
+static bool get_result(const int nReturn, storedevice::result& nResult) {
+	if (nReturn > 0) {
+		nResult = storedevice::result::OK;
+		return false;
+	}
 
-	const auto nReturn = spi_flash_cmd_erase(nOffset, nLength);
 	nResult = (nReturn < 0) ? storedevice::result::ERROR : storedevice::result::OK;
 
 	DEBUG_PRINTF("nResult=%d", static_cast<int>(nResult));
-	DEBUG_EXIT
 	return true;
 }
 
-bool StoreDevice::Write(uint32_t nOffset, uint32_t nLength, const uint8_t *pBuffer, storedevice::result& nResult) {
-	DEBUG_ENTRY
-
-	const auto nReturn = spi_flash_cmd_write_multi(nOffset, nLength, pBuffer);
-	nResult = (nReturn < 0) ? storedevice::result::ERROR : storedevice::result::OK;
+bool StoreDevice::Erase(uint32_t nOffset, uint32_t nLength, storedevice::result& nResult) {
+	return get_result(spi_flash_async_erase_step(s_User, nOffset, nLength), nResult);
+}
 
-	DEBUG_PRINTF("nResult=%d", static_cast<int>(nResult));
-	DEBUG_EXIT
-	return true;
+bool StoreDevice::Write(uint32_t nOffset, uint32_t nLength, const uint8_t *pBuffer, storedevice::result& nResult) {
+	return get_result(spi_flash_async_write_step(s_User, nOffset, nLength, pBuffer), nResult);
 }
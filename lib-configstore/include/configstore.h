@@ -69,7 +69,7 @@ enum class Store {
 };
 
 enum class State {
-	IDLE, CHANGED, CHANGED_WAITING, ERASING, ERASED, ERASED_WAITING, WRITING
+	IDLE, CHANGED, CHANGED_WAITING, ERASING, ERASED, ERASED_WAITING, WRITING, WRITING_HEADER, JOURNAL_ERASING, JOURNAL_WRITING
 };
 }  // namespace configstore
 
@@ -115,7 +115,7 @@ public:
 
 			if (p->nUtcOffset != nUtcOffset) {
 				p->nUtcOffset = nUtcOffset;
-				s_State = configstore::State::CHANGED;
+				SetChanged(FlashStore::SIGNATURE_SIZE, sizeof(p->nUtcOffset));
 			}
 
 			DEBUG_EXIT
@@ -155,6 +155,22 @@ public:
 private:
 	uint32_t GetStoreOffset(configstore::Store tStore);
 
+	/*
+	 * Journal
+	 */
+
+	bool JournalInit();
+	configstore::State JournalNext();
+	bool JournalBuildRecord();
+	void JournalSetHeader();
+	void JournalSetBaseHeader();
+	uint32_t JournalReplay(const uint32_t nAddress);
+	bool IsBaseValid(const uint32_t nBase, uint32_t& nGeneration);
+	uint32_t GetFlashCrc(const uint32_t nAddress, const uint32_t nLength);
+
+	uint32_t GetBaseAddress(const uint32_t nBase) const;
+	uint32_t GetJournalAddress(const uint32_t nSlot) const;
+
 private:
 	struct Env {
 		int32_t nUtcOffset;
@@ -162,6 +178,7 @@ private:
 	};
 
 	struct FlashStore {
+		static constexpr uint8_t SIGNATURE[] = {'A', 'v', 'V', 0x01};
 		static constexpr uint32_t SIGNATURE_SIZE = 16;
 		static constexpr uint32_t ENV_SIZE = 16;
 		static constexpr uint32_t OFFSET_STORES = SIGNATURE_SIZE + ENV_SIZE;
@@ -170,6 +187,37 @@ private:
 
 	static_assert(sizeof(struct Env) == FlashStore::ENV_SIZE, "");
 
+	/*
+	 * With a journal, the changed bytes are appended as records.
+	 * The image is only rewritten when all journal sectors are full.
+	 */
+	struct Journal {
+		static constexpr uint32_t CHUNK_SIZE = 16;	///< Granularity of the changed bytes tracking
+		static constexpr uint32_t CHUNKS = FlashStore::SIZE / CHUNK_SIZE;
+		static constexpr uint32_t HEADER_SIZE = 16;
+		static constexpr uint32_t RECORD_HEADER_SIZE = 8;
+		static constexpr uint32_t RECORD_DATA_MAX = 128;
+	};
+
+	static void SetChanged(const uint32_t nOffset, const uint32_t nLength) {
+		assert((nOffset + nLength) <= FlashStore::SIZE);
+		assert(nLength != 0);
+
+		const auto nLast = (nOffset + nLength - 1) / Journal::CHUNK_SIZE;
+
+		for (auto nChunk = nOffset / Journal::CHUNK_SIZE; nChunk <= nLast; nChunk++) {
+			s_Changed[nChunk / 32] |= (1U << (nChunk & 31));
+		}
+
+		/*
+		 * With a journal, an erase or write in progress is finished first,
+		 * the changed chunks are then picked up by JournalNext.
+		 */
+		if (!s_IsJournal || (s_State == configstore::State::IDLE) || (s_State == configstore::State::CHANGED_WAITING)) {
+			s_State = configstore::State::CHANGED;
+		}
+	}
+
 	static bool s_bHaveFlashChip;
 
 	static configstore::State s_State;
@@ -180,6 +228,18 @@ private:
 
 	static uint32_t s_nWaitMillis;
 
+	static bool s_IsJournal;
+	static bool s_IsCompactNeeded;
+	static uint32_t s_Changed[Journal::CHUNKS / 32];
+	static uint32_t s_nBase;				///< The base image in use, 0 or 1
+	static uint32_t s_nGeneration;			///< Generation of the base image in use
+	static uint32_t s_nJournalSlot;			///< The journal sector being appended
+	static uint32_t s_nJournalUsed;			///< Journal sectors used for this generation
+	static uint32_t s_nJournalSequence;
+	static uint32_t s_nJournalOffset;		///< Append offset in the journal sector
+	static uint32_t s_nRecordLength;		///< The record is in s_JournalBuffer after the sector header
+	static uint8_t s_JournalBuffer[Journal::HEADER_SIZE + Journal::RECORD_HEADER_SIZE + Journal::RECORD_DATA_MAX] __attribute__((aligned(4)));
+
 	static ConfigStore *s_pThis;
 };
 
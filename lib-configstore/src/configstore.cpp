@@ -34,6 +34,8 @@
 
 #include "platform_configstore.h"
 
+#include "../lib-flash/include/spi/spi_flash_layout.h"
+
 #include "debug.h"
 
 namespace global {
@@ -42,7 +44,6 @@ extern int32_t *gp_nUtcOffset;
 
 using namespace configstore;
 
-static constexpr uint8_t s_aSignature[] = {'A', 'v', 'V', 0x01};
 static constexpr uint32_t s_aStorSize[static_cast<uint32_t>(Store::LAST)]  = {96,        32,    64,      64,    32,     32,        480,          64,         32,        96,           48,        32,      944,          48,        64,            32,        96,         32,      1024,     32,     32,       64,            96,               32,    32,          320,    32};
 #ifndef NDEBUG
 static constexpr char s_aStoreName[static_cast<uint32_t>(Store::LAST)][16] = {"Network", "DMX", "Pixel", "LTC", "MIDI", "LTC ETC", "OSC Server", "TLC59711", "USB Pro", "RDM Device", "RConfig", "TCNet", "OSC Client", "Display", "LTC Display", "Monitor", "SparkFun", "Slush", "Motors", "Show", "Serial", "RDM Sensors", "RDM SubDevices", "GPS", "RGB Panel", "Node", "PCA9685"};
@@ -55,12 +56,24 @@ uint32_t ConfigStore::s_nSpiFlashStoreSize;
 uint32_t ConfigStore::s_nWaitMillis;
 uint8_t ConfigStore::s_SpiFlashData[FlashStore::SIZE] SECTION_CONFIGSTORE;
 
+bool ConfigStore::s_IsJournal;
+bool ConfigStore::s_IsCompactNeeded;
+uint32_t ConfigStore::s_Changed[Journal::CHUNKS / 32];
+uint32_t ConfigStore::s_nBase;
+uint32_t ConfigStore::s_nGeneration;
+uint32_t ConfigStore::s_nJournalSlot;
+uint32_t ConfigStore::s_nJournalUsed;
+uint32_t ConfigStore::s_nJournalSequence;
+uint32_t ConfigStore::s_nJournalOffset;
+uint32_t ConfigStore::s_nRecordLength;
+uint8_t ConfigStore::s_JournalBuffer[Journal::HEADER_SIZE + Journal::RECORD_HEADER_SIZE + Journal::RECORD_DATA_MAX] __attribute__((aligned(4)));
+
 ConfigStore *ConfigStore::s_pThis;
 
 ConfigStore::ConfigStore() {
 	DEBUG_ENTRY
 
-	static_assert(sizeof(s_aSignature) <= FlashStore::SIGNATURE_SIZE);
+	static_assert(sizeof(FlashStore::SIGNATURE) <= FlashStore::SIGNATURE_SIZE);
 
 	assert(s_pThis == nullptr);
 	s_pThis = this;
@@ -84,7 +97,31 @@ ConfigStore::ConfigStore() {
 
 	DEBUG_PRINTF("s_nStartAddress=%p", reinterpret_cast<void *>(s_nStartAddress));
 
-	if (s_bHaveFlashChip) {
+	s_nSpiFlashStoreSize = FlashStore::OFFSET_STORES;
+
+	for (uint32_t j = 0; j < static_cast<uint32_t>(Store::LAST); j++) {
+		s_nSpiFlashStoreSize += s_aStorSize[j];
+	}
+
+	DEBUG_PRINTF("FlashStore::OFFSET_STORES=%d, m_nSpiFlashStoreSize=%d", static_cast<int>(FlashStore::OFFSET_STORES), s_nSpiFlashStoreSize);
+
+	assert(s_nSpiFlashStoreSize <= FlashStore::SIZE);
+
+#if (CONFIG_STORE_JOURNAL_SECTORS > 0)
+	/*
+	 * The two base images and the journal sectors are at the end of the flash, see spi_flash_layout.h
+	 */
+	static_assert(FlashStore::SIZE == spi_flash::layout::SECTOR_SIZE, "");
+	s_IsJournal = s_bHaveFlashChip && ((FlashStore::SIZE % nEraseSize) == 0) && (((spi_flash::layout::CONFIG_STORE_JOURNAL_FIRST + CONFIG_STORE_JOURNAL_SECTORS) * FlashStore::SIZE) <= StoreDevice::GetSize());
+
+	DEBUG_PRINTF("s_IsJournal=%d", s_IsJournal);
+#endif
+
+	if (s_IsJournal) {
+#if (CONFIG_STORE_JOURNAL_SECTORS > 0)
+		JournalInit();
+#endif
+	} else if (s_bHaveFlashChip) {
 		storedevice::result result;
 		StoreDevice::Read(s_nStartAddress, FlashStore::SIZE, reinterpret_cast<uint8_t *>(&s_SpiFlashData), result);
 		assert(result == storedevice::result::OK);
@@ -92,9 +129,9 @@ ConfigStore::ConfigStore() {
 
 	bool bSignatureOK = true;
 
-	for (uint32_t i = 0; i < sizeof(s_aSignature); i++) {
-		if (s_aSignature[i] != s_SpiFlashData[i]) {
-			s_SpiFlashData[i] = s_aSignature[i];
+	for (uint32_t i = 0; i < sizeof(FlashStore::SIGNATURE); i++) {
+		if (FlashStore::SIGNATURE[i] != s_SpiFlashData[i]) {
+			s_SpiFlashData[i] = FlashStore::SIGNATURE[i];
 			bSignatureOK = false;
 		}
 	}
@@ -102,19 +139,10 @@ ConfigStore::ConfigStore() {
 	if (!bSignatureOK) {
 		DEBUG_PUTS("No signature");
 		memset(&s_SpiFlashData[FlashStore::SIGNATURE_SIZE], 0, FlashStore::SIZE - FlashStore::SIGNATURE_SIZE);
+		s_IsCompactNeeded = true;
 		s_State = State::CHANGED;
 	}
 
-	s_nSpiFlashStoreSize = FlashStore::OFFSET_STORES;
-
-	for (uint32_t j = 0; j < static_cast<uint32_t>(Store::LAST); j++) {
-		s_nSpiFlashStoreSize += s_aStorSize[j];
-	}
-
-	DEBUG_PRINTF("FlashStore::OFFSET_STORES=%d, m_nSpiFlashStoreSize=%d", static_cast<int>(FlashStore::OFFSET_STORES), s_nSpiFlashStoreSize);
-
-	assert(s_nSpiFlashStoreSize <= FlashStore::SIZE);
-
 	for (uint32_t nStore = 0; nStore < static_cast<uint32_t>(Store::LAST); nStore++) {
 		auto *pSet = reinterpret_cast<uint32_t *>((&s_SpiFlashData[GetStoreOffset(static_cast<Store>(nStore))]));
 		if (*pSet == UINT32_MAX) {
@@ -150,14 +178,15 @@ uint32_t ConfigStore::GetStoreOffset(Store store) {
 void ConfigStore::ResetSetList(Store store) {
 	assert(store < Store::LAST);
 
-	auto *pbSetList = &s_SpiFlashData[GetStoreOffset(store)];
+	const auto nStoreOffset = GetStoreOffset(store);
+	auto *pbSetList = &s_SpiFlashData[nStoreOffset];
 
 	*pbSetList++ = 0x00;
 	*pbSetList++ = 0x00;
 	*pbSetList++ = 0x00;
 	*pbSetList = 0x00;
 
-	s_State = State::CHANGED;
+	SetChanged(nStoreOffset, sizeof(uint32_t));
 }
 
 void ConfigStore::Update(Store store, uint32_t nOffset, const void *pData, uint32_t nDataLength, uint32_t nSetList, uint32_t nOffsetSetList) {
@@ -169,7 +198,10 @@ void ConfigStore::Update(Store store, uint32_t nOffset, const void *pData, uint3
 	assert((nOffset + nDataLength) <= s_aStorSize[static_cast<uint32_t>(store)]);
 
 	auto bIsChanged = false;
-	const auto nBase = nOffset + GetStoreOffset(store);
+	const auto nStoreOffset = GetStoreOffset(store);
+	const auto nBase = nOffset + nStoreOffset;
+	uint32_t nFirst = 0;
+	uint32_t nLast = 0;
 
 	const auto *pSrc = static_cast<const uint8_t *>(pData);
 	auto *pDst = &s_SpiFlashData[nBase];
@@ -183,7 +215,11 @@ void ConfigStore::Update(Store store, uint32_t nOffset, const void *pData, uint3
 
 	for (uint32_t i = 0; i < nDataLength; i++) {
 		if (*pSrc != *pDst) {
+			if (!bIsChanged) {
+				nFirst = i;
+			}
 			bIsChanged = true;
+			nLast = i;
 			*pDst = *pSrc;
 		}
 		pDst++;
@@ -191,15 +227,16 @@ void ConfigStore::Update(Store store, uint32_t nOffset, const void *pData, uint3
 	}
 
 	if (bIsChanged){
-		auto *pSet = reinterpret_cast<uint32_t *>((&s_SpiFlashData[GetStoreOffset(store)] + nOffsetSetList));
+		auto *pSet = reinterpret_cast<uint32_t *>((&s_SpiFlashData[nStoreOffset] + nOffsetSetList));
 		*pSet |= nSetList;
 	}
 
 	if (bIsChanged) {
-		s_State = State::CHANGED;
+		SetChanged(nStoreOffset + nOffsetSetList, sizeof(uint32_t));
+		SetChanged(nBase + nFirst, 1 + nLast - nFirst);
 	}
 
-	debug_dump(&s_SpiFlashData[GetStoreOffset(store)] + nOffsetSetList, 8);
+	debug_dump(&s_SpiFlashData[nStoreOffset] + nOffsetSetList, 8);
 	DEBUG_EXIT
 }
 
@@ -237,6 +274,10 @@ void ConfigStore::Copy(const Store store, void *pData, uint32_t nDataLength, uin
 }
 
 void ConfigStore::Delay() {
+	if (s_IsJournal && (s_State != State::CHANGED_WAITING)) {
+		return;
+	}
+
 	if (s_State != State::IDLE) {
 		s_State = State::CHANGED;
 	}
@@ -256,12 +297,18 @@ bool ConfigStore::Flash() {
 		if ((Hardware::Get()->Millis() - s_nWaitMillis) < 100) {
 			return true;
 		}
+#if (CONFIG_STORE_JOURNAL_SECTORS > 0)
+		if (s_IsJournal) {
+			s_State = JournalNext();
+			return (s_State != State::IDLE);
+		}
+#endif
 		s_State = State::ERASING;
 		return true;
 		break;
 	case State::ERASING: {
 		storedevice::result result;
-		if (StoreDevice::Erase(s_nStartAddress, FlashStore::SIZE, result)) {
+		if (StoreDevice::Erase(GetBaseAddress(s_nBase), FlashStore::SIZE, result)) {
 			s_nWaitMillis = Hardware::Get()->Millis();
 			s_State = State::ERASED_WAITING;
 		}
@@ -283,6 +330,19 @@ bool ConfigStore::Flash() {
 		break;
 	case State::WRITING: {
 		storedevice::result result;
+#if (CONFIG_STORE_JOURNAL_SECTORS > 0)
+		/*
+		 * The header is written last, an interrupted write leaves the previous base image valid.
+		 */
+		if (s_IsJournal) {
+			if (StoreDevice::Write(GetBaseAddress(s_nBase) + FlashStore::SIGNATURE_SIZE, s_nSpiFlashStoreSize - FlashStore::SIGNATURE_SIZE, &s_SpiFlashData[FlashStore::SIGNATURE_SIZE], result)) {
+				JournalSetBaseHeader();
+				s_State = State::WRITING_HEADER;
+			}
+			assert(result == storedevice::result::OK);
+			return true;
+		}
+#endif
 		if (StoreDevice::Write(s_nStartAddress, s_nSpiFlashStoreSize, reinterpret_cast<uint8_t*>(&s_SpiFlashData), result)) {
 			s_State = State::IDLE;
 			return false;
@@ -291,6 +351,49 @@ bool ConfigStore::Flash() {
 		return true;
 	}
 		break;
+#if (CONFIG_STORE_JOURNAL_SECTORS > 0)
+	case State::WRITING_HEADER: {
+		storedevice::result result;
+		if (StoreDevice::Write(GetBaseAddress(s_nBase), FlashStore::SIGNATURE_SIZE, s_SpiFlashData, result)) {
+			s_nJournalUsed = 0;
+			s_nJournalOffset = FlashStore::SIZE;
+			s_State = JournalNext();
+			return (s_State != State::IDLE);
+		}
+		assert(result == storedevice::result::OK);
+		return true;
+	}
+		break;
+	case State::JOURNAL_ERASING: {
+		storedevice::result result;
+		if (StoreDevice::Erase(GetJournalAddress(s_nJournalSlot), FlashStore::SIZE, result)) {
+			JournalSetHeader();
+			s_nJournalOffset = 0;
+			s_State = State::JOURNAL_WRITING;
+		}
+		assert(result == storedevice::result::OK);
+		return true;
+	}
+		break;
+	case State::JOURNAL_WRITING: {
+		/*
+		 * The first record of a journal sector is written together with the sector header.
+		 */
+		const auto nHeaderSize = (s_nJournalOffset == 0) ? Journal::HEADER_SIZE : 0;
+		const auto nLength = nHeaderSize + s_nRecordLength;
+
+		storedevice::result result;
+		if (StoreDevice::Write(GetJournalAddress(s_nJournalSlot) + s_nJournalOffset, nLength, &s_JournalBuffer[Journal::HEADER_SIZE - nHeaderSize], result)) {
+			s_nJournalOffset += nLength;
+			s_State = JournalNext();
+			return (s_State != State::IDLE);
+		}
+		assert(result == storedevice::result::OK);
+		return true;
+	}
+		break;
+#endif
+
 	default:
 		assert(0);
 		__builtin_unreachable();
@@ -330,6 +433,10 @@ void ConfigStore::Dump() {
 		Hardware::Get()->WatchdogInit();
 	}
 
+	if (s_IsJournal) {
+		printf("Base %u, generation %u, journal sector %u, used %u, offset %u\n", s_nBase, s_nGeneration, s_nJournalSlot, s_nJournalUsed, s_nJournalOffset);
+	}
+
 	printf("m_tState=%d\n", static_cast<uint32_t>(s_State));
 #endif
 }
@@ -0,0 +1,405 @@
+/**
+ * @file configstorejournal.cpp
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The configuration image is kept in two base sectors, the one with the highest
+ * valid generation is used. Changes are appended to a ring of journal sectors
+ * as records { offset, length, CRC, data }. When all journal sectors of the
+ * current generation are full, the image is written to the other base sector
+ * with the next generation, the journal sectors of the previous generation
+ * are then obsolete and erased when used again.
+ *
+ * Base header     : signature[4] generation[4] CRC[4] length[4]
+ * Journal header  : signature[4] generation[4] sequence[4] CRC[4]
+ * Record          : offset[2] length[1] marker[1] CRC[4] data[length] padding
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+
+#include "configstore.h"
+
+#include "platform_configstore.h"
+
+#include "../lib-flash/include/spi/spi_flash_layout.h"
+
+#include "debug.h"
+
+#if (CONFIG_STORE_JOURNAL_SECTORS > 0)
+namespace configstore {
+namespace journal {
+static constexpr uint8_t SIGNATURE[] = {'A', 'v', 'J', 0x01};
+static constexpr uint8_t RECORD_MARKER = 0xA5;
+static constexpr uint32_t SECTORS = CONFIG_STORE_JOURNAL_SECTORS;
+static constexpr uint32_t GENERATION_NO_JOURNAL = UINT32_MAX;	///< Image written before the journal was introduced
+}  // namespace journal
+}  // namespace configstore
+
+static_assert(configstore::journal::SECTORS <= spi_flash::layout::CONFIG_STORE_JOURNAL_SECTORS_MAX, "CONFIG_STORE_JOURNAL_SECTORS does not fit in the flash layout");
+
+using namespace configstore;
+
+/*
+ * Base 0 is the legacy configuration sector (s_nStartAddress), the Art-Net failsafe
+ * record is between base 0 and base 1, see spi_flash_layout.h
+ */
+uint32_t ConfigStore::GetBaseAddress(const uint32_t nBase) const {
+	return s_nStartAddress - ((nBase == 0 ? spi_flash::layout::CONFIG_STORE_BASE0 : spi_flash::layout::CONFIG_STORE_BASE1) * FlashStore::SIZE);
+}
+
+uint32_t ConfigStore::GetJournalAddress(const uint32_t nSlot) const {
+	return s_nStartAddress - ((spi_flash::layout::CONFIG_STORE_JOURNAL_FIRST + nSlot) * FlashStore::SIZE);
+}
+
+static uint32_t crc32(uint32_t nCrc, const uint8_t *pData, uint32_t nLength) {
+	static constexpr uint32_t s_Table[16] = {
+		0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+		0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+	};
+
+	nCrc = ~nCrc;
+
+	while (nLength-- != 0) {
+		nCrc = (nCrc >> 4) ^ s_Table[(nCrc ^ *pData) & 0x0F];
+		nCrc = (nCrc >> 4) ^ s_Table[(nCrc ^ (*pData >> 4)) & 0x0F];
+		pData++;
+	}
+
+	return ~nCrc;
+}
+
+static uint32_t get_uint32(const uint8_t *pData) {
+	uint32_t nValue;
+	memcpy(&nValue, pData, sizeof(uint32_t));
+	return nValue;
+}
+
+static void set_uint32(uint8_t *pData, const uint32_t nValue) {
+	memcpy(pData, &nValue, sizeof(uint32_t));
+}
+
+uint32_t ConfigStore::GetFlashCrc(const uint32_t nAddress, const uint32_t nLength) {
+	uint32_t nCrc = 0;
+	uint32_t nIndex = 0;
+
+	while (nIndex < nLength) {
+		auto nSize = nLength - nIndex;
+
+		if (nSize > sizeof(s_JournalBuffer)) {
+			nSize = sizeof(s_JournalBuffer);
+		}
+
+		storedevice::result result;
+		StoreDevice::Read(nAddress + nIndex, nSize, s_JournalBuffer, result);
+		assert(result == storedevice::result::OK);
+
+		nCrc = crc32(nCrc, s_JournalBuffer, nSize);
+		nIndex += nSize;
+	}
+
+	return nCrc;
+}
+
+bool ConfigStore::IsBaseValid(const uint32_t nBase, uint32_t& nGeneration) {
+	uint8_t header[FlashStore::SIGNATURE_SIZE];
+
+	storedevice::result result;
+	StoreDevice::Read(GetBaseAddress(nBase), sizeof(header), header, result);
+	assert(result == storedevice::result::OK);
+
+	if (memcmp(header, FlashStore::SIGNATURE, sizeof(FlashStore::SIGNATURE)) != 0) {
+		return false;
+	}
+
+	nGeneration = get_uint32(&header[4]);
+
+	if (nGeneration == journal::GENERATION_NO_JOURNAL) {
+		nGeneration = 0;
+		return (nBase == 0);
+	}
+
+	const auto nLength = get_uint32(&header[12]);
+
+	if ((nLength < FlashStore::OFFSET_STORES) || (nLength > FlashStore::SIZE)) {
+		return false;
+	}
+
+	return GetFlashCrc(GetBaseAddress(nBase) + FlashStore::SIGNATURE_SIZE, nLength - FlashStore::SIGNATURE_SIZE) == get_uint32(&header[8]);
+}
+
+/**
+ * @return The append offset, FlashStore::SIZE when the journal sector cannot be appended.
+ */
+uint32_t ConfigStore::JournalReplay(const uint32_t nAddress) {
+	auto *pRecord = &s_JournalBuffer[Journal::HEADER_SIZE];
+	auto nOffset = Journal::HEADER_SIZE;
+
+	while ((nOffset + Journal::RECORD_HEADER_SIZE) <= FlashStore::SIZE) {
+		storedevice::result result;
+		StoreDevice::Read(nAddress + nOffset, Journal::RECORD_HEADER_SIZE, pRecord, result);
+		assert(result == storedevice::result::OK);
+
+		if (pRecord[3] != journal::RECORD_MARKER) {
+			for (uint32_t i = 0; i < Journal::RECORD_HEADER_SIZE; i++) {
+				if (pRecord[i] != 0xFF) {
+					DEBUG_PRINTF("Invalid record at %u", nOffset);
+					return FlashStore::SIZE;
+				}
+			}
+			return nOffset;
+		}
+
+		const auto nRecordOffset = static_cast<uint32_t>(pRecord[0] | (pRecord[1] << 8));
+		const auto nLength = static_cast<uint32_t>(pRecord[2]);
+		const auto nRecordLength = Journal::RECORD_HEADER_SIZE + ((nLength + 3U) & ~3U);
+
+		if ((nLength == 0) || (nLength > Journal::RECORD_DATA_MAX) || (nRecordOffset < FlashStore::SIGNATURE_SIZE)
+				|| ((nRecordOffset + nLength) > FlashStore::SIZE) || ((nOffset + nRecordLength) > FlashStore::SIZE)) {
+			DEBUG_PRINTF("Invalid record at %u", nOffset);
+			return FlashStore::SIZE;
+		}
+
+		StoreDevice::Read(nAddress + nOffset + Journal::RECORD_HEADER_SIZE, nLength, &pRecord[Journal::RECORD_HEADER_SIZE], result);
+		assert(result == storedevice::result::OK);
+
+		const auto nCrc = crc32(crc32(0, pRecord, 4), &pRecord[Journal::RECORD_HEADER_SIZE], nLength);
+
+		if (nCrc != get_uint32(&pRecord[4])) {
+			DEBUG_PRINTF("CRC error at %u", nOffset);
+			return FlashStore::SIZE;
+		}
+
+		memcpy(&s_SpiFlashData[nRecordOffset], &pRecord[Journal::RECORD_HEADER_SIZE], nLength);
+		nOffset += nRecordLength;
+	}
+
+	return nOffset;
+}
+
+/**
+ * @return false when there is no valid base image
+ */
+bool ConfigStore::JournalInit() {
+	DEBUG_ENTRY
+
+	s_nJournalSlot = journal::SECTORS - 1;
+	s_nJournalUsed = 0;
+	s_nJournalSequence = 0;
+	s_nJournalOffset = FlashStore::SIZE;
+
+	uint32_t nGeneration[2];
+	const bool isValid[2] = { IsBaseValid(0, nGeneration[0]), IsBaseValid(1, nGeneration[1]) };
+
+	DEBUG_PRINTF("isValid={%d,%d}, nGeneration={%u,%u}", isValid[0], isValid[1], nGeneration[0], nGeneration[1]);
+
+	if (!isValid[0] && !isValid[1]) {
+		s_IsCompactNeeded = true;
+		DEBUG_EXIT
+		return false;
+	}
+
+	if (isValid[0] && isValid[1]) {
+		s_nBase = (static_cast<int32_t>(nGeneration[1] - nGeneration[0]) > 0) ? 1 : 0;
+	} else {
+		s_nBase = isValid[1] ? 1 : 0;
+	}
+
+	s_nGeneration = nGeneration[s_nBase];
+
+	storedevice::result result;
+	StoreDevice::Read(GetBaseAddress(s_nBase), FlashStore::SIZE, s_SpiFlashData, result);
+	assert(result == storedevice::result::OK);
+
+	/*
+	 * The sequence number continues over the generations, the sector after
+	 * the most recent one is used next.
+	 */
+	uint32_t nSequence[journal::SECTORS];
+	bool isCurrent[journal::SECTORS];
+	auto isFound = false;
+
+	for (uint32_t nSlot = 0; nSlot < journal::SECTORS; nSlot++) {
+		uint8_t header[Journal::HEADER_SIZE];
+		StoreDevice::Read(GetJournalAddress(nSlot), sizeof(header), header, result);
+		assert(result == storedevice::result::OK);
+
+		isCurrent[nSlot] = false;
+
+		if ((memcmp(header, journal::SIGNATURE, sizeof(journal::SIGNATURE)) != 0) || (crc32(0, header, 12) != get_uint32(&header[12]))) {
+			continue;
+		}
+
+		nSequence[nSlot] = get_uint32(&header[8]);
+		isCurrent[nSlot] = (get_uint32(&header[4]) == s_nGeneration);
+
+		if (!isFound || (static_cast<int32_t>(nSequence[nSlot] - s_nJournalSequence) > 0)) {
+			s_nJournalSequence = nSequence[nSlot];
+			s_nJournalSlot = nSlot;
+			isFound = true;
+		}
+	}
+
+	/*
+	 * Replay the journal sectors of this generation, oldest first.
+	 */
+	for (;;) {
+		auto nNext = journal::SECTORS;
+
+		for (uint32_t nSlot = 0; nSlot < journal::SECTORS; nSlot++) {
+			if (isCurrent[nSlot] && ((nNext == journal::SECTORS) || (static_cast<int32_t>(nSequence[nSlot] - nSequence[nNext]) < 0))) {
+				nNext = nSlot;
+			}
+		}
+
+		if (nNext == journal::SECTORS) {
+			break;
+		}
+
+		isCurrent[nNext] = false;
+
+		s_nJournalOffset = JournalReplay(GetJournalAddress(nNext));
+		s_nJournalSlot = nNext;
+		s_nJournalUsed++;
+
+		DEBUG_PRINTF("Replayed slot %u, sequence %u, nOffset=%u", nNext, nSequence[nNext], s_nJournalOffset);
+	}
+
+	DEBUG_PRINTF("s_nBase=%u, s_nGeneration=%u, s_nJournalSlot=%u, s_nJournalUsed=%u", s_nBase, s_nGeneration, s_nJournalSlot, s_nJournalUsed);
+	DEBUG_EXIT
+	return true;
+}
+
+/**
+ * Takes the next run of changed chunks, at most Journal::RECORD_DATA_MAX bytes.
+ */
+bool ConfigStore::JournalBuildRecord() {
+	uint32_t nFirst = Journal::CHUNKS;
+
+	for (uint32_t nWord = 0; nWord < (Journal::CHUNKS / 32); nWord++) {
+		if (s_Changed[nWord] != 0) {
+			nFirst = (nWord * 32) + static_cast<uint32_t>(__builtin_ctz(s_Changed[nWord]));
+			break;
+		}
+	}
+
+	if (nFirst == Journal::CHUNKS) {
+		return false;
+	}
+
+	auto nChunk = nFirst;
+
+	do {
+		s_Changed[nChunk / 32] &= ~(1U << (nChunk & 31));
+		nChunk++;
+	} while ((nChunk < Journal::CHUNKS) && ((s_Changed[nChunk / 32] & (1U << (nChunk & 31))) != 0) && (((nChunk - nFirst) * Journal::CHUNK_SIZE) < Journal::RECORD_DATA_MAX));
+
+	const auto nOffset = nFirst * Journal::CHUNK_SIZE;
+	auto nLength = (nChunk - nFirst) * Journal::CHUNK_SIZE;
+
+	if ((nOffset + nLength) > s_nSpiFlashStoreSize) {
+		nLength = s_nSpiFlashStoreSize - nOffset;
+	}
+
+	assert(nOffset >= FlashStore::SIGNATURE_SIZE);
+	assert((nLength != 0) && (nLength <= Journal::RECORD_DATA_MAX));
+
+	auto *pRecord = &s_JournalBuffer[Journal::HEADER_SIZE];
+
+	pRecord[0] = static_cast<uint8_t>(nOffset);
+	pRecord[1] = static_cast<uint8_t>(nOffset >> 8);
+	pRecord[2] = static_cast<uint8_t>(nLength);
+	pRecord[3] = journal::RECORD_MARKER;
+
+	memcpy(&pRecord[Journal::RECORD_HEADER_SIZE], &s_SpiFlashData[nOffset], nLength);
+
+	set_uint32(&pRecord[4], crc32(crc32(0, pRecord, 4), &pRecord[Journal::RECORD_HEADER_SIZE], nLength));
+
+	s_nRecordLength = Journal::RECORD_HEADER_SIZE + ((nLength + 3U) & ~3U);
+
+	for (auto i = Journal::RECORD_HEADER_SIZE + nLength; i < s_nRecordLength; i++) {
+		pRecord[i] = 0xFF;
+	}
+
+	DEBUG_PRINTF("nOffset=%u, nLength=%u", nOffset, nLength);
+	return true;
+}
+
+void ConfigStore::JournalSetHeader() {
+	memcpy(s_JournalBuffer, journal::SIGNATURE, sizeof(journal::SIGNATURE));
+	set_uint32(&s_JournalBuffer[4], s_nGeneration);
+	set_uint32(&s_JournalBuffer[8], s_nJournalSequence);
+	set_uint32(&s_JournalBuffer[12], crc32(0, s_JournalBuffer, 12));
+}
+
+/**
+ * The CRC is taken from the written image, so that changes made
+ * while writing are not part of it. These are in the journal.
+ */
+void ConfigStore::JournalSetBaseHeader() {
+	const auto nCrc = GetFlashCrc(GetBaseAddress(s_nBase) + FlashStore::SIGNATURE_SIZE, s_nSpiFlashStoreSize - FlashStore::SIGNATURE_SIZE);
+
+	set_uint32(&s_SpiFlashData[4], s_nGeneration);
+	set_uint32(&s_SpiFlashData[8], nCrc);
+	set_uint32(&s_SpiFlashData[12], s_nSpiFlashStoreSize);
+}
+
+State ConfigStore::JournalNext() {
+	if (s_IsCompactNeeded) {
+		s_IsCompactNeeded = false;
+		memset(s_Changed, 0, sizeof(s_Changed));
+
+		s_nBase ^= 1;
+		s_nGeneration++;
+
+		if (s_nGeneration == journal::GENERATION_NO_JOURNAL) {
+			s_nGeneration = 0;
+		}
+
+		DEBUG_PRINTF("Compact -> s_nBase=%u, s_nGeneration=%u", s_nBase, s_nGeneration);
+		return State::ERASING;
+	}
+
+	if (!JournalBuildRecord()) {
+		return State::IDLE;
+	}
+
+	if ((s_nJournalOffset + s_nRecordLength) > FlashStore::SIZE) {
+		if (s_nJournalUsed == journal::SECTORS) {
+			s_IsCompactNeeded = true;
+			return JournalNext();
+		}
+
+		s_nJournalSlot = (s_nJournalSlot + 1) % journal::SECTORS;
+		s_nJournalUsed++;
+		s_nJournalSequence++;
+
+		DEBUG_PRINTF("s_nJournalSlot=%u, s_nJournalSequence=%u", s_nJournalSlot, s_nJournalSequence);
+		return State::JOURNAL_ERASING;
+	}
+
+	return State::JOURNAL_WRITING;
+}
+#endif
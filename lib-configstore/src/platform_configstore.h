@@ -37,4 +37,16 @@
 # define SECTION_CONFIGSTORE
 #endif
 
+/*
+ * Number of journal sectors below the two base images.
+ * The I2C EEPROM and the backup SRAM are too small, the internal flash sectors are too large.
+ */
+#if !defined (CONFIG_STORE_JOURNAL_SECTORS)
+# if defined (CONFIG_STORE_USE_I2C) || defined (CONFIG_STORE_USE_RAM) || defined (CONFIG_STORE_USE_ROM)
+#  define CONFIG_STORE_JOURNAL_SECTORS	0
+# else
+#  define CONFIG_STORE_JOURNAL_SECTORS	4
+# endif
+#endif
+
 #endif /* PLATFORM_CONFIGSTORE_H_ */
@@ -36,6 +36,7 @@
 
 #include "lightset.h"
 #include "lightsetdata.h"
+#include "lightsetuniverseindex.h"
 
 #if !(ARTNET_VERSION >= 4)
 # if defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI)
@@ -157,15 +158,15 @@ public:
 	}
 
 	bool GetOutputPort(const uint16_t nUniverse, uint32_t& nPortIndex) {
-		for (nPortIndex = 0; nPortIndex < e131bridge::MAX_PORTS; nPortIndex++) {
-			if (m_Bridge.Port[nPortIndex].direction != lightset::PortDir::OUTPUT) {
-				continue;
-			}
-			if (m_Bridge.Port[nPortIndex].nUniverse == nUniverse) {
-				return true;
-			}
+		const auto nPortMask = m_OutputPortIndex.Get(nUniverse);
+
+		if (nPortMask == 0) {
+			nPortIndex = e131bridge::MAX_PORTS;
+			return false;
 		}
-		return false;
+
+		nPortIndex = static_cast<uint32_t>(__builtin_ctz(nPortMask));
+		return true;
 	}
 
 	void SetMergeMode(uint32_t nPortIndex, lightset::MergeMode mergeMode) {
@@ -388,8 +389,10 @@ private:
 	void HandleSynchronization();
 
 	void LeaveUniverse(uint32_t nPortIndex, uint16_t nUniverse);
+	void UpdateOutputPortIndex();
 
 	void HandleDmxIn();
+	void SendDataPacket(const uint32_t nPortIndex, const uint8_t *pData, const uint32_t nLength);
 	void SetLocalMerging();
 	void FillDataPacket();
 	void FillDiscoveryPacket();
@@ -406,6 +409,7 @@ private:
 	e131bridge::State m_State;
 	e131bridge::Bridge m_Bridge;
 	e131bridge::OutputPort m_OutputPort[e131bridge::MAX_PORTS];
+	lightset::UniverseIndex<e131bridge::MAX_PORTS> m_OutputPortIndex;	///< Universe -> output ports
 	e131bridge::InputPort m_InputPort[e131bridge::MAX_PORTS];
 
 	bool m_bEnableDataIndicator { true };
@@ -100,6 +100,7 @@ private:
 	void FillSynchronizationPacket();
 	void SendDiscoveryPacket();
 	uint8_t GetSequenceNumber(uint16_t nUniverse, uint32_t &nMulticastIpAddress);
+	bool SendDataPacketInPlace(uint32_t nIp, const uint8_t *pDmxData, uint32_t nLength);
 
 private:
 	int32_t m_nHandle { -1 };
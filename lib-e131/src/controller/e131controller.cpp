@@ -213,6 +213,11 @@ void E131Controller::HandleDmxOut(uint16_t nUniverse, const uint8_t *pDmxData, u
 
 	// Data Layer
 	m_pE131DataPacket->DMPLayer.FlagsLength = __builtin_bswap16(static_cast<uint16_t>((0x07 << 12) | (DATA_LAYER_LENGTH(1U + nLength))));
+	m_pE131DataPacket->DMPLayer.PropertyValueCount = __builtin_bswap16(static_cast<uint16_t>(1 + nLength));
+
+	if (SendDataPacketInPlace(nIp, pDmxData, nLength)) {
+		return;
+	}
 
 	if (__builtin_expect((m_nMaster == DMX_MAX_VALUE), 1)) {
 		memcpy(&m_pE131DataPacket->DMPLayer.PropertyValues[1], pDmxData, nLength);
@@ -224,11 +229,33 @@ void E131Controller::HandleDmxOut(uint16_t nUniverse, const uint8_t *pDmxData, u
 		}
 	}
 
-	m_pE131DataPacket->DMPLayer.PropertyValueCount = __builtin_bswap16(static_cast<uint16_t>(1 + nLength));
-
 	Network::Get()->SendTo(m_nHandle, m_pE131DataPacket, static_cast<uint16_t>(DATA_PACKET_SIZE(1U + nLength)), nIp, e131::UDP_PORT);
 }
 
+/*
+ * The DMX data goes straight into the TX buffer, the headers and the start code are taken from m_pE131DataPacket.
+ * A master other than full uses the staged property values.
+ */
+bool E131Controller::SendDataPacketInPlace(uint32_t nIp, const uint8_t *pDmxData, uint32_t nLength) {
+	static constexpr uint32_t HEADER_SIZE = DATA_PACKET_SIZE(1);	// Including the start code
+
+	if (m_nMaster != DMX_MAX_VALUE) {
+		return false;
+	}
+
+	auto *pBuffer = Network::Get()->SendToReserve(m_nHandle, nIp, e131::UDP_PORT);
+
+	if (__builtin_expect((pBuffer == nullptr), 0)) {
+		return false;
+	}
+
+	Network::Get()->SendToCopy(pBuffer, m_pE131DataPacket, HEADER_SIZE);
+	Network::Get()->SendToCopy(&pBuffer[HEADER_SIZE], pDmxData, nLength);
+	Network::Get()->SendToCommit(HEADER_SIZE + nLength);
+
+	return true;
+}
+
 void E131Controller::HandleSync() {
 	if (m_State.SynchronizationPacket.nUniverseNumber != 0) {
 		m_pE131SynchronizationPacket->FrameLayer.SequenceNumber = m_State.SynchronizationPacket.nSequenceNumber++;
@@ -62,6 +62,39 @@ void E131Bridge::FillDataPacket() {
 
 static uint32_t s_ReceivingMask = 0;
 
+/*
+ * Without local merge the property values go straight into the TX buffer,
+ * only the headers are built in m_E131DataPacket.
+ */
+void E131Bridge::SendDataPacket(const uint32_t nPortIndex, const uint8_t *pData, const uint32_t nLength) {
+	static constexpr uint32_t HEADER_SIZE = DATA_PACKET_SIZE(0);
+	// Root Layer (See Section 5)
+	m_E131DataPacket.RootLayer.FlagsLength = __builtin_bswap16(static_cast<uint16_t>((0x07 << 12) | (DATA_ROOT_LAYER_LENGTH(nLength))));
+	// E1.31 Framing Layer (See Section 6)
+	m_E131DataPacket.FrameLayer.FLagsLength = __builtin_bswap16(static_cast<uint16_t>((0x07 << 12) | (DATA_FRAME_LAYER_LENGTH(nLength))));
+	m_E131DataPacket.FrameLayer.Priority = m_InputPort[nPortIndex].nPriority;
+	m_E131DataPacket.FrameLayer.SequenceNumber = m_InputPort[nPortIndex].nSequenceNumber++;
+	m_E131DataPacket.FrameLayer.Universe = __builtin_bswap16(m_Bridge.Port[nPortIndex].nUniverse);
+	// Data Layer
+	m_E131DataPacket.DMPLayer.FlagsLength = __builtin_bswap16(static_cast<uint16_t>((0x07 << 12) | (DATA_LAYER_LENGTH(nLength))));
+	m_E131DataPacket.DMPLayer.PropertyValueCount = __builtin_bswap16(static_cast<uint16_t>(nLength));
+
+	if (!m_Bridge.Port[nPortIndex].bLocalMerge) {
+		auto *pBuffer = Network::Get()->SendToReserve(m_nHandle, m_InputPort[nPortIndex].nMulticastIp, e131::UDP_PORT);
+
+		if (__builtin_expect((pBuffer != nullptr), 1)) {
+			Network::Get()->SendToCopy(pBuffer, &m_E131DataPacket, HEADER_SIZE);
+			Network::Get()->SendToCopy(&pBuffer[HEADER_SIZE], pData, nLength);
+			Network::Get()->SendToCommit(HEADER_SIZE + nLength);
+			return;
+		}
+	}
+
+	memcpy(m_E131DataPacket.DMPLayer.PropertyValues, pData, nLength);
+
+	Network::Get()->SendTo(m_nHandle, &m_E131DataPacket, DATA_PACKET_SIZE(nLength), m_InputPort[nPortIndex].nMulticastIp, e131::UDP_PORT);
+}
+
 void E131Bridge::HandleDmxIn() {
 	for (uint32_t nPortIndex = 0 ; nPortIndex < e131bridge::MAX_PORTS; nPortIndex++) {
 		if ((m_Bridge.Port[nPortIndex].direction == lightset::PortDir::INPUT) && (!m_InputPort[nPortIndex].IsDisabled)) {
@@ -69,20 +102,7 @@ void E131Bridge::HandleDmxIn() {
 			const auto *const pDmxData = reinterpret_cast<const struct Data *>(Dmx::Get()->GetDmxChanged(nPortIndex));
 
 			if (pDmxData != nullptr) {
-				// Root Layer (See Section 5)
-				auto nLength = (1U + pDmxData->Statistics.nSlotsInPacket); // Add 1 for SC
-				m_E131DataPacket.RootLayer.FlagsLength = __builtin_bswap16(static_cast<uint16_t>((0x07 << 12) | (DATA_ROOT_LAYER_LENGTH(nLength))));
-				// E1.31 Framing Layer (See Section 6)
-				m_E131DataPacket.FrameLayer.FLagsLength = __builtin_bswap16(static_cast<uint16_t>((0x07 << 12) | (DATA_FRAME_LAYER_LENGTH(nLength))));
-				m_E131DataPacket.FrameLayer.Priority = m_InputPort[nPortIndex].nPriority;
-				m_E131DataPacket.FrameLayer.SequenceNumber = m_InputPort[nPortIndex].nSequenceNumber++;
-				m_E131DataPacket.FrameLayer.Universe = __builtin_bswap16(m_Bridge.Port[nPortIndex].nUniverse);
-				// Data Layer
-				m_E131DataPacket.DMPLayer.FlagsLength = __builtin_bswap16(static_cast<uint16_t>((0x07 << 12) | (DATA_LAYER_LENGTH(nLength))));
-				memcpy(m_E131DataPacket.DMPLayer.PropertyValues, pDmxData, nLength);
-				m_E131DataPacket.DMPLayer.PropertyValueCount = __builtin_bswap16(static_cast<uint16_t>(nLength));
-
-				Network::Get()->SendTo(m_nHandle, &m_E131DataPacket, DATA_PACKET_SIZE(nLength), m_InputPort[nPortIndex].nMulticastIp, e131::UDP_PORT);
+				SendDataPacket(nPortIndex, reinterpret_cast<const uint8_t *>(pDmxData), 1U + pDmxData->Statistics.nSlotsInPacket); // Add 1 for SC
 
 				if (m_Bridge.Port[nPortIndex].bLocalMerge) {
 					m_pReceiveBuffer = reinterpret_cast<uint8_t *>(&m_E131DataPacket);
@@ -121,20 +141,7 @@ void E131Bridge::HandleDmxIn() {
 
 				if (sendArtDmx) {
 					const auto *const pDmxData = reinterpret_cast<const struct Data *>(Dmx::Get()->GetDmxCurrentData(nPortIndex));
-					// Root Layer (See Section 5)
-					auto nLength = (1U + pDmxData->Statistics.nSlotsInPacket); // Add 1 for SC
-					m_E131DataPacket.RootLayer.FlagsLength = __builtin_bswap16(static_cast<uint16_t>((0x07 << 12) | (DATA_ROOT_LAYER_LENGTH(nLength))));
-					// E1.31 Framing Layer (See Section 6)
-					m_E131DataPacket.FrameLayer.FLagsLength = __builtin_bswap16(static_cast<uint16_t>((0x07 << 12) | (DATA_FRAME_LAYER_LENGTH(nLength))));
-					m_E131DataPacket.FrameLayer.Priority = m_InputPort[nPortIndex].nPriority;
-					m_E131DataPacket.FrameLayer.SequenceNumber = m_InputPort[nPortIndex].nSequenceNumber++;
-					m_E131DataPacket.FrameLayer.Universe = __builtin_bswap16(m_Bridge.Port[nPortIndex].nUniverse);
-					// Data Layer
-					m_E131DataPacket.DMPLayer.FlagsLength = __builtin_bswap16(static_cast<uint16_t>((0x07 << 12) | (DATA_LAYER_LENGTH(nLength))));
-					memcpy(m_E131DataPacket.DMPLayer.PropertyValues, pDmxData, nLength);
-					m_E131DataPacket.DMPLayer.PropertyValueCount = __builtin_bswap16(static_cast<uint16_t>(nLength));
-
-					Network::Get()->SendTo(m_nHandle, &m_E131DataPacket, DATA_PACKET_SIZE(nLength), m_InputPort[nPortIndex].nMulticastIp, e131::UDP_PORT);
+					SendDataPacket(nPortIndex, reinterpret_cast<const uint8_t *>(pDmxData), 1U + pDmxData->Statistics.nSlotsInPacket); // Add 1 for SC
 
 					if (m_Bridge.Port[nPortIndex].bLocalMerge) {
 						m_pReceiveBuffer = reinterpret_cast<uint8_t *>(&m_E131DataPacket);
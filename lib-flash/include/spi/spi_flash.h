@@ -40,4 +40,38 @@ int spi_flash_cmd_write_multi(uint32_t offset, size_t len, const uint8_t *buf);
 int spi_flash_cmd_erase(uint32_t offset, size_t len);
 int spi_flash_cmd_write_status(uint8_t sr);
 
+/*
+ * Non-blocking erase and program. Each spi_flash_async_run() call reads the status register once,
+ * and when the flash is ready, it starts the next sector erase or page program.
+ */
+typedef void (*spi_flash_callback)(int result);
+
+int spi_flash_async_erase(uint32_t offset, size_t len, spi_flash_callback callback = nullptr);
+int spi_flash_async_write(uint32_t offset, size_t len, const uint8_t *buf, spi_flash_callback callback = nullptr);
+/**
+ * @return 1 when in progress, 0 when done, < 0 on error
+ */
+int spi_flash_async_run();
+bool spi_flash_async_is_busy();
+
+/*
+ * The ConfigStore, the firmware installer and the failsafe record share the asynchronous engine.
+ * Each keeps its own spi_flash_async_user and calls the step function with the same arguments
+ * until it returns <= 0. While the operation of another user is in progress, nothing is started
+ * and that operation is driven instead.
+ */
+struct spi_flash_async_user {
+	enum class State : uint8_t {
+		IDLE, PENDING, DONE
+	};
+	State state;
+	int nResult;
+};
+
+/**
+ * @return 1 when in progress or waiting, 0 when done, < 0 on error
+ */
+int spi_flash_async_erase_step(spi_flash_async_user& user, uint32_t offset, size_t len);
+int spi_flash_async_write_step(spi_flash_async_user& user, uint32_t offset, size_t len, const uint8_t *buf);
+
 #endif /* SPI_FLASH_H_ */
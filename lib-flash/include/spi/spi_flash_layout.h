@@ -0,0 +1,70 @@
+/**
+ * @file spi_flash_layout.h
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef SPI_FLASH_LAYOUT_H_
+#define SPI_FLASH_LAYOUT_H_
+
+#include <cstdint>
+
+/*
+ * The top of the SPI flash, in 4 KiB sectors counted down from the end of the device.
+ *
+ *  0                                  ConfigStore base 0 (the legacy configuration sector)
+ *  1 .. FAILSAFE_SECTORS              Art-Net failsafe record, the top sectors are used
+ *  CONFIG_STORE_BASE1                 ConfigStore base 1
+ *  CONFIG_STORE_JOURNAL_FIRST ..      ConfigStore journal
+ */
+namespace spi_flash {
+namespace layout {
+static constexpr uint32_t SECTOR_SIZE = 4096;
+
+static constexpr uint32_t CONFIG_STORE_BASE0 = 0;
+static constexpr uint32_t FAILSAFE_FIRST = 1;
+static constexpr uint32_t FAILSAFE_SECTORS = 8;		///< 32 ports * 512 slots need 5 sectors
+static constexpr uint32_t CONFIG_STORE_BASE1 = FAILSAFE_FIRST + FAILSAFE_SECTORS;
+static constexpr uint32_t CONFIG_STORE_JOURNAL_FIRST = CONFIG_STORE_BASE1 + 1;
+static constexpr uint32_t CONFIG_STORE_JOURNAL_SECTORS_MAX = 8;
+static constexpr uint32_t SECTORS = CONFIG_STORE_JOURNAL_FIRST + CONFIG_STORE_JOURNAL_SECTORS_MAX;
+
+/**
+ * @return The start address of the sector nSector, counted down from the end of the flash
+ */
+inline constexpr uint32_t get_address(const uint32_t nFlashSize, const uint32_t nSector) {
+	return nFlashSize - ((nSector + 1) * SECTOR_SIZE);
+}
+
+inline constexpr bool is_disjoint(const uint32_t nFirstA, const uint32_t nCountA, const uint32_t nFirstB, const uint32_t nCountB) {
+	return ((nFirstA + nCountA) <= nFirstB) || ((nFirstB + nCountB) <= nFirstA);
+}
+
+static_assert(is_disjoint(CONFIG_STORE_BASE0, 1, FAILSAFE_FIRST, FAILSAFE_SECTORS), "Failsafe overlaps ConfigStore base 0");
+static_assert(is_disjoint(CONFIG_STORE_BASE1, 1, FAILSAFE_FIRST, FAILSAFE_SECTORS), "Failsafe overlaps ConfigStore base 1");
+static_assert(is_disjoint(CONFIG_STORE_JOURNAL_FIRST, CONFIG_STORE_JOURNAL_SECTORS_MAX, FAILSAFE_FIRST, FAILSAFE_SECTORS), "Failsafe overlaps the ConfigStore journal");
+static_assert(is_disjoint(CONFIG_STORE_JOURNAL_FIRST, CONFIG_STORE_JOURNAL_SECTORS_MAX, CONFIG_STORE_BASE0, 1), "Journal overlaps ConfigStore base 0");
+static_assert(is_disjoint(CONFIG_STORE_JOURNAL_FIRST, CONFIG_STORE_JOURNAL_SECTORS_MAX, CONFIG_STORE_BASE1, 1), "Journal overlaps ConfigStore base 1");
+}  // namespace layout
+}  // namespace spi_flash
+
+#endif /* SPI_FLASH_LAYOUT_H_ */
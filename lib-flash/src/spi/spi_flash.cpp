@@ -365,6 +365,202 @@ int spi_flash_cmd_write_status(uint8_t sr) {
 	return 0;
 }
 
+namespace spi_flash_async {
+enum class State {
+	IDLE, ERASE, WRITE
+};
+
+static State s_State = State::IDLE;
+static uint32_t s_nOffset;
+static size_t s_nLength;
+static const uint8_t *s_pBuffer;
+static uint32_t s_nTimeBase;
+static uint32_t s_nTimeOut;
+static spi_flash_callback s_Callback;
+static spi_flash_async_user *s_pUser;
+}  // namespace spi_flash_async
+
+/*
+ * A single status read, the flash is not polled until ready.
+ */
+static bool spi_flash_is_ready() {
+	uint8_t status;
+	uint8_t check_status = 0x0;
+	uint8_t poll_bit = STATUS_WIP;
+
+	if (s_flash.poll_cmd == CMD_FLAG_STATUS) {
+		poll_bit = STATUS_PEC;
+		check_status = poll_bit;
+	}
+
+	spi_flash_cmd(s_flash.poll_cmd, &status, 1);
+
+	return (status & poll_bit) == check_status;
+}
+
+static int spi_flash_async_done(int ret) {
+	using namespace spi_flash_async;
+
+	s_State = State::IDLE;
+
+	if (s_pUser != nullptr) {
+		s_pUser->nResult = ret;
+		s_pUser->state = spi_flash_async_user::State::DONE;
+		s_pUser = nullptr;
+	}
+
+	if (s_Callback != nullptr) {
+		s_Callback(ret);
+	}
+
+	return ret;
+}
+
+int spi_flash_async_erase(uint32_t offset, size_t len, spi_flash_callback callback) {
+	using namespace spi_flash_async;
+	DEBUG_PRINTF("offset=%x, len=%u", offset, static_cast<unsigned int>(len));
+
+	if (s_State != State::IDLE) {
+		DEBUG_PUTS("Busy");
+		return -1;
+	}
+
+	if (offset % s_flash.sector_size || len % s_flash.sector_size) {
+		DEBUG_PUTS("Erase offset/length not multiple of erase size");
+		return -1;
+	}
+
+	s_nOffset = offset;
+	s_nLength = len;
+	s_pBuffer = nullptr;
+	s_nTimeBase = get_timer(0);
+	s_nTimeOut = SPI_FLASH_SECTOR_ERASE_TIMEOUT;
+	s_Callback = callback;
+	s_pUser = nullptr;
+	s_State = State::ERASE;
+
+	return 0;
+}
+
+int spi_flash_async_write(uint32_t offset, size_t len, const uint8_t *buf, spi_flash_callback callback) {
+	using namespace spi_flash_async;
+	DEBUG_PRINTF("offset=%x, len=%u", offset, static_cast<unsigned int>(len));
+
+	if (s_State != State::IDLE) {
+		DEBUG_PUTS("Busy");
+		return -1;
+	}
+
+	s_nOffset = offset;
+	s_nLength = len;
+	s_pBuffer = buf;
+	s_nTimeBase = get_timer(0);
+	s_nTimeOut = SPI_FLASH_SECTOR_ERASE_TIMEOUT;
+	s_Callback = callback;
+	s_pUser = nullptr;
+	s_State = State::WRITE;
+
+	return 0;
+}
+
+bool spi_flash_async_is_busy() {
+	return spi_flash_async::s_State != spi_flash_async::State::IDLE;
+}
+
+int spi_flash_async_run() {
+	using namespace spi_flash_async;
+
+	if (s_State == State::IDLE) {
+		return 0;
+	}
+
+	if (!spi_flash_is_ready()) {
+		if (get_timer(s_nTimeBase) < s_nTimeOut) {
+			return 1;
+		}
+
+		DEBUG_PUTS("time out");
+		return spi_flash_async_done(-1);
+	}
+
+	if (s_nLength == 0) {
+		return spi_flash_async_done(0);
+	}
+
+	uint8_t cmd[4];
+	int ret;
+
+	spi_flash_addr(s_nOffset, cmd);
+
+	if (s_State == State::ERASE) {
+		cmd[0] = (s_flash.sector_size == 4096) ? CMD_ERASE_4K : CMD_ERASE_64K;
+
+		ret = spi_flash_write_common(cmd, sizeof(cmd), nullptr, 0, false);
+
+		s_nOffset += s_flash.sector_size;
+		s_nLength -= s_flash.sector_size;
+		s_nTimeOut = SPI_FLASH_SECTOR_ERASE_TIMEOUT;
+	} else {
+		const auto chunk_len = min(s_nLength, s_flash.page_size - (s_nOffset % s_flash.page_size));
+
+		cmd[0] = CMD_PAGE_PROGRAM;
+
+		ret = spi_flash_write_common(cmd, sizeof(cmd), s_pBuffer, chunk_len, false);
+
+		s_pBuffer += chunk_len;
+		s_nOffset += static_cast<uint32_t>(chunk_len);
+		s_nLength -= chunk_len;
+		s_nTimeOut = SPI_FLASH_PROG_TIMEOUT;
+	}
+
+	if (ret < 0) {
+		DEBUG_PUTS("write failed");
+		return spi_flash_async_done(ret);
+	}
+
+	s_nTimeBase = get_timer(0);
+	return 1;
+}
+
+static int spi_flash_async_step(spi_flash_async_user& user, uint32_t offset, size_t len, const uint8_t *buf) {
+	using namespace spi_flash_async;
+
+	if (user.state == spi_flash_async_user::State::IDLE) {
+		if (s_State != State::IDLE) {
+			spi_flash_async_run();	// The operation of another user
+			return 1;
+		}
+
+		const auto ret = (buf == nullptr) ? spi_flash_async_erase(offset, len) : spi_flash_async_write(offset, len, buf);
+
+		if (ret < 0) {
+			return ret;
+		}
+
+		s_pUser = &user;
+		user.state = spi_flash_async_user::State::PENDING;
+	}
+
+	if (user.state == spi_flash_async_user::State::PENDING) {
+		spi_flash_async_run();
+
+		if (user.state == spi_flash_async_user::State::PENDING) {
+			return 1;
+		}
+	}
+
+	user.state = spi_flash_async_user::State::IDLE;
+	return user.nResult;
+}
+
+int spi_flash_async_erase_step(spi_flash_async_user& user, uint32_t offset, size_t len) {
+	return spi_flash_async_step(user, offset, len, nullptr);
+}
+
+int spi_flash_async_write_step(spi_flash_async_user& user, uint32_t offset, size_t len, const uint8_t *buf) {
+	return spi_flash_async_step(user, offset, len, buf);
+}
+
 int spi_flash_probe([[maybe_unused]] unsigned int cs, [[maybe_unused]] unsigned int max_hz, [[maybe_unused]] unsigned int spi_mode) {
 	int shift;
 	unsigned i;
@@ -36,6 +36,23 @@ using namespace flashcode;
 
 FlashCode *FlashCode::s_pThis;
 
+/*
+ * The SPI flash state machine is shared with the ConfigStore and the failsafe record.
+ */
+static spi_flash_async_user s_User;
+
+static bool get_result(const int nReturn, flashcode::result& nResult) {
+	if (nReturn > 0) {
+		nResult = result::OK;
+		return false;
+	}
+
+	nResult = (nReturn < 0) ? result::ERROR : result::OK;
+
+	DEBUG_PRINTF("nResult=%d", static_cast<int>(nResult));
+	return true;
+}
+
 FlashCode::FlashCode() {
 	DEBUG_ENTRY
 	assert(s_pThis == nullptr);
@@ -72,9 +89,18 @@ uint32_t FlashCode::GetSectorSize() const {
 	return spi_flash_get_sector_size();
 }
 
+/**
+ * @return false while another user is erasing or programming
+ */
 bool FlashCode::Read(uint32_t nOffset, uint32_t nLength, uint8_t *pBuffer, flashcode::result& nResult) {
 	DEBUG_ENTRY
 
+	if (spi_flash_async_is_busy()) {
+		spi_flash_async_run();
+		DEBUG_EXIT
+		return false;
+	}
+
 	const int nReturn = spi_flash_cmd_read_fast(nOffset, nLength, pBuffer);
 	nResult = (nReturn < 0) ? result::ERROR : result::OK;
 
@@ -84,23 +110,9 @@ bool FlashCode::Read(uint32_t nOffset, uint32_t nLength, uint8_t *pBuffer, flash
 }
 
 bool FlashCode::Erase(uint32_t nOffset, uint32_t nLength, flashcode::result& nResult) {
-	DEBUG_ENTRY
-
-	const auto nReturn = spi_flash_cmd_erase(nOffset, nLength);
-	nResult = (nReturn < 0) ? result::ERROR : result::OK;
-
-	DEBUG_PRINTF("nResult=%d", static_cast<int>(nResult));
-	DEBUG_EXIT
-	return true;
+	return get_result(spi_flash_async_erase_step(s_User, nOffset, nLength), nResult);
 }
 
 bool FlashCode::Write(uint32_t nOffset, uint32_t nLength, const uint8_t *pBuffer, flashcode::result& nResult) {
-	DEBUG_ENTRY
-
-	const auto nReturn = spi_flash_cmd_write_multi(nOffset, nLength, pBuffer);
-	nResult = (nReturn < 0) ? result::ERROR : result::OK;
-
-	DEBUG_PRINTF("nResult=%d", static_cast<int>(nResult));
-	DEBUG_EXIT
-	return true;
+	return get_result(spi_flash_async_write_step(s_User, nOffset, nLength, pBuffer), nResult);
 }
@@ -92,6 +92,13 @@
 
 #include "flashcode.h"
 
+namespace flashcodeinstall {
+enum class State : uint8_t {
+	IDLE, COMPARE, ERASE, WRITE, VERIFY
+};
+static constexpr uint32_t SECTOR_BUFFERS = 3;	///< Header sector + double buffer
+}  // namespace flashcodeinstall
+
 class FlashCodeInstall: FlashCode {
 public:
 	FlashCodeInstall();
@@ -99,6 +106,26 @@ public:
 
 	bool WriteFirmware(const uint8_t *pBuffer, uint32_t nSize);
 
+	/*
+	 * Streaming install. The image is received in chunks, each erase sector is compared
+	 * with the flash contents and only the sectors which differ are erased and programmed.
+	 * Run() handles one step for one sector, and must be called from the main loop while IsBusy().
+	 * The first sector, with the image header, is written last.
+	 * Once a sector has been changed, the old image no longer matches its header
+	 * and does not boot. After an abort or a flash error the firmware must be uploaded again.
+	 */
+	bool FirmwareBegin();
+	bool FirmwareWrite(const uint8_t *pBuffer, uint32_t nLength, uint32_t nOffset);
+	void FirmwareEnd();
+	void FirmwareAbort();
+	void FirmwareDrain();
+
+	void Run();
+
+	bool IsBusy() const {
+		return (m_State != flashcodeinstall::State::IDLE) || (m_nPending != 0);
+	}
+
 	static FlashCodeInstall* Get() {
 		return s_pThis;
 	}
@@ -110,6 +137,8 @@ private:
 	bool Diff(uint32_t nOffset);
 	void Write(uint32_t nOffset);
 	void Process(const char *pFileName, uint32_t nOffset);
+	void SectorQueue(uint32_t nIndex);
+	void SectorDone(bool isError);
 
 private:
 	uint32_t m_nEraseSize { 0 };
@@ -118,6 +147,25 @@ private:
 	uint8_t *m_pFlashBuffer { nullptr };
 	FILE *m_pFile { nullptr };
 
+	struct Sector {
+		uint8_t *pBuffer;
+		uint32_t nOffset;		///< Offset in the image
+	};
+
+	Sector m_Sector[flashcodeinstall::SECTOR_BUFFERS] {};
+	uint8_t *m_pReadBuffer { nullptr };
+	uint32_t m_nSectorSize { 0 };
+	uint32_t m_nReceived { 0 };		///< Image bytes received so far
+	uint32_t m_nSectorsWritten { 0 };
+	uint32_t m_nSectorsSkipped { 0 };
+	uint32_t m_nFill { 0 };			///< Sector buffer being filled
+	uint32_t m_nActive { 0 };		///< Sector buffer being installed
+	uint32_t m_nPending { 0 };		///< Bitmap of sector buffers waiting to be installed
+	flashcodeinstall::State m_State { flashcodeinstall::State::IDLE };
+	bool m_bStreaming { false };
+	bool m_bStreamError { false };
+	bool m_bImageChanged { false };	///< A sector is changed, the header is not yet written
+
 	bool m_bHaveFlashChip { false };
 
 	static FlashCodeInstall *s_pThis;
@@ -23,7 +23,9 @@
  * THE SOFTWARE.
  */
 
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <cassert>
 
 #include "flashcodeinstall.h"
@@ -33,6 +35,8 @@
 
 #include "debug.h"
 
+using namespace flashcodeinstall;
+
 bool FlashCodeInstall::WriteFirmware(const uint8_t *pBuffer, uint32_t nSize) {
 	DEBUG_ENTRY
 
@@ -89,3 +93,313 @@ bool FlashCodeInstall::WriteFirmware(const uint8_t *pBuffer, uint32_t nSize) {
 	DEBUG_EXIT
 	return true;
 }
+
+/*
+ * Streaming install
+ */
+
+bool FlashCodeInstall::FirmwareBegin() {
+	DEBUG_ENTRY
+
+	if (!FlashCode::IsDetected()) {
+		DEBUG_EXIT
+		return false;
+	}
+
+	/*
+	 * A previous install which is still running is abandoned.
+	 * The sector which is being erased or programmed is completed first.
+	 */
+	FirmwareAbort();
+
+	while (m_State != State::IDLE) {
+		Run();
+	}
+
+	if (m_pReadBuffer == nullptr) {
+		m_nSectorSize = FlashCode::GetSectorSize();
+		assert((m_nSectorSize & (m_nSectorSize - 1)) == 0);
+
+		m_pReadBuffer = new uint8_t[m_nSectorSize * (SECTOR_BUFFERS + 1)];
+		assert(m_pReadBuffer != nullptr);
+
+		for (uint32_t i = 0; i < SECTOR_BUFFERS; i++) {
+			m_Sector[i].pBuffer = &m_pReadBuffer[(i + 1) * m_nSectorSize];
+		}
+	}
+
+	m_nReceived = 0;
+	m_nSectorsWritten = 0;
+	m_nSectorsSkipped = 0;
+	m_nFill = 0;
+	m_Sector[0].nOffset = 0;
+	m_bStreaming = true;
+	m_bStreamError = false;
+	m_bImageChanged = false;
+
+	DEBUG_PRINTF("m_nSectorSize=%x", static_cast<unsigned int>(m_nSectorSize));
+	DEBUG_EXIT
+	return true;
+}
+
+/**
+ * @param nOffset offset of pBuffer in the image. Chunks must arrive in order, retransmitted chunks are ignored.
+ * @return false when the chunk does not fit, or when a flash error has occurred.
+ */
+bool FlashCodeInstall::FirmwareWrite(const uint8_t *pBuffer, uint32_t nLength, uint32_t nOffset) {
+	assert(pBuffer != nullptr);
+
+	if (__builtin_expect((!m_bStreaming || m_bStreamError), 0)) {
+		return false;
+	}
+
+	if ((nOffset + nLength) <= m_nReceived) {
+		DEBUG_PRINTF("Duplicate nOffset=%u", static_cast<unsigned int>(nOffset));
+		return true;
+	}
+
+	if (nOffset > m_nReceived) {
+		printf("error: firmware offset %u, expected %u\n", static_cast<unsigned int>(nOffset), static_cast<unsigned int>(m_nReceived));
+		return false;
+	}
+
+	const auto nSkip = m_nReceived - nOffset;
+	pBuffer += nSkip;
+	nLength -= nSkip;
+
+	if (((m_nReceived + nLength) > FIRMWARE_MAX_SIZE) || ((OFFSET_UIMAGE + m_nReceived + nLength) > m_nFlashSize)) {
+		printf("error: firmware size %u > %u\n", static_cast<unsigned int>(m_nReceived + nLength), static_cast<unsigned int>(FIRMWARE_MAX_SIZE));
+		return false;
+	}
+
+	while (nLength != 0) {
+		const auto nSectorOffset = m_nReceived & (m_nSectorSize - 1);
+
+		if ((nSectorOffset == 0) && (m_nReceived != 0)) {
+			m_nFill = (m_nFill % (SECTOR_BUFFERS - 1)) + 1;
+
+			// The network is ahead of the flash
+			while ((m_nPending & (1U << m_nFill)) != 0) {
+				Run();
+			}
+
+			if (m_bStreamError) {
+				return false;
+			}
+
+			m_Sector[m_nFill].nOffset = m_nReceived;
+		}
+
+		const auto nCopy = ((m_nSectorSize - nSectorOffset) < nLength) ? (m_nSectorSize - nSectorOffset) : nLength;
+
+		memcpy(&m_Sector[m_nFill].pBuffer[nSectorOffset], pBuffer, nCopy);
+
+		pBuffer += nCopy;
+		nLength -= nCopy;
+		m_nReceived += nCopy;
+
+		// The header sector is kept until the complete image is received
+		if (((m_nReceived & (m_nSectorSize - 1)) == 0) && (m_nFill != 0)) {
+			SectorQueue(m_nFill);
+		}
+	}
+
+	return true;
+}
+
+void FlashCodeInstall::FirmwareEnd() {
+	DEBUG_ENTRY
+
+	if (!m_bStreaming) {
+		DEBUG_EXIT
+		return;
+	}
+
+	m_bStreaming = false;
+
+	if (m_bStreamError || (m_nReceived == 0)) {
+		DEBUG_EXIT
+		return;
+	}
+
+	const auto nSectorOffset = m_nReceived & (m_nSectorSize - 1);
+
+	if (nSectorOffset != 0) {
+		memset(&m_Sector[m_nFill].pBuffer[nSectorOffset], 0xFF, m_nSectorSize - nSectorOffset);
+
+		if (m_nFill != 0) {
+			SectorQueue(m_nFill);
+		}
+	}
+
+	SectorQueue(0);
+
+	printf("Install firmware: %u bytes\n", static_cast<unsigned int>(m_nReceived));
+	Display::Get()->TextStatus("Install", CONSOLE_GREEN);
+
+	DEBUG_EXIT
+}
+
+void FlashCodeInstall::FirmwareAbort() {
+	DEBUG_ENTRY
+
+	m_bStreaming = false;
+
+	const auto nActive = (m_State != State::IDLE) ? (1U << m_nActive) : 0;
+
+	if ((m_nPending & ~nActive) != 0) {
+		puts("Firmware install aborted");
+	}
+
+	m_nPending &= nActive;
+
+	if (m_bImageChanged) {
+		puts("error: firmware image is incomplete and will not boot, upload the firmware again");
+		Display::Get()->TextStatus("Error: Firmware", CONSOLE_RED);
+	}
+
+	DEBUG_EXIT
+}
+
+/**
+ * Before a reboot. A transfer which is not complete is aborted,
+ * a complete image is installed.
+ */
+void FlashCodeInstall::FirmwareDrain() {
+	DEBUG_ENTRY
+
+	if (m_bStreaming) {
+		FirmwareAbort();
+	}
+
+	while (IsBusy()) {
+		Run();
+	}
+
+	DEBUG_EXIT
+}
+
+void FlashCodeInstall::SectorQueue(uint32_t nIndex) {
+	DEBUG_PRINTF("nIndex=%u, nOffset=%x", static_cast<unsigned int>(nIndex), static_cast<unsigned int>(m_Sector[nIndex].nOffset));
+	assert(nIndex < SECTOR_BUFFERS);
+	m_nPending |= (1U << nIndex);
+}
+
+void FlashCodeInstall::SectorDone(bool isError) {
+	DEBUG_PRINTF("m_nActive=%u, isError=%d", static_cast<unsigned int>(m_nActive), isError);
+
+	m_nPending &= ~(1U << m_nActive);
+	m_State = State::IDLE;
+
+	if (isError) {
+		printf("error: flash sector %x\n", static_cast<unsigned int>(OFFSET_UIMAGE + m_Sector[m_nActive].nOffset));
+		Display::Get()->TextStatus("Error: Firmware", CONSOLE_RED);
+
+		if (m_bImageChanged) {
+			puts("error: firmware image is incomplete and will not boot, upload the firmware again");
+		}
+
+		// Never install the header of an incomplete image
+		m_nPending = 0;
+		m_bStreamError = true;
+		return;
+	}
+
+	if (m_nActive == 0) {
+		m_bImageChanged = false;
+		printf("Firmware installed: %u sectors written, %u unchanged\n", static_cast<unsigned int>(m_nSectorsWritten), static_cast<unsigned int>(m_nSectorsSkipped));
+		Display::Get()->TextStatus("Done", CONSOLE_GREEN);
+	}
+}
+
+/**
+ * Each call handles a single step: select, compare, erase, program or verify.
+ */
+void FlashCodeInstall::Run() {
+	const auto nAddress = OFFSET_UIMAGE + m_Sector[m_nActive].nOffset;
+	flashcode::result nResult;
+
+	switch (m_State) {
+	case State::IDLE: {
+		if (m_nPending == 0) {
+			return;
+		}
+
+		auto nIndex = 0U;
+
+		for (uint32_t i = 1; i < SECTOR_BUFFERS; i++) {
+			if (((m_nPending & (1U << i)) != 0) && ((nIndex == 0) || (m_Sector[i].nOffset < m_Sector[nIndex].nOffset))) {
+				nIndex = i;
+			}
+		}
+
+		if ((nIndex == 0) && ((m_nPending & 1U) == 0)) {
+			return;
+		}
+
+		m_nActive = nIndex;
+		m_State = State::COMPARE;
+	}
+		break;
+	case State::COMPARE:
+		if (!FlashCode::Read(nAddress, m_nSectorSize, m_pReadBuffer, nResult)) {
+			return;
+		}
+
+		if (flashcode::result::ERROR == nResult) {
+			SectorDone(true);
+			return;
+		}
+
+		if (memcmp(m_pReadBuffer, m_Sector[m_nActive].pBuffer, m_nSectorSize) == 0) {
+			m_nSectorsSkipped++;
+			SectorDone(false);
+			return;
+		}
+
+		m_bImageChanged = true;
+		m_State = State::ERASE;
+		break;
+	case State::ERASE:
+		if (!FlashCode::Erase(nAddress, m_nSectorSize, nResult)) {
+			return;
+		}
+
+		if (flashcode::result::ERROR == nResult) {
+			SectorDone(true);
+			return;
+		}
+
+		m_State = State::WRITE;
+		break;
+	case State::WRITE:
+		if (!FlashCode::Write(nAddress, m_nSectorSize, m_Sector[m_nActive].pBuffer, nResult)) {
+			return;
+		}
+
+		if (flashcode::result::ERROR == nResult) {
+			SectorDone(true);
+			return;
+		}
+
+		m_State = State::VERIFY;
+		break;
+	case State::VERIFY:
+		if (!FlashCode::Read(nAddress, m_nSectorSize, m_pReadBuffer, nResult)) {
+			return;
+		}
+
+		if ((flashcode::result::ERROR == nResult) || (memcmp(m_pReadBuffer, m_Sector[m_nActive].pBuffer, m_nSectorSize) != 0)) {
+			SectorDone(true);
+			return;
+		}
+
+		m_nSectorsWritten++;
+		SectorDone(false);
+		break;
+	default:
+		assert(0);
+		__builtin_unreachable();
+		break;
+	}
+}
@@ -55,6 +55,11 @@ FlashCodeInstall::FlashCodeInstall() {
 
 FlashCodeInstall::~FlashCodeInstall() {
 	DEBUG_ENTRY
+
+	if (m_pReadBuffer != nullptr) {
+		delete[] m_pReadBuffer;
+	}
+
 	DEBUG_EXIT
 }
 
@@ -108,6 +108,10 @@ FlashCodeInstall::~FlashCodeInstall() {
 		delete[] m_pFlashBuffer;
 	}
 
+	if (m_pReadBuffer != nullptr) {
+		delete[] m_pReadBuffer;
+	}
+
 	DEBUG_EXIT
 }
 
@@ -214,7 +218,7 @@ bool FlashCodeInstall::Diff(uint32_t nOffset) {
 	}
 
 	flashcode::result result;
-	FlashCode::Read(nOffset, COMPARE_BYTES, m_pFlashBuffer, result);
+	while (!FlashCode::Read(nOffset, COMPARE_BYTES, m_pFlashBuffer, result));
 
 	if (flashcode::result::ERROR == result) {
 		DEBUG_EXIT
@@ -249,7 +253,7 @@ void FlashCodeInstall::Write(uint32_t nOffset) {
 		nTotalBytes += nBytes;
 
 		flashcode::result result;
-		FlashCode::Erase(n_Address, m_nEraseSize, result);
+		while (!FlashCode::Erase(n_Address, m_nEraseSize, result));
 
 		if (flashcode::result::ERROR == result) {
 			puts("error: flash erase");
@@ -262,14 +266,14 @@ void FlashCodeInstall::Write(uint32_t nOffset) {
 			}
 		}
 
-		FlashCode::Write(n_Address, m_nEraseSize, m_pFileBuffer, result);
+		while (!FlashCode::Write(n_Address, m_nEraseSize, m_pFileBuffer, result));
 
 		if (flashcode::result::ERROR == result) {
 			puts("error: flash write");
 			break;
 		}
 
-		FlashCode::Read(n_Address, nBytes, m_pFlashBuffer, result);
+		while (!FlashCode::Read(n_Address, nBytes, m_pFlashBuffer, result));
 
 		if (flashcode::result::ERROR == result) {
 			puts("error: flash read");
@@ -37,57 +37,78 @@ static bool filter(const char *pName) {
 	return *pName == '.';
 }
 
-uint32_t json_get_directory(char *pOutBuffer, const uint32_t nOutBufferSize) {
-	const auto nBufferSize = nOutBufferSize - 2U;
+static DIR *s_pDir;
+static struct dirent *s_pPending;	///< Read, did not fit in the previous part
+
+/**
+ * The directory listing is generated in parts, nCursor is 0 for the first part,
+ * it is 0 again after the last part. The directory stays open in between.
+ */
+uint32_t json_get_directory(uint32_t& nCursor, char *pOutBuffer, const uint32_t nOutBufferSize) {
+	assert(nOutBufferSize > 32);
+	const auto nBufferSize = nOutBufferSize - 2U;	// ']}'
+	uint32_t nLength = 0;
+
+	if (nCursor == 0) {
 #if defined (__linux__) || defined (__APPLE__)
-	auto *dirp = opendir("storage");
+		s_pDir = opendir("storage");
 #elif defined (CONFIG_USB_HOST_MSC)
-	auto *dirp = opendir("0:/");
+		s_pDir = opendir("0:/");
 #else
-	auto *dirp = opendir(".");
+		s_pDir = opendir(".");
 #endif
 #ifndef NDEBUG
-	perror("opendir");
+		perror("opendir");
 #endif
+		s_pPending = nullptr;
+		nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nBufferSize, "{\"label\":\"%s\",\"files\":[", (s_pDir != nullptr) ? "storage" : "No storage"));
+		nCursor = 1;
+	}
 
-	auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nBufferSize, "{\"label\":\"%s\",\"files\":[", (dirp != nullptr) ? "storage" : "No storage"));
+	if (s_pDir != nullptr) {
+		for (;;) {
+			auto *dp = s_pPending;
 
-	if (dirp != nullptr) {
-		struct dirent *dp;
-		do {
-			if ((dp = readdir(dirp)) != nullptr) {
-				if (dp->d_type == DT_DIR) {
-					continue;
+			if (dp == nullptr) {
+				if ((dp = readdir(s_pDir)) == nullptr) {
+					break;
 				}
 
-				if (filter(dp->d_name)) {
+				if ((dp->d_type == DT_DIR) || filter(dp->d_name)) {
 					continue;
 				}
+			}
 
-				const auto nSize = nBufferSize - nLength;
-				const auto nCharacters = static_cast<uint32_t>(snprintf(&pOutBuffer[nLength], nSize, "\"%s\",", dp->d_name));
-
-				if (nCharacters > nSize) {
-					break;
-				}
-
-				nLength+=nCharacters;
+			const auto nSeparator = (nCursor != 1) ? 1U : 0U;
+			const auto nSize = nBufferSize - nLength - nSeparator;
+			const auto nCharacters = static_cast<uint32_t>(snprintf(&pOutBuffer[nLength + nSeparator], nSize, "\"%s\"", dp->d_name));
 
-				if (nLength >= nBufferSize) {
-					break;
+			if (nCharacters >= nSize) {
+				if (nLength != 0) {
+					s_pPending = dp;
+					return nLength;
 				}
+				/* The name does not fit in an empty part */
+				s_pPending = nullptr;
+				continue;
 			}
-		} while (dp != nullptr);
 
-		closedir(dirp);
+			if (nSeparator != 0) {
+				pOutBuffer[nLength] = ',';
+			}
 
-		if (pOutBuffer[nLength - 1] == ',') {
-			nLength--;
+			s_pPending = nullptr;
+			nLength += nSeparator + nCharacters;
+			nCursor++;
 		}
+
+		closedir(s_pDir);
+		s_pDir = nullptr;
 	}
 
 	pOutBuffer[nLength++] = ']';
 	pOutBuffer[nLength++] = '}';
+	nCursor = 0;
 
 	assert(nLength <= nOutBufferSize);
 	return nLength;
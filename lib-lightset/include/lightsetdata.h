@@ -31,6 +31,10 @@
 #include <algorithm>
 #include <cassert>
 
+#if defined (__ARM_NEON)
+# include <arm_neon.h>
+#endif
+
 #include "lightset.h"
 
 #if defined (GD32)
@@ -101,6 +105,24 @@ public:
 		Get().IRestore(nPortIndex, pData);
 	}
 
+	/**
+	 * Slots changed since the data was last handed to the LightSet.
+	 * Valid inside LightSet::SetData, the range is reset afterwards.
+	 * @param nStart first changed slot
+	 * @param nEnd one past the last changed slot
+	 * @return false when nothing has changed
+	 */
+	static bool GetDirtyRange(const uint32_t nPortIndex, uint32_t& nStart, uint32_t& nEnd) {
+		return Get().IGetDirtyRange(nPortIndex, nStart, nEnd);
+	}
+
+	/**
+	 * @return true when pData is the output buffer of the port, GetDirtyRange() then applies to pData
+	 */
+	static bool IsOutput(const uint32_t nPortIndex, const uint8_t *pData) {
+		return (nPortIndex < PORTS) && (pData == Get().m_OutputPort[nPortIndex].data);
+	}
+
 private:
 //	Data() {}
 
@@ -108,54 +130,56 @@ private:
 		assert(nPortIndex < PORTS);
 		assert(pData != nullptr);
 
-		memcpy(m_OutputPort[nPortIndex].sourceA.data, pData, nLength);
+		auto& port = m_OutputPort[nPortIndex];
 
-		m_OutputPort[nPortIndex].nLength = nLength;
+		memcpy(port.sourceA.data, pData, nLength);
+		SetLength(port, nLength);
 
-		if (mergeMode == MergeMode::HTP) {
-			for (uint32_t i = 0; i < nLength; i++) {
-				const auto data = std::max(m_OutputPort[nPortIndex].sourceA.data[i], m_OutputPort[nPortIndex].sourceB.data[i]);
-				m_OutputPort[nPortIndex].data[i] = data;
-			}
+		uint32_t nStart, nEnd;
 
-			return;
+		if (mergeMode == MergeMode::HTP) {
+			merge_htp(port.data, port.sourceA.data, port.sourceB.data, nLength, nStart, nEnd);
+		} else {
+			merge_ltp(port.data, pData, nLength, nStart, nEnd);
 		}
 
-		memcpy(m_OutputPort[nPortIndex].data, pData, nLength);
+		SetDirty(port, nStart, nEnd);
 	}
 
 	void IMergeSourceB(const uint32_t nPortIndex, const uint8_t *pData, const uint32_t nLength, const MergeMode mergeMode) {
 		assert(nPortIndex < PORTS);
 		assert(pData != nullptr);
 
-		memcpy(m_OutputPort[nPortIndex].sourceB.data, pData, nLength);
+		auto& port = m_OutputPort[nPortIndex];
 
-		m_OutputPort[nPortIndex].nLength = nLength;
+		memcpy(port.sourceB.data, pData, nLength);
+		SetLength(port, nLength);
 
-		if (mergeMode == MergeMode::HTP) {
-			for (uint32_t i = 0; i < nLength; i++) {
-				const auto data = std::max(m_OutputPort[nPortIndex].sourceA.data[i], m_OutputPort[nPortIndex].sourceB.data[i]);
-				m_OutputPort[nPortIndex].data[i] = data;
-			}
+		uint32_t nStart, nEnd;
 
-			return;
+		if (mergeMode == MergeMode::HTP) {
+			merge_htp(port.data, port.sourceA.data, port.sourceB.data, nLength, nStart, nEnd);
+		} else {
+			merge_ltp(port.data, pData, nLength, nStart, nEnd);
 		}
 
-		memcpy(m_OutputPort[nPortIndex].data, pData, nLength);
+		SetDirty(port, nStart, nEnd);
 	}
 
-	void ISet(LightSet *const pLightSet, const uint32_t nPortIndex) const {
+	void ISet(LightSet *const pLightSet, const uint32_t nPortIndex) {
 		assert(pLightSet != nullptr);
 		assert(nPortIndex < PORTS);
 
 		pLightSet->SetData(nPortIndex, m_OutputPort[nPortIndex].data, m_OutputPort[nPortIndex].nLength, false);
+		ClearDirty(m_OutputPort[nPortIndex]);
 	}
 
-	void IOutput(LightSet *const pLightSet, const uint32_t nPortIndex) const {
+	void IOutput(LightSet *const pLightSet, const uint32_t nPortIndex) {
 		assert(pLightSet != nullptr);
 		assert(nPortIndex < PORTS);
 
 		pLightSet->SetData(nPortIndex, m_OutputPort[nPortIndex].data, m_OutputPort[nPortIndex].nLength, true);
+		ClearDirty(m_OutputPort[nPortIndex]);
 	}
 
 	void IOutputClear(LightSet *const pLightSet, const uint32_t nPortIndex) {
@@ -164,6 +188,7 @@ private:
 
 		memset(m_OutputPort[nPortIndex].data, 0, dmx::UNIVERSE_SIZE);
 		m_OutputPort[nPortIndex].nLength = dmx::UNIVERSE_SIZE;
+		SetDirty(m_OutputPort[nPortIndex], 0, dmx::UNIVERSE_SIZE);
 		IOutput(pLightSet, nPortIndex);
 	}
 
@@ -187,6 +212,16 @@ private:
 		assert(pData != nullptr);
 
 		memcpy(m_OutputPort[nPortIndex].data, pData, dmx::UNIVERSE_SIZE);
+		SetDirty(m_OutputPort[nPortIndex], 0, dmx::UNIVERSE_SIZE);
+	}
+
+	bool IGetDirtyRange(const uint32_t nPortIndex, uint32_t& nStart, uint32_t& nEnd) const {
+		assert(nPortIndex < PORTS);
+
+		nStart = m_OutputPort[nPortIndex].nDirtyStart;
+		nEnd = m_OutputPort[nPortIndex].nDirtyEnd;
+
+		return nStart < nEnd;
 	}
 
 private:
@@ -209,8 +244,153 @@ private:
 		Source sourceB;
 		uint8_t data[dmx::UNIVERSE_SIZE] __attribute__ ((aligned (4)));
 		uint32_t nLength;
+		uint32_t nDirtyStart;
+		uint32_t nDirtyEnd;
 	};
 
+	static void SetDirty(OutputPort& port, const uint32_t nStart, const uint32_t nEnd) {
+		if (nStart >= nEnd) {
+			return;
+		}
+
+		if (port.nDirtyStart >= port.nDirtyEnd) {
+			port.nDirtyStart = nStart;
+			port.nDirtyEnd = nEnd;
+			return;
+		}
+
+		port.nDirtyStart = std::min(port.nDirtyStart, nStart);
+		port.nDirtyEnd = std::max(port.nDirtyEnd, nEnd);
+	}
+
+	static void ClearDirty(OutputPort& port) {
+		port.nDirtyStart = 0;
+		port.nDirtyEnd = 0;
+	}
+
+	static void SetLength(OutputPort& port, const uint32_t nLength) {
+		if (port.nLength != nLength) {
+			SetDirty(port, std::min(port.nLength, nLength), std::max(port.nLength, nLength));
+			port.nLength = nLength;
+		}
+	}
+
+	/**
+	 * Unsigned maximum of each of the 4 bytes in a word.
+	 */
+	static uint32_t max_u8x4(const uint32_t a, const uint32_t b) {
+		const auto nLow = (a | 0x80808080U) - (b & 0x7F7F7F7FU);	// Bit 7 set where the low 7 bits of a >= b
+		const auto nGreaterEqual = ((a & ~b) | (~(a ^ b) & nLow)) & 0x80808080U;
+		const auto nMask = (nGreaterEqual >> 7) * 0xFFU;
+		return (a & nMask) | (b & ~nMask);
+	}
+
+	/**
+	 * pDst = max(pA, pB), [nStart, nEnd) is the changed part of pDst.
+	 * The NEON kernel reports changes with a 16 slots granularity, the word kernel with 4 slots.
+	 */
+	static void merge_htp(uint8_t *pDst, const uint8_t *pA, const uint8_t *pB, const uint32_t nLength, uint32_t& nStart, uint32_t& nEnd) {
+		nStart = 0;
+		nEnd = 0;
+
+		uint32_t i = 0;
+#if defined (__ARM_NEON)
+		for (; (i + 16) <= nLength; i += 16) {
+			const auto data = vmaxq_u8(vld1q_u8(&pA[i]), vld1q_u8(&pB[i]));
+			const auto diff = veorq_u8(data, vld1q_u8(&pDst[i]));
+
+			vst1q_u8(&pDst[i], data);
+
+			if (vget_lane_u64(vreinterpret_u64_u8(vorr_u8(vget_low_u8(diff), vget_high_u8(diff))), 0) != 0) {
+				if (nEnd == 0) {
+					nStart = i;
+				}
+				nEnd = i + 16;
+			}
+		}
+#else
+		for (; (i + 4) <= nLength; i += 4) {
+			uint32_t a, b, dst;
+			memcpy(&a, &pA[i], 4);
+			memcpy(&b, &pB[i], 4);
+			memcpy(&dst, &pDst[i], 4);
+
+			const auto data = max_u8x4(a, b);
+
+			if (data != dst) {
+				memcpy(&pDst[i], &data, 4);
+				if (nEnd == 0) {
+					nStart = i;
+				}
+				nEnd = i + 4;
+			}
+		}
+#endif
+		for (; i < nLength; i++) {
+			const auto data = std::max(pA[i], pB[i]);
+
+			if (data != pDst[i]) {
+				pDst[i] = data;
+				if (nEnd == 0) {
+					nStart = i;
+				}
+				nEnd = i + 1;
+			}
+		}
+	}
+
+	/**
+	 * pDst = pSrc, only the changed part [nStart, nEnd) is written.
+	 */
+	static void merge_ltp(uint8_t *pDst, const uint8_t *pSrc, const uint32_t nLength, uint32_t& nStart, uint32_t& nEnd) {
+		nStart = 0;
+		nEnd = 0;
+
+		uint32_t i = 0;
+#if defined (__ARM_NEON)
+		for (; (i + 16) <= nLength; i += 16) {
+			const auto data = vld1q_u8(&pSrc[i]);
+			const auto diff = veorq_u8(data, vld1q_u8(&pDst[i]));
+
+			if (vget_lane_u64(vreinterpret_u64_u8(vorr_u8(vget_low_u8(diff), vget_high_u8(diff))), 0) != 0) {
+				vst1q_u8(&pDst[i], data);
+				if (nEnd == 0) {
+					nStart = i;
+				}
+				nEnd = i + 16;
+			}
+		}
+		for (; i < nLength; i++) {
+			if (pSrc[i] != pDst[i]) {
+				pDst[i] = pSrc[i];
+				if (nEnd == 0) {
+					nStart = i;
+				}
+				nEnd = i + 1;
+			}
+		}
+#else
+		while ((i < nLength) && (pSrc[i] == pDst[i])) {
+			i++;
+		}
+
+		if (i == nLength) {
+			return;
+		}
+
+		auto nLast = nLength;
+
+		while (pSrc[nLast - 1] == pDst[nLast - 1]) {
+			nLast--;
+		}
+
+		memcpy(&pDst[i], &pSrc[i], nLast - i);
+
+		nStart = i;
+		nEnd = nLast;
+#endif
+	}
+
 	OutputPort m_OutputPort[PORTS];
 };
 
@@ -0,0 +1,108 @@
+/**
+ * @file lightsetuniverseindex.h
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef LIGHTSETUNIVERSEINDEX_H_
+#define LIGHTSETUNIVERSEINDEX_H_
+
+#include <cstdint>
+#include <cassert>
+
+namespace lightset {
+/**
+ * Maps a universe (Art-Net 15-bit Port-Address or sACN universe) onto
+ * the bitmask of the local output ports using it.
+ * Open addressing with linear probing, load factor <= 0.5.
+ * The index is rebuilt by the owner whenever a port universe or direction changes.
+ */
+template<uint32_t nMaxPorts>
+class UniverseIndex {
+	static_assert(nMaxPorts <= 32, "The port mask is 32 bits wide");
+
+	static constexpr uint32_t table_size(const uint32_t n) {
+		return (n >= (2 * nMaxPorts)) ? n : table_size(n << 1);
+	}
+
+	static constexpr uint32_t SIZE = table_size(4);
+	static constexpr uint32_t MASK = SIZE - 1;
+
+	struct Entry {
+		uint32_t nPortMask;	///< 0 = empty slot
+		uint16_t nUniverse;
+	};
+
+public:
+	UniverseIndex() {
+		Clear();
+	}
+
+	void Clear() {
+		for (auto& entry : m_Table) {
+			entry.nPortMask = 0;
+			entry.nUniverse = 0;
+		}
+	}
+
+	void Add(const uint16_t nUniverse, const uint32_t nPortIndex) {
+		assert(nPortIndex < nMaxPorts);
+
+		for (auto i = hash(nUniverse);; i = (i + 1) & MASK) {
+			auto& entry = m_Table[i];
+
+			if ((entry.nPortMask == 0) || (entry.nUniverse == nUniverse)) {
+				entry.nUniverse = nUniverse;
+				entry.nPortMask |= (1U << nPortIndex);
+				return;
+			}
+		}
+	}
+
+	/**
+	 * @return bitmask of the output ports, 0 when the universe is not ours
+	 */
+	uint32_t Get(const uint16_t nUniverse) const {
+		for (auto i = hash(nUniverse);; i = (i + 1) & MASK) {
+			const auto& entry = m_Table[i];
+
+			if (entry.nPortMask == 0) {
+				return 0;
+			}
+
+			if (entry.nUniverse == nUniverse) {
+				return entry.nPortMask;
+			}
+		}
+	}
+
+private:
+	static uint32_t hash(const uint16_t nUniverse) {
+		return (static_cast<uint32_t>(nUniverse) * 0x9E37U >> 8) & MASK;
+	}
+
+private:
+	Entry m_Table[SIZE];
+};
+}  // namespace lightset
+
+#endif /* LIGHTSETUNIVERSEINDEX_H_ */
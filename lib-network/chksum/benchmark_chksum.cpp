@@ -0,0 +1,94 @@
+#include <cstdlib>
+#include <cstdint>
+#include <cstdio>
+#include <chrono>
+
+#include "net_private.h"
+
+/*
+ * Compares net_chksum() with the previous halfword loop. The results are
+ * checked for all lengths up to a full frame, at both halfword aligned
+ * offsets, before timing typical IPv4 header, Art-Net and full frame sizes.
+ */
+
+static uint16_t chksum_halfword(const void *data, uint32_t len) {
+	auto *ptr = reinterpret_cast<const uint16_t *>(data);
+	uint32_t sum = 0;
+
+	while (len > 1) {
+		sum += *ptr;
+		ptr++;
+		len -= 2;
+	}
+
+	/* Add left-over byte, if any */
+	if (len > 0) {
+		sum += __builtin_bswap16(static_cast<uint16_t>(*(reinterpret_cast<const uint8_t *>(ptr)) << 8));
+	}
+
+	/* Fold 32-bit sum into 16 bits */
+	while (sum >> 16) {
+		sum = (sum >> 16) + (sum & 0xFFFF);
+	}
+
+	return static_cast<uint16_t>(~sum);
+}
+
+static constexpr uint32_t BUFFER_SIZE = 1536;
+static constexpr uint32_t ROUNDS = 1000000;
+static constexpr uint32_t LENGTHS[] = { 20, 64, 572, 1472 };
+
+alignas(4) static uint8_t s_Buffer[BUFFER_SIZE + 4];
+
+template<bool isNew>
+static uint16_t chksum(const void *pData, uint32_t nLength) {
+	return isNew ? net::net_chksum(pData, nLength) : chksum_halfword(pData, nLength);
+}
+
+template<bool isNew>
+static double benchmark(const uint32_t nOffset, const uint32_t nLength, uint32_t& nCheck) {
+	const auto start = std::chrono::steady_clock::now();
+
+	for (uint32_t nRound = 0; nRound < ROUNDS; nRound++) {
+		nCheck += chksum<isNew>(&s_Buffer[nOffset], nLength);
+		__asm__ __volatile__("" ::: "memory");
+	}
+
+	const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+	return elapsed.count() / static_cast<double>(ROUNDS);
+}
+
+int main() {
+	srand(1);
+
+	for (auto& b : s_Buffer) {
+		b = static_cast<uint8_t>(rand());
+	}
+
+	for (uint32_t nOffset = 0; nOffset <= 2; nOffset += 2) {
+		for (uint32_t nLength = 0; nLength <= BUFFER_SIZE; nLength++) {
+			const auto nOld = chksum_halfword(&s_Buffer[nOffset], nLength);
+			const auto nNew = net::net_chksum(&s_Buffer[nOffset], nLength);
+			if (nOld != nNew) {
+				fprintf(stderr, "Mismatch offset %u length %u: %04x != %04x\n", nOffset, nLength, nOld, nNew);
+				return EXIT_FAILURE;
+			}
+		}
+	}
+
+	printf("%u rounds, ns/call\n", ROUNDS);
+	printf("length offset  halfword     word\n");
+
+	uint32_t nCheckOld = 0;
+	uint32_t nCheckNew = 0;
+
+	for (const auto nLength : LENGTHS) {
+		for (uint32_t nOffset = 0; nOffset <= 2; nOffset += 2) {
+			const auto nOld = benchmark<false>(nOffset, nLength, nCheckOld);
+			const auto nNew = benchmark<true>(nOffset, nLength, nCheckNew);
+			printf("%6u %6u %9.1f %8.1f\n", nLength, nOffset, nOld, nNew);
+		}
+	}
+
+	return (nCheckOld == nCheckNew) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -28,9 +28,17 @@
 
 #if defined(__linux__) || defined (__APPLE__)
 # define UDP_MAX_PORTS_ALLOWED			16
+# define UDP_RX_QUEUE_ENTRIES			96
+# define UDP_RX_QUEUE_DEPTH_DEFAULT		2
+# define UDP_RX_QUEUE_DEPTH_PORTS		{ { 6454, 32 }, { 5568, 32 }, { TFTP_TRANSFER_PORT, 16 } }	/* Art-Net, sACN E1.31, TFTP */
+# define NET_RX_BATCH_MAX				16
 # define IGMP_MAX_JOINS_ALLOWED			(4 + (8 * 4)) /* 8 outputs x 4 Universes */
 # define TCP_MAX_TCBS_ALLOWED			16
 # define TCP_MAX_PORTS_ALLOWED			2
+# define TCP_TX_QUEUE_ENTRIES			32
+# define ARP_MAX_RECORDS				128
+# define ARP_PENDING_ENTRIES			16
+# define ARP_PENDING_PER_RECORD			4
 #else
 # define TCP_MAX_PORTS_ALLOWED			1
 # if defined (H3)
@@ -38,8 +46,23 @@
 #   define HOST_NAME_PREFIX				"allwinner_"
 #  endif
 #  define UDP_MAX_PORTS_ALLOWED			16
+#  define UDP_RX_QUEUE_ENTRIES			96
+#  define UDP_RX_QUEUE_DEPTH_DEFAULT	2
+#  define UDP_RX_QUEUE_DEPTH_PORTS		{ { 6454, 32 }, { 5568, 32 }, { TFTP_TRANSFER_PORT, 16 } }	/* Art-Net, sACN E1.31, TFTP */
+/*
+ * The UDP receive ring has a copy of the datagram, the EMAC RX buffer is given back to the DMA at once.
+ * With UDP_RX_ZERO_COPY (opt-in) the ring refers to the EMAC RX buffer instead.
+ * The RX buffers are in the coherent region, which is mapped Strongly-ordered:
+ * every access is an uncached bus read and an unaligned load faults.
+ * Only define it when all the UDP parsers do aligned accesses.
+ */
+#  define NET_RX_BATCH_MAX				16
 #  define IGMP_MAX_JOINS_ALLOWED		(4 + (8 * 4)) /* 8 outputs x 4 Universes */
 #  define TCP_MAX_TCBS_ALLOWED			16
+#  define TCP_TX_QUEUE_ENTRIES			32
+#  define ARP_MAX_RECORDS				128
+#  define ARP_PENDING_ENTRIES			16
+#  define ARP_PENDING_PER_RECORD		4
 # elif defined (GD32)
 /*
  * Supports checking IPv4 header checksum and TCP, UDP, or ICMP checksum encapsulated in IPv4 or IPv6 datagram.
@@ -51,12 +74,36 @@
 #  if !defined (UDP_MAX_PORTS_ALLOWED)
 #   define UDP_MAX_PORTS_ALLOWED		8
 #  endif
+#  if !defined (UDP_RX_QUEUE_ENTRIES)
+#   define UDP_RX_QUEUE_ENTRIES			(UDP_MAX_PORTS_ALLOWED + 6)
+#  endif
+#  if !defined (UDP_RX_QUEUE_DEPTH_DEFAULT)
+#   define UDP_RX_QUEUE_DEPTH_DEFAULT	1
+#  endif
+#  if !defined (UDP_RX_QUEUE_DEPTH_PORTS)
+#   define UDP_RX_QUEUE_DEPTH_PORTS		{ { 6454, 4 }, { 5568, 4 }, { TFTP_TRANSFER_PORT, 4 } }	/* Art-Net, sACN E1.31, TFTP */
+#  endif
+#  if !defined (NET_RX_BATCH_MAX)
+#   define NET_RX_BATCH_MAX				4
+#  endif
 #  if !defined (IGMP_MAX_JOINS_ALLOWED)
 #   define IGMP_MAX_JOINS_ALLOWED		(4 + (8 * 4)) /* 8 outputs x 4 Universes */
 #  endif
 #  if !defined (TCP_MAX_TCBS_ALLOWED)
 #   define TCP_MAX_TCBS_ALLOWED			6
 #  endif
+#  if !defined (TCP_TX_QUEUE_ENTRIES)
+#   define TCP_TX_QUEUE_ENTRIES			4
+#  endif
+#  if !defined (ARP_MAX_RECORDS)
+#   define ARP_MAX_RECORDS				32
+#  endif
+#  if !defined (ARP_PENDING_ENTRIES)
+#   define ARP_PENDING_ENTRIES			4
+#  endif
+#  if !defined (ARP_PENDING_PER_RECORD)
+#   define ARP_PENDING_PER_RECORD		2
+#  endif
 # else
 #  error
 # endif
@@ -66,6 +113,37 @@
 # error
 #endif
 
+/*
+ * Each bound UDP port has a receive ring, the depth is a power of 2.
+ * The rings are taken from a pool of UDP_RX_QUEUE_ENTRIES datagram buffers.
+ * Ports listed in UDP_RX_QUEUE_DEPTH_PORTS { port, depth } get a deeper ring,
+ * all other ports get UDP_RX_QUEUE_DEPTH_DEFAULT.
+ */
+
+/*
+ * The TFTP server moves a transfer from port 69 to this local port (the server TID).
+ * A window of data blocks arrives as a burst, the depth of this port limits the window size.
+ */
+#if !defined (TFTP_TRANSFER_PORT)
+# define TFTP_TRANSFER_PORT				6969
+#endif
+
+#if !defined (UDP_RX_QUEUE_ENTRIES) || !defined (UDP_RX_QUEUE_DEPTH_DEFAULT) || !defined (UDP_RX_QUEUE_DEPTH_PORTS)
+# error
+#endif
+
+#if (UDP_RX_QUEUE_ENTRIES < UDP_MAX_PORTS_ALLOWED)
+# error UDP_RX_QUEUE_ENTRIES must be at least UDP_MAX_PORTS_ALLOWED
+#endif
+
+/*
+ * Maximum number of Ethernet frames handled by a single net_handle() call.
+ */
+
+#if !defined (NET_RX_BATCH_MAX) || (NET_RX_BATCH_MAX < 1)
+# error
+#endif
+
 #if !defined (IGMP_MAX_JOINS_ALLOWED)
 # error
 #endif
@@ -78,4 +156,35 @@
 # error
 #endif
 
+/*
+ * Segments sent and not acknowledged yet, or waiting for the send window,
+ * are kept in a pool of TCP_TX_QUEUE_ENTRIES segments shared by all connections.
+ */
+
+#if !defined (TCP_TX_QUEUE_ENTRIES) || (TCP_TX_QUEUE_ENTRIES < 1) || (TCP_TX_QUEUE_ENTRIES > 255)
+# error
+#endif
+
+/*
+ * The ARP cache is a hash table of ARP_MAX_RECORDS records, a power of 2.
+ * At most 3/4 of the records are used.
+ */
+
+#if !defined (ARP_MAX_RECORDS) || (ARP_MAX_RECORDS < 4) || ((ARP_MAX_RECORDS & (ARP_MAX_RECORDS - 1)) != 0)
+# error
+#endif
+
+/*
+ * Frames waiting for an ARP reply are kept in a pool of ARP_PENDING_ENTRIES frames
+ * shared by all destinations, with at most ARP_PENDING_PER_RECORD frames for a single destination.
+ */
+
+#if !defined (ARP_PENDING_ENTRIES) || (ARP_PENDING_ENTRIES < 1) || (ARP_PENDING_ENTRIES > 255)
+# error
+#endif
+
+#if !defined (ARP_PENDING_PER_RECORD) || (ARP_PENDING_PER_RECORD < 1) || (ARP_PENDING_PER_RECORD > ARP_PENDING_ENTRIES)
+# error
+#endif
+
 #endif /* NET_CONFIG_H_ */
@@ -28,6 +28,19 @@
 
 #include <cstdint>
 
+namespace net {
+namespace emac {
+struct Stats {
+	uint32_t nRxPendingHighWater;	///< Maximum number of frames waiting in the RX descriptor ring
+	uint32_t nRxBufferUnavailable;	///< The RX descriptor ring was full, frames are dropped
+	uint32_t nRxOverflow;			///< The RX FIFO did overflow, frames are dropped
+	uint32_t nTxRingFull;			///< No free TX descriptor, the sender had to wait
+	uint32_t nTxDropped;			///< No TX descriptor became free in time, frames are dropped
+	uint32_t nTxBatchHighWater;		///< Maximum number of frames started with a single doorbell
+};
+}  // namespace emac
+}  // namespace net
+
 /** \defgroup platform Platform implementation
   @{
 */
@@ -51,6 +64,29 @@ void emac_config();
  *
  */
 void emac_start(uint8_t macAddress[], net::Link& link);
+
+/**
+ * Sample the RX descriptor ring fill level and the RX error status,
+ * called once for each \ref net::net_handle
+ */
+void emac_rx_stats_update();
+void emac_get_stats(net::emac::Stats& stats);
+
+/**
+ * TX descriptor ring
+ * - \ref emac_eth_tx_reserve returns the buffer of the next free descriptor,
+ *   the frame is built in place. nullptr when the ring is full, the caller
+ *   then falls back to \ref emac_eth_send, which counts nTxRingFull once.
+ * - \ref emac_eth_tx_commit hands the reserved descriptor to the DMA
+ * - The DMA is started once for all frames committed between
+ *   \ref emac_eth_tx_batch_begin and \ref emac_eth_tx_batch_end,
+ *   outside a batch each commit starts the DMA.
+ */
+uint8_t *emac_eth_tx_reserve();
+void emac_eth_tx_commit(uint32_t nLength);
+void emac_eth_tx_flush();
+void emac_eth_tx_batch_begin();
+void emac_eth_tx_batch_end();
 /** @} */
 
 #endif /* EMAC_EMAC_H_ */
@@ -52,7 +52,9 @@ void ptp_run();
 #include "netif.h"
 #include "ip4_address.h"
 #include "net/dhcp.h"
+#include "net/tcp.h"
 
+#include "emac/emac.h"
 #include "emac/net_link_check.h"
 
 #define HAVE_NET_HANDLE
@@ -206,10 +208,40 @@ public:
 		}
 	}
 
+	/**
+	 * Build the datagram in place in the TX buffer, see \ref net::udp_send_reserve.
+	 * nullptr when this is not possible, use SendTo() instead.
+	 */
+	uint8_t *SendToReserve(int32_t nHandle, uint32_t nToIp, uint16_t nRemotePort) {
+		if (__builtin_expect((GetIp() != 0), 1)) {
+			return net::udp_send_reserve(nHandle, nToIp, nRemotePort);
+		}
+		return nullptr;
+	}
+
+	void SendToCopy(uint8_t *pDestination, const void *pSource, uint32_t nLength) {
+		net::udp_copy_payload(pDestination, reinterpret_cast<const uint8_t *>(pSource), nLength);
+	}
+
+	void SendToCommit(uint32_t nLength) {
+		net::udp_send_commit(nLength);
+	}
+
 	void SendToTimestamp(int32_t nHandle, const void *pBuffer, uint32_t nLength, uint32_t to_ip, uint16_t remote_port) {
 		net::udp_send_timestamp(nHandle, reinterpret_cast<const uint8_t *>(pBuffer), nLength, to_ip, remote_port);
 	}
 
+	/**
+	 * The frames sent between TxBatchBegin() and TxBatchEnd() are started with a single doorbell
+	 */
+	void TxBatchBegin() {
+		emac_eth_tx_batch_begin();
+	}
+
+	void TxBatchEnd() {
+		emac_eth_tx_batch_end();
+	}
+
 	/*
 	 * TCP/IP
 	 */
@@ -224,8 +256,19 @@ public:
 		return net::tcp_read(nHandleListen, ppBuffer, HandleConnection);
 	}
 
-	void TcpWrite(const int32_t nHandleListen, const uint8_t *pBuffer, uint32_t nLength, const uint32_t HandleConnection) {
-		net::tcp_write(nHandleListen, pBuffer, nLength, HandleConnection);
+	/**
+	 * @return the number of bytes queued, less than nLength when the transmit queue is full
+	 */
+	uint32_t TcpWrite(const int32_t nHandleListen, const uint8_t *pBuffer, uint32_t nLength, const uint32_t HandleConnection) {
+		return net::tcp_write(nHandleListen, pBuffer, nLength, HandleConnection);
+	}
+
+	void TcpClose(const int32_t nHandleListen, const uint32_t HandleConnection) {
+		net::tcp_close(nHandleListen, HandleConnection);
+	}
+
+	void TcpGetConnection(const int32_t nHandleListen, const uint32_t HandleConnection, net::tcp::Connection& connection) {
+		net::tcp_get_connection(nHandleListen, HandleConnection, connection);
 	}
 
 	/*
@@ -93,6 +93,22 @@ public:
 	uint32_t RecvFrom(int32_t nHandle, const void **ppBuffer, uint32_t *pFromIp, uint16_t *pFromPort);
 	void SendTo(int32_t nHandle, const void *pBuffer, uint32_t nLength, uint32_t nToIp, uint16_t nRemotePort) ;
 
+	uint8_t *SendToReserve([[maybe_unused]] int32_t nHandle, [[maybe_unused]] uint32_t nToIp, [[maybe_unused]] uint16_t nRemotePort) {
+		return nullptr;
+	}
+
+	void SendToCopy([[maybe_unused]] uint8_t *pDestination, [[maybe_unused]] const void *pSource, [[maybe_unused]] uint32_t nLength) {
+	}
+
+	void SendToCommit([[maybe_unused]] uint32_t nLength) {
+	}
+
+	void TxBatchBegin() {
+	}
+
+	void TxBatchEnd() {
+	}
+
 	void Print() {
 	}
 
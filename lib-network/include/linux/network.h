@@ -36,6 +36,7 @@
 #include <net/if.h>
 
 #include "networkparams.h"
+#include "net/tcp.h"
 
 class Network {
 public:
@@ -58,6 +59,22 @@ public:
 	uint32_t RecvFrom(int32_t nHandle, const void **ppBuffer, uint32_t *pFromIp, uint16_t *pFromPort);
 	void SendTo(int32_t nHandle, const void *pBuffer, uint32_t nLength, uint32_t nToIp, uint16_t nRemotePort);
 
+	uint8_t *SendToReserve([[maybe_unused]] int32_t nHandle, [[maybe_unused]] uint32_t nToIp, [[maybe_unused]] uint16_t nRemotePort) {
+		return nullptr;
+	}
+
+	void SendToCopy([[maybe_unused]] uint8_t *pDestination, [[maybe_unused]] const void *pSource, [[maybe_unused]] uint32_t nLength) {
+	}
+
+	void SendToCommit([[maybe_unused]] uint32_t nLength) {
+	}
+
+	void TxBatchBegin() {
+	}
+
+	void TxBatchEnd() {
+	}
+
 	void SetIp(uint32_t nIp);
 	void SetNetmask(uint32_t nNetmask);
 	void SetGatewayIp(uint32_t nGatewayIp);
@@ -212,7 +229,9 @@ public:
 
 	int32_t TcpBegin(uint16_t nLocalPort);
 	uint16_t TcpRead(const int32_t nHandle, const uint8_t **ppBuffer, uint32_t &HandleConnection);
-	void TcpWrite(const int32_t nHandle, const uint8_t *pBuffer, uint32_t nLength, const uint32_t HandleConnection);
+	uint32_t TcpWrite(const int32_t nHandle, const uint8_t *pBuffer, uint32_t nLength, const uint32_t HandleConnection);
+	void TcpClose(const int32_t nHandle, const uint32_t HandleConnection);
+	void TcpGetConnection(const int32_t nHandle, const uint32_t HandleConnection, net::tcp::Connection& connection);
 	int32_t TcpEnd(const int32_t nHandle);
 
 private:
@@ -45,10 +45,18 @@ void igmp_shutdown();
 }
 
 namespace net {
+namespace rx {
+struct Stats {
+	uint32_t nBatchHighWater;	///< Maximum number of frames handled by a single net_handle()
+	uint32_t nBudgetExhausted;	///< net_handle() stopped at NET_RX_BATCH_MAX frames
+};
+}  // namespace rx
+
 void net_init(net::Link link, ip4_addr_t ipaddr, ip4_addr_t netmask, ip4_addr_t gw, bool &bUseDhcp);
 void net_set_primary_ip(const ip4_addr_t ipaddr);
 void net_set_secondary_ip();
 void net_handle();
+void net_get_rx_stats(net::rx::Stats& stats);
 
 inline void net_link_down() {
 	network::mdns_shutdown();
@@ -65,13 +73,25 @@ uint32_t udp_recv1(int, uint8_t *, uint32_t, uint32_t *, uint16_t *);
 uint32_t udp_recv2(int, const uint8_t **, uint32_t *, uint16_t *);
 void udp_send(int, const uint8_t *, uint32_t, uint32_t, uint16_t);
 void udp_send_timestamp(int, const uint8_t *, uint32_t, uint32_t, uint16_t);
+/**
+ * Build the datagram in place in the EMAC TX buffer, the headers come from a template.
+ * \ref udp_send_reserve returns nullptr when the destination MAC address is not known
+ * or no TX buffer is available, use \ref udp_send instead.
+ * The TX buffer is strongly-ordered memory on H3, only aligned accesses.
+ */
+uint8_t *udp_send_reserve(int, uint32_t, uint16_t);
+void udp_send_commit(uint32_t);
+/**
+ * Copy into a reserved TX buffer with aligned stores only, any alignment of source and destination
+ */
+void udp_copy_payload(uint8_t *, const uint8_t *, uint32_t);
 
 void igmp_join(uint32_t);
 void igmp_leave(uint32_t);
 
 int tcp_begin(const uint16_t);
 uint16_t tcp_read(const int32_t, const uint8_t **, uint32_t &);
-void tcp_write(const int32_t, const uint8_t *, uint32_t, const uint32_t);
+uint32_t tcp_write(const int32_t, const uint8_t *, uint32_t, const uint32_t);
 
 /**
  * Must be provided by the application
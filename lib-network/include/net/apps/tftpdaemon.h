@@ -33,6 +33,17 @@ namespace tftp {
 enum class Mode {
 	BINARY, ASCII
 };
+
+struct Stats {
+	uint32_t nTransfers;		///< Completed transfers
+	uint32_t nBytes;			///< Bytes transferred by the last completed transfer
+	uint32_t nMillis;			///< Duration of the last completed transfer
+	uint32_t nBlocks;			///< Data blocks sent or received in sequence
+	uint32_t nRetransmits;		///< Data blocks sent again after an ACK for an earlier block, or a timeout
+	uint32_t nOutOfOrder;		///< Data blocks received out of sequence, including duplicates
+	uint16_t nBlockSize;		///< Negotiated for the last transfer
+	uint16_t nWindowSize;		///< Negotiated for the last transfer
+};
 }  // namespace tftp
 
 class TFTPDaemon {
@@ -50,13 +61,30 @@ public:
 
 	virtual void Exit()=0;
 
+	static const tftp::Stats& GetStats() {
+		return s_Stats;
+	}
+
+protected:
+	/**
+	 * Data block size negotiated with the blksize option, 512 by default.
+	 * All blocks, except the last one, have this size.
+	 */
+	uint32_t GetBlockSize() const {
+		return m_nBlockSize;
+	}
+
 private:
 	void HandleRequest();
+	void HandleOptions(const char *pOption, const uint16_t nOpCode);
 	void HandleRecvAck();
+	void HandleTimeout();
 	void HandleRecvData();
 	void SendError (const uint16_t nsErrorCode, const char *pErrorMessage);
+	void SendOptionAck();
 	void DoRead();
 	void DoWriteAck();
+	void TransferDone();
 
 private:
 	enum class TFTPState {
@@ -73,10 +101,20 @@ private:
 	uint32_t m_nFromIp { 0 };
 	uint32_t m_nLength { 0 };
 	uint32_t m_nDataLength { 0 };
-	uint32_t m_nPacketLength { 0 };
+	uint32_t m_nBlockSize { 512 };
+	uint32_t m_nBytes { 0 };
+	uint32_t m_nMillisStart { 0 };
+	uint32_t m_nMillisSent { 0 };		///< RRQ: last DATA or OACK sent
 	uint16_t m_nFromPort { 0 };
-	uint16_t m_nBlockNumber { 0 };
+	uint16_t m_nLocalPort { 0 };		///< tftp::UDP_PORT, or tftp::TRANSFER_PORT during a transfer
+	uint16_t m_nBlockNumber { 0 };		///< Last block acknowledged
+	uint16_t m_nBlockSent { 0 };		///< RRQ: last block sent
+	uint16_t m_nWindowSize { 1 };
+	uint16_t m_nWindowCount { 0 };		///< WRQ: blocks received since the last ACK
+	uint8_t m_nOptions { 0 };			///< Options accepted for the OACK
+	uint8_t m_nRetries { 0 };			///< RRQ: timeouts without progress
 	bool m_bIsLastBlock { false };
+	bool m_bIsOutOfOrderAcked { false };
 
 	static TFTPDaemon* Get() {
 		return s_pThis;
@@ -84,6 +122,7 @@ private:
 
 private:
 	static TFTPDaemon *s_pThis;
+	static tftp::Stats s_Stats;
 };
 
 #endif /* NET_APPS_TFTPDAEMON_H_ */
@@ -36,6 +36,17 @@ namespace arp {
 enum class Flags {
 	FLAG_INSERT, FLAG_UPDATE
 };
+
+struct Stats {
+	uint32_t nHits;				///< Destination MAC address found in the cache
+	uint32_t nMisses;			///< Not in the cache or not resolved yet
+	uint32_t nRefreshes;		///< Unicast requests sent before a used REACHABLE record expires
+	uint32_t nEvictions;		///< Records removed for a new destination, the cache was full
+	uint32_t nPendingQueued;	///< Frames queued while waiting for the ARP reply
+	uint32_t nPendingSent;		///< Queued frames sent after the ARP reply
+	uint32_t nPendingDropped;	///< Queued frames dropped: queue full, pool empty or no ARP reply
+	uint32_t nPoolEmpty;		///< No free frame in the pool
+};
 }  // namespace arp
 
 void arp_init();
@@ -44,6 +55,8 @@ void arp_send(struct t_udp *, const uint32_t, const uint32_t);
 #if defined CONFIG_ENET_ENABLE_PTP
 void arp_send_timestamp(struct t_udp *, const uint32_t, const uint32_t);
 #endif
+const uint8_t *arp_cache_lookup(const uint32_t);
+void arp_get_stats(arp::Stats& stats);
 void arp_acd_probe(const ip4_addr_t ipaddr);
 void arp_acd_send_announcement(const ip4_addr_t ipaddr);
 }  // namespace net
@@ -0,0 +1,54 @@
+/**
+ * @file tcp.h
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef NET_TCP_H_
+#define NET_TCP_H_
+
+#include <cstdint>
+
+namespace net {
+namespace tcp {
+struct Stats {
+	uint32_t nSegmentsSent;		///< Data segments sent for the first time
+	uint32_t nRetransmits;		///< Segments sent again after a retransmission timeout, and for the partial ACKs after it
+	uint32_t nFastRetransmits;	///< Segments sent again after three duplicate ACKs
+	uint32_t nQueueFull;		///< tcp_write() returned a short count, no free segment
+	uint32_t nAborted;			///< Connections reset, too many retransmissions or window probes
+};
+
+struct Connection {
+	uint32_t nId;			///< Different for each connection using the same handle
+	uint32_t nIdleMillis;	///< Since the last segment was received
+	bool isEstablished;		///< Data can be sent, not closing
+	bool isWritable;		///< tcp_write() still queues data, also while closing
+};
+}  // namespace tcp
+
+void tcp_close(const int32_t nHandleListen, const uint32_t nHandleConnection);
+void tcp_get_connection(const int32_t nHandleListen, const uint32_t nHandleConnection, tcp::Connection& connection);
+void tcp_get_stats(tcp::Stats& stats);
+}  // namespace net
+
+#endif /* NET_TCP_H_ */
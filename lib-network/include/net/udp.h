@@ -0,0 +1,49 @@
+/**
+ * @file udp.h
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef NET_UDP_H_
+#define NET_UDP_H_
+
+#include <cstdint>
+
+namespace net {
+namespace udp {
+struct Stats {
+	uint32_t nReceived;		///< Datagrams queued
+	uint32_t nOverrun;		///< Datagrams dropped, the receive ring was full
+	uint16_t nPort;
+	uint16_t nDepth;
+	uint16_t nHighWater;	///< Maximum number of datagrams waiting in the ring
+};
+}  // namespace udp
+
+/**
+ * @return false when nIndex is not a bound port
+ */
+bool udp_get_stats(const uint32_t nIndex, udp::Stats& stats);
+uint32_t udp_get_stats_no_port();
+}  // namespace net
+
+#endif /* NET_UDP_H_ */
@@ -63,7 +63,7 @@ int emac_eth_recv(uint8_t **ppPacket) {
 		return nLength;
 	}
 
-	return -1;
+	return 0;
 }
 
 #if defined (CONFIG_ENET_ENABLE_PTP)
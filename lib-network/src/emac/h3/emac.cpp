@@ -86,6 +86,10 @@ void emac_adjust_link(const net::PhyStatus phyStatus) {
 	DEBUG_EXIT
 }
 
+#if defined (UDP_RX_ZERO_COPY)
+extern void emac_rx_spare_init();
+#endif
+
 static void _rx_descs_init() {
 	struct emac_dma_desc *desc_table_p = &p_coherent_region->rx_chain[0];
 	char *rxbuffs = &p_coherent_region->rxbuffer[0];
@@ -105,6 +109,10 @@ static void _rx_descs_init() {
 
 	H3_EMAC->RX_DMA_DESC = (uintptr_t)&desc_table_p[0];
 	p_coherent_region->rx_currdescnum = 0;
+
+#if defined (UDP_RX_ZERO_COPY)
+	emac_rx_spare_init();
+#endif
 }
 
 static void _tx_descs_init() {
@@ -117,7 +125,8 @@ static void _tx_descs_init() {
 		desc_p = &desc_table_p[idx];
 		desc_p->buf_addr = (uintptr_t) &txbuffs[idx * CONFIG_ETH_BUFSIZE];
 		desc_p->next = (uintptr_t) &desc_table_p[idx + 1];
-		desc_p->status = (1U << 31);
+		/* Owned by the CPU, the DMA sets the own bit back to 0 when the frame is sent */
+		desc_p->status = 0;
 		desc_p->st = 0;
 	}
 
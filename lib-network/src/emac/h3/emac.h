@@ -26,6 +26,8 @@
 #ifndef EMAC_H_
 #define EMAC_H_
 
+#include "../../../config/net_config.h"
+
 #define BUS_SOFT_RESET2_EPHY_RST 	(1 << 2)
 #define BUS_CLK_GATING4_EPHY_GATING	(1 << 0)
 
@@ -41,6 +43,9 @@
 #define RX_CTL0_RX_EN				(1U << 31)
 #define RX_CTL1_RX_DMA_EN			(1 << 30)
 
+#define INT_STA_RX_BUF_UA			(1U << 9)
+#define INT_STA_RX_OVERFLOW			(1U << 12)
+
 #define RX_FRM_FLT_RX_ALL_MULTICAST	(1 << 16)
 
 #define PHY_ADDR		1
@@ -56,9 +61,21 @@
  * using 2048 cause strange behaviors and even BSP driver use 2047
  */
 #define CONFIG_ETH_RXSIZE	2044 /* Note must fit in ETH_BUFSIZE */
+/*
+ * Maximum number of RX buffers which can be loaned to the UDP layer.
+ * A loaned buffer is replaced in its descriptor by a spare buffer,
+ * so the descriptor is given back to the DMA straight away.
+ */
+#define CONFIG_RX_LOANS_MAX	(CONFIG_RX_DESCR_NUM / 2)
+/*
+ * Maximum time in microseconds emac_eth_send() waits for the DMA to give
+ * a TX descriptor back. A full size frame at 10Mbit takes about 1.2ms.
+ */
+#define CONFIG_TX_TIMEOUT	2000
 
 #define TX_TOTAL_BUFSIZE	(CONFIG_ETH_BUFSIZE * CONFIG_TX_DESCR_NUM)
 #define RX_TOTAL_BUFSIZE	(CONFIG_ETH_BUFSIZE * CONFIG_RX_DESCR_NUM)
+#define RX_SPARE_BUFSIZE	(CONFIG_ETH_BUFSIZE * CONFIG_RX_LOANS_MAX)
 
 #define __aligned(x)            __attribute__((aligned(x)))
 
@@ -74,6 +91,9 @@ struct coherent_region {
 	struct emac_dma_desc tx_chain[CONFIG_RX_DESCR_NUM];
 	char rxbuffer[RX_TOTAL_BUFSIZE] __aligned(ARM_DMA_ALIGN);
 	char txbuffer[TX_TOTAL_BUFSIZE] __aligned(ARM_DMA_ALIGN);
+#if defined (UDP_RX_ZERO_COPY)
+	char rxspare[RX_SPARE_BUFSIZE] __aligned(ARM_DMA_ALIGN);
+#endif
 	uint32_t rx_currdescnum;
 	uint32_t tx_currdescnum;
 };
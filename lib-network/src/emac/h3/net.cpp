@@ -24,14 +24,40 @@
  */
 
 #include <cstdint>
+#include <cassert>
+
+#include "../../../config/net_config.h"
 
 #include "h3.h"
 #include "emac.h"
+#include "emac/phy.h"
+#include "emac/emac.h"
 
 #include "debug.h"
 
 extern struct coherent_region *p_coherent_region;
 
+void emac_free_pkt();
+
+static net::emac::Stats s_stats;
+
+#if defined (UDP_RX_ZERO_COPY)
+/*
+ * A received frame can be loaned to the UDP layer, it is given back with emac_release_pkt().
+ * The loaned buffer is swapped for a spare one, the descriptor itself is not held.
+ */
+static char *s_pRxSpare[CONFIG_RX_LOANS_MAX];
+static uint32_t s_nRxSpare;
+
+void emac_rx_spare_init() {
+	for (uint32_t i = 0; i < CONFIG_RX_LOANS_MAX; i++) {
+		s_pRxSpare[i] = &p_coherent_region->rxspare[i * CONFIG_ETH_BUFSIZE];
+	}
+
+	s_nRxSpare = CONFIG_RX_LOANS_MAX;
+}
+#endif
+
 __attribute__((hot)) int emac_eth_recv(uint8_t **packetp) {
 	uint32_t status, desc_num = p_coherent_region->rx_currdescnum;
 	struct emac_dma_desc *desc_p = &p_coherent_region->rx_chain[desc_num];
@@ -45,10 +71,12 @@ __attribute__((hot)) int emac_eth_recv(uint8_t **packetp) {
 
 		if (length < 0x40) {
 			DEBUG_PUTS("Bad Packet (length < 0x40)");
+			emac_free_pkt();
 			return -1;
 		} else {
 			if (length > CONFIG_ETH_RXSIZE) {
 				DEBUG_PRINTF("Received packet is too big (length=%d)\n", length);
+				emac_free_pkt();
 				return -1;
 			}
 
@@ -60,28 +88,42 @@ __attribute__((hot)) int emac_eth_recv(uint8_t **packetp) {
 		}
 	}
 
-	return -1;
+	return 0;
 }
 
-void emac_eth_send(void *packet, uint32_t len) {
+/*
+ * TX descriptor ring
+ * A descriptor is owned by the CPU when bit 31 of status is 0. The DMA clears
+ * the bit when the frame is sent. Committed frames are handed to the DMA with
+ * a single doorbell, directly or at the end of a batch.
+ */
+static uint32_t s_nTxPending;	///< Committed, doorbell not rung yet
+static uint32_t s_nTxBatch;		///< Nesting level of emac_eth_tx_batch_begin()
+
+__attribute__((hot)) uint8_t *emac_eth_tx_reserve() {
+	const auto *desc_p = &p_coherent_region->tx_chain[p_coherent_region->tx_currdescnum];
+
+	/* Check for DMA own bit */
+	if (__builtin_expect((desc_p->status & (1U << 31)), 0)) {
+		return nullptr;
+	}
+
+	return reinterpret_cast<uint8_t *>(desc_p->buf_addr);
+}
+
+__attribute__((hot)) void emac_eth_tx_commit(uint32_t len) {
 	auto desc_num = p_coherent_region->tx_currdescnum;
 	auto *desc_p = &p_coherent_region->tx_chain[desc_num];
-	auto data_start = static_cast<uintptr_t>(desc_p->buf_addr);
 
-	desc_p->st = len;
-	/* Mandatory undocumented bit */
-	desc_p->st |= (1U << 24);
+	assert(len <= CONFIG_ETH_BUFSIZE);
+	assert(!(desc_p->status & (1U << 31)));
 
-	h3_memcpy(reinterpret_cast<void *>(data_start), packet, static_cast<size_t>(len));
 #ifdef DEBUG_DUMP
-	debug_dump(reinterpret_cast<void *>(data_start), static_cast<uint16_t>(len));
+	debug_dump(reinterpret_cast<void *>(desc_p->buf_addr), static_cast<uint16_t>(len));
 #endif
-	/* frame end */
-	desc_p->st |= (1 << 30);
-	desc_p->st |= (1U << 31);
 
-	/*frame begin */
-	desc_p->st |= (1 << 29);
+	/* Mandatory undocumented bit, frame begin, frame end */
+	desc_p->st = len | (1U << 24) | (1 << 29) | (1 << 30) | (1U << 31);
 	desc_p->status = (1U << 31);
 
 	/* Move to next Descriptor and wrap around */
@@ -91,6 +133,24 @@ void emac_eth_send(void *packet, uint32_t len) {
 
 	p_coherent_region->tx_currdescnum = desc_num;
 
+	s_nTxPending++;
+
+	if (s_nTxBatch == 0) {
+		emac_eth_tx_flush();
+	}
+}
+
+void emac_eth_tx_flush() {
+	if (s_nTxPending == 0) {
+		return;
+	}
+
+	if (s_nTxPending > s_stats.nTxBatchHighWater) {
+		s_stats.nTxBatchHighWater = s_nTxPending;
+	}
+
+	s_nTxPending = 0;
+
 	/* Start the DMA */
 	uint32_t value = H3_EMAC->TX_CTL1;
 	value |= (1U << 31);/* mandatory */
@@ -98,6 +158,55 @@ void emac_eth_send(void *packet, uint32_t len) {
 	H3_EMAC->TX_CTL1 = value;
 }
 
+void emac_eth_tx_batch_begin() {
+	s_nTxBatch++;
+}
+
+void emac_eth_tx_batch_end() {
+	assert(s_nTxBatch != 0);
+
+	if (--s_nTxBatch == 0) {
+		emac_eth_tx_flush();
+	}
+}
+
+/**
+ * The ring is full, make sure the DMA is running and wait for the oldest descriptor
+ */
+static uint8_t *tx_wait() {
+	emac_eth_tx_flush();
+
+	const auto nMicros = H3_TIMER->AVS_CNT1;
+
+	do {
+		const auto *desc_p = &p_coherent_region->tx_chain[p_coherent_region->tx_currdescnum];
+
+		if (!(desc_p->status & (1U << 31))) {
+			return reinterpret_cast<uint8_t *>(desc_p->buf_addr);
+		}
+	} while (H3_TIMER->AVS_CNT1 - nMicros < CONFIG_TX_TIMEOUT);
+
+	return nullptr;
+}
+
+void emac_eth_send(void *packet, uint32_t len) {
+	auto *pBuffer = emac_eth_tx_reserve();
+
+	if (__builtin_expect((pBuffer == nullptr), 0)) {
+		s_stats.nTxRingFull++;
+		pBuffer = tx_wait();
+
+		if (pBuffer == nullptr) {
+			s_stats.nTxDropped++;
+			return;
+		}
+	}
+
+	h3_memcpy(pBuffer, packet, static_cast<size_t>(len));
+
+	emac_eth_tx_commit(len);
+}
+
 void emac_free_pkt(void) {
 	auto desc_num = p_coherent_region->rx_currdescnum;
 	auto *desc_p = &p_coherent_region->rx_chain[desc_num];
@@ -112,3 +221,71 @@ void emac_free_pkt(void) {
 
 	p_coherent_region->rx_currdescnum = desc_num;
 }
+
+#if defined (UDP_RX_ZERO_COPY)
+/**
+ * Keep the buffer of the current frame, the descriptor gets a spare buffer
+ * and is given back to the DMA by emac_free_pkt() as usual.
+ * @return false when there is no spare buffer left
+ */
+bool emac_loan_pkt() {
+	if (s_nRxSpare == 0) {
+		return false;
+	}
+
+	auto *desc_p = &p_coherent_region->rx_chain[p_coherent_region->rx_currdescnum];
+	desc_p->buf_addr = reinterpret_cast<uintptr_t>(s_pRxSpare[--s_nRxSpare]);
+	/* The DMA must see the new buffer before it owns the descriptor again */
+	__sync_synchronize();
+
+	return true;
+}
+
+/**
+ * @param pPacket any address within the loaned buffer
+ */
+void emac_release_pkt(const uint8_t *pPacket) {
+	const auto nAddress = reinterpret_cast<uintptr_t>(pPacket);
+	const auto nRxBuffer = reinterpret_cast<uintptr_t>(&p_coherent_region->rxbuffer[0]);
+	const auto nRxSpare = reinterpret_cast<uintptr_t>(&p_coherent_region->rxspare[0]);
+	/* A buffer can be in either pool, depending on how often it was swapped */
+	const auto nBase = ((nAddress - nRxBuffer) < RX_TOTAL_BUFSIZE) ? nRxBuffer : nRxSpare;
+
+	assert((nAddress - nBase) < ((nBase == nRxBuffer) ? RX_TOTAL_BUFSIZE : RX_SPARE_BUFSIZE));
+	assert(s_nRxSpare < CONFIG_RX_LOANS_MAX);
+
+	s_pRxSpare[s_nRxSpare++] = reinterpret_cast<char *>(nBase + (((nAddress - nBase) / CONFIG_ETH_BUFSIZE) * CONFIG_ETH_BUFSIZE));
+}
+#endif
+
+void emac_rx_stats_update() {
+	const auto nStatus = H3_EMAC->INT_STA & (INT_STA_RX_BUF_UA | INT_STA_RX_OVERFLOW);
+
+	if (__builtin_expect((nStatus != 0), 0)) {
+		if (nStatus & INT_STA_RX_BUF_UA) {
+			s_stats.nRxBufferUnavailable++;
+		}
+		if (nStatus & INT_STA_RX_OVERFLOW) {
+			s_stats.nRxOverflow++;
+		}
+		/* Write 1 to clear */
+		H3_EMAC->INT_STA = nStatus;
+	}
+
+	const auto desc_num = p_coherent_region->rx_currdescnum;
+	const auto dma_desc_num = (H3_EMAC->RX_CUR_DESC - reinterpret_cast<uintptr_t>(&p_coherent_region->rx_chain[0])) / sizeof(struct emac_dma_desc);
+
+	auto nPending = (dma_desc_num + CONFIG_RX_DESCR_NUM - desc_num) % CONFIG_RX_DESCR_NUM;
+
+	if ((nPending == 0) && !(p_coherent_region->rx_chain[desc_num].status & (1U << 31))) {
+		nPending = CONFIG_RX_DESCR_NUM;
+	}
+
+	if (nPending > s_stats.nRxPendingHighWater) {
+		s_stats.nRxPendingHighWater = nPending;
+	}
+}
+
+void emac_get_stats(net::emac::Stats& stats) {
+	stats = s_stats;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file json_get_netstats.cpp
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace remoteconfig {
+namespace net {
+/*
+ * The stack is the host's, the UDP counters are taken from /proc/net/snmp.
+ * The first "Udp:" line has the field names, the second one the values.
+ */
+static bool get_udp_snmp(unsigned long& nInDatagrams, unsigned long& nNoPorts, unsigned long& nInErrors, unsigned long& nRcvbufErrors) {
+	auto *pFile = fopen("/proc/net/snmp", "r");
+
+	if (pFile == nullptr) {
+		return false;
+	}
+
+	char aLine[512];
+	auto isHeader = true;
+	auto isFound = false;
+
+	while (fgets(aLine, sizeof(aLine), pFile) != nullptr) {
+		if (strncmp(aLine, "Udp: ", 5) != 0) {
+			continue;
+		}
+
+		if (isHeader) {
+			isHeader = false;
+			continue;
+		}
+
+		unsigned long nOutDatagrams;
+		isFound = (sscanf(&aLine[5], "%lu %lu %lu %lu %lu", &nInDatagrams, &nNoPorts, &nInErrors, &nOutDatagrams, &nRcvbufErrors) == 5);
+		break;
+	}
+
+	fclose(pFile);
+	return isFound;
+}
+
+uint32_t json_get_netstats(char *pOutBuffer, const uint32_t nOutBufferSize) {
+	unsigned long nInDatagrams, nNoPorts, nInErrors, nRcvbufErrors;
+
+	if (!get_udp_snmp(nInDatagrams, nNoPorts, nInErrors, nRcvbufErrors)) {
+		const auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nOutBufferSize, "{}"));
+		return nLength;
+	}
+
+	const auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nOutBufferSize,
+			"{\"udp\":{\"no_port\":%lu,\"received\":%lu,\"errors\":%lu,\"overrun\":%lu}}",
+			nNoPorts, nInDatagrams, nInErrors, nRcvbufErrors));
+
+	return nLength;
+}
+}  // namespace net
+}  // namespace remoteconfig
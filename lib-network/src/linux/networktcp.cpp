@@ -34,6 +34,7 @@
 #include <cassert>
 
 #include "network.h"
+#include "hardware.h"
 #include "../../config/net_config.h"
 
 #include "debug.h"
@@ -47,6 +48,16 @@ static uint16_t s_ports_allowed[MAX_PORTS_ALLOWED];
 static struct pollfd poll_set[MAX_PORTS_ALLOWED][TCP_MAX_TCBS_ALLOWED];
 static int server_sockfd[MAX_PORTS_ALLOWED];
 static uint8_t s_ReadBuffer[MAX_SEGMENT_LENGTH];
+static uint32_t s_nConnectionId[MAX_PORTS_ALLOWED][TCP_MAX_TCBS_ALLOWED];
+static uint32_t s_nLastReceived[MAX_PORTS_ALLOWED][TCP_MAX_TCBS_ALLOWED];
+static uint32_t s_nConnections;
+
+static void remove_client(const int32_t nHandle, const int fd_index) {
+	close(poll_set[nHandle][fd_index].fd);
+	poll_set[nHandle][fd_index].fd = 0;
+	poll_set[nHandle][fd_index].events = 0;
+	poll_set[nHandle][fd_index].revents = 0;
+}
 
 int32_t Network::TcpBegin(uint16_t nLocalPort) {
 	int32_t i;
@@ -154,6 +165,9 @@ uint16_t Network::TcpRead(const int32_t nHandle, const uint8_t **ppBuffer, uint3
 				poll_set[nHandle][empty_slot].fd = client_sockfd;
 				poll_set[nHandle][empty_slot].events = POLLIN | POLLPRI;
 
+				s_nConnectionId[nHandle][empty_slot] = ++s_nConnections;
+				s_nLastReceived[nHandle][empty_slot] = Hardware::Get()->Millis();
+
 				DEBUG_PRINTF("Adding client on fd %d", client_sockfd);
 			} else {
 				int nread;
@@ -161,20 +175,15 @@ uint16_t Network::TcpRead(const int32_t nHandle, const uint8_t **ppBuffer, uint3
 
 				if (nread == 0) {
 					DEBUG_PRINTF("Removing client on fd %d", current_fd);
-					close(current_fd);
-					poll_set[nHandle][fd_index].fd = 0;
-					poll_set[nHandle][fd_index].events = 0;
-					poll_set[nHandle][fd_index].revents = 0;
+					remove_client(nHandle, fd_index);
 				} else {
 					DEBUG_PRINTF("Serving client on fd %d", current_fd);
 					const int bytes = read(current_fd, s_ReadBuffer, MAX_SEGMENT_LENGTH);
 					if (bytes <= 0) {
 						perror("read failed");
-						close(current_fd);
-						poll_set[nHandle][fd_index].fd = 0;
-						poll_set[nHandle][fd_index].events = 0;
-						poll_set[nHandle][fd_index].revents = 0;
+						remove_client(nHandle, fd_index);
 					} else {
+						s_nLastReceived[nHandle][fd_index] = Hardware::Get()->Millis();
 						HandleConnectionIndex = static_cast<uint32_t>(fd_index);
 						*ppBuffer = reinterpret_cast<uint8_t*>(&s_ReadBuffer);
 						return static_cast<uint16_t>(bytes);
@@ -189,7 +198,7 @@ uint16_t Network::TcpRead(const int32_t nHandle, const uint8_t **ppBuffer, uint3
 	return 0;
 }
 
-void Network::TcpWrite(const int32_t nHandle, const uint8_t *pBuffer, uint32_t nLength, const uint32_t HandleConnectionIndex) {
+uint32_t Network::TcpWrite(const int32_t nHandle, const uint8_t *pBuffer, uint32_t nLength, const uint32_t HandleConnectionIndex) {
 	assert(nHandle < MAX_PORTS_ALLOWED);
 
 	DEBUG_PRINTF("Write client on fd %d [%u]", poll_set[nHandle][HandleConnectionIndex].fd, HandleConnectionIndex);
@@ -198,6 +207,31 @@ void Network::TcpWrite(const int32_t nHandle, const uint8_t *pBuffer, uint32_t n
 
 	if (c < 0) {
 		perror("write");
+		return 0;
+	}
+
+	return static_cast<uint32_t>(c);
+}
+
+void Network::TcpClose(const int32_t nHandle, const uint32_t HandleConnectionIndex) {
+	assert(nHandle < MAX_PORTS_ALLOWED);
+
+	const auto fd = poll_set[nHandle][HandleConnectionIndex].fd;
+
+	if ((fd != 0) && (fd != server_sockfd[nHandle])) {
+		DEBUG_PRINTF("Closing client on fd %d", fd);
+		remove_client(nHandle, static_cast<int>(HandleConnectionIndex));
 	}
 }
+
+void Network::TcpGetConnection(const int32_t nHandle, const uint32_t HandleConnectionIndex, net::tcp::Connection& connection) {
+	assert(nHandle < MAX_PORTS_ALLOWED);
+
+	const auto fd = poll_set[nHandle][HandleConnectionIndex].fd;
+
+	connection.isEstablished = (fd != 0) && (fd != server_sockfd[nHandle]);
+	connection.isWritable = connection.isEstablished;
+	connection.nId = s_nConnectionId[nHandle][HandleConnectionIndex];
+	connection.nIdleMillis = Hardware::Get()->Millis() - s_nLastReceived[nHandle][HandleConnectionIndex];
+}
 #endif
@@ -25,6 +25,9 @@
 
 /*
  * https://tools.ietf.org/html/rfc1350
+ * https://tools.ietf.org/html/rfc2347 Option Extension
+ * https://tools.ietf.org/html/rfc2348 Blocksize Option
+ * https://tools.ietf.org/html/rfc7440 Windowsize Option
  */
 
 #include <cstdint>
@@ -34,6 +37,9 @@
 #include "net/apps/tftpdaemon.h"
 
 #include "network.h"
+#include "hardware.h"
+
+#include "../../../../config/net_config.h"
 
 #include "debug.h"
 
@@ -42,7 +48,8 @@ enum TOpCode {
 	OP_CODE_WRQ = 2,			///< Write request (WRQ)
 	OP_CODE_DATA = 3,			///< Data (DATA)
 	OP_CODE_ACK = 4,			///< Acknowledgment (ACK)
-	OP_CODE_ERROR = 5			///< Error (ERROR)
+	OP_CODE_ERROR = 5,			///< Error (ERROR)
+	OP_CODE_OACK = 6			///< Option Acknowledgment (OACK)
 };
 
 enum TErrorCode {
@@ -58,9 +65,36 @@ enum TErrorCode {
 
 namespace tftp {
 static constexpr uint16_t UDP_PORT = 69;
+static constexpr uint16_t TRANSFER_PORT = TFTP_TRANSFER_PORT;
+static constexpr uint32_t RETRANSMIT_MILLIS = 1000;
+static constexpr uint32_t MAX_RETRIES = 5;
+
+/**
+ * @return the depth of the UDP receive ring of the transfer port, see UDP_RX_QUEUE_DEPTH_PORTS
+ */
+static constexpr uint32_t transfer_port_depth() {
+	constexpr struct {
+		uint16_t nPort;
+		uint16_t nDepth;
+	} queueDepth[] = UDP_RX_QUEUE_DEPTH_PORTS;
+
+	for (const auto& q : queueDepth) {
+		if (q.nPort == TRANSFER_PORT) {
+			return q.nDepth;
+		}
+	}
+
+	return UDP_RX_QUEUE_DEPTH_DEFAULT;
+}
+
+namespace option {
+	static constexpr uint8_t BLKSIZE = (1U << 0);
+	static constexpr uint8_t WINDOWSIZE = (1U << 1);
+}
 
 namespace min {
 	static constexpr auto FILENAME_MODE_LEN = (1 + 1 + 1 + 1);
+	static constexpr uint32_t BLKSIZE = 8;
 }
 
 namespace max {
@@ -69,6 +103,15 @@ namespace max {
 	static constexpr auto FILENAME_MODE_LEN = (FILENAME_LEN + 1 + MODE_LEN + 1);
 	static constexpr auto DATA_LEN = 512;
 	static constexpr auto ERRMSG_LEN = 128;
+	static constexpr auto OPTIONS_LEN = 64;
+	static constexpr uint32_t BLKSIZE = 1468;		///< 1500 bytes MTU - IPv4 header - UDP header - TFTP header
+	static constexpr uint32_t WINDOWSIZE = 16;		///< Blocks in flight when sending
+	/*
+	 * When receiving, a window arrives as a burst.
+	 * It must fit in the UDP receive ring of the transfer port.
+	 */
+	static constexpr uint32_t WINDOWSIZE_RX = (transfer_port_depth() < WINDOWSIZE) ? transfer_port_depth() : WINDOWSIZE;
+	static_assert(WINDOWSIZE_RX >= 1, "");
 }
 
 #if  !defined (PACKED)
@@ -85,6 +128,11 @@ struct AckPacket {
 	uint16_t BlockNumber;
 } PACKED;
 
+struct OptionAckPacket {
+	uint16_t OpCode;
+	char Options[max::OPTIONS_LEN];
+} PACKED;
+
 struct ErrorPacket {
 	uint16_t OpCode;
 	uint16_t ErrorCode;
@@ -94,11 +142,53 @@ struct ErrorPacket {
 struct DataPacket {
 	uint16_t OpCode;
 	uint16_t BlockNumber;
-	uint8_t Data[max::DATA_LEN];
+	uint8_t Data[max::BLKSIZE];
 } PACKED;
+
+static constexpr uint32_t DATA_HEADER_LEN = sizeof(DataPacket::OpCode) + sizeof(DataPacket::BlockNumber);
+
+/**
+ * @return the character after the NUL, or nullptr when the string is not terminated before pEnd
+ */
+static const char *skip_string(const char *pString, const char *pEnd) {
+	while (pString < pEnd) {
+		if (*pString++ == '\0') {
+			return pString;
+		}
+	}
+
+	return nullptr;
+}
+
+static uint32_t add_option(char *pOptions, const char *pName, const uint32_t nValue) {
+	char aValue[8];
+	auto nDigits = 0U;
+	auto nCopy = nValue;
+
+	do {
+		aValue[nDigits++] = static_cast<char>('0' + (nCopy % 10U));
+		nCopy /= 10U;
+	} while (nCopy != 0);
+
+	const auto nNameLength = strlen(pName) + 1U;
+	memcpy(pOptions, pName, nNameLength);
+
+	auto *pValue = &pOptions[nNameLength];
+
+	while (nDigits != 0) {
+		*pValue++ = aValue[--nDigits];
+	}
+
+	*pValue++ = '\0';
+
+	return static_cast<uint32_t>(pValue - pOptions);
+}
 }  // namespace tftp
 
+static uint8_t s_TxBuffer[sizeof(struct tftp::DataPacket)] __attribute__ ((aligned (4)));
+
 TFTPDaemon *TFTPDaemon::s_pThis;
+tftp::Stats TFTPDaemon::s_Stats;
 
 TFTPDaemon::TFTPDaemon() {
 	DEBUG_ENTRY
@@ -118,7 +208,9 @@ TFTPDaemon::~TFTPDaemon() {
 	DEBUG_ENTRY
 	DEBUG_PRINTF("s_pThis=%p", reinterpret_cast<void *>(s_pThis));
 
-	Network::Get()->End(m_nFromPort);
+	if (m_nLocalPort != 0) {
+		Network::Get()->End(m_nLocalPort);
+	}
 
 	s_pThis = nullptr;
 
@@ -127,18 +219,25 @@ TFTPDaemon::~TFTPDaemon() {
 
 void TFTPDaemon::Run() {
 	if (m_nState == TFTPState::INIT) {
-		if (m_nFromPort != 0) {
-			Network::Get()->End(m_nFromPort);
+		if (m_nLocalPort != 0) {
+			Network::Get()->End(m_nLocalPort);
 			m_nIdx = -1;
 		}
 
 		m_nIdx = Network::Get()->Begin(tftp::UDP_PORT);
 		DEBUG_PRINTF("m_nIdx=%d", m_nIdx);
 
-		m_nFromPort = tftp::UDP_PORT;
+		m_nLocalPort = tftp::UDP_PORT;
 		m_nBlockNumber = 0;
+		m_nBlockSent = 0;
+		m_nBlockSize = tftp::max::DATA_LEN;
+		m_nWindowSize = 1;
+		m_nWindowCount = 0;
+		m_nOptions = 0;
+		m_nRetries = 0;
 		m_nState = TFTPState::WAITING_RQ;
 		m_bIsLastBlock = false;
+		m_bIsOutOfOrderAcked = false;
 	} else {
 		m_nLength = Network::Get()->RecvFrom(m_nIdx, const_cast<const void **>(reinterpret_cast<void **>(&m_pBuffer)), &m_nFromIp, &m_nFromPort);
 
@@ -149,15 +248,22 @@ void TFTPDaemon::Run() {
 			}
 			break;
 		case TFTPState::RRQ_SEND_PACKET:
-			DoRead();
+			if (m_nLength >= sizeof(struct tftp::AckPacket)) {
+				HandleRecvAck();
+			}
+			if (m_nState == TFTPState::RRQ_SEND_PACKET) {
+				DoRead();
+			}
 			break;
 		case TFTPState::RRQ_RECV_ACK:
-			if (m_nLength == sizeof(struct tftp::AckPacket)) {
+			if (m_nLength >= sizeof(struct tftp::AckPacket)) {
 				HandleRecvAck();
+			} else {
+				HandleTimeout();
 			}
 			break;
 		case TFTPState::WRQ_RECV_PACKET:
-			if (m_nLength <= sizeof(struct tftp::DataPacket)) {
+			if ((m_nLength >= tftp::DATA_HEADER_LEN) && (m_nLength <= (tftp::DATA_HEADER_LEN + m_nBlockSize))) {
 				HandleRecvData();
 			}
 			break;
@@ -202,6 +308,14 @@ void TFTPDaemon::HandleRequest() {
 
 	DEBUG_PRINTF("Incoming %s request from " IPSTR " %s %s", nOpCode == OP_CODE_RRQ ? "read" : "write", IP2STR(m_nFromIp), pFileName, pMode);
 
+	HandleOptions(pMode + strlen(pMode) + 1, nOpCode);
+
+	s_Stats.nBlockSize = static_cast<uint16_t>(m_nBlockSize);
+	s_Stats.nWindowSize = m_nWindowSize;
+
+	m_nBytes = 0;
+	m_nMillisStart = Hardware::Get()->Millis();
+
 	switch (nOpCode) {
 		case OP_CODE_RRQ:
 			if(!FileOpen(pFileName, mode)) {
@@ -209,9 +323,16 @@ void TFTPDaemon::HandleRequest() {
 				m_nState = TFTPState::WAITING_RQ;
 			} else {
 				Network::Get()->End(tftp::UDP_PORT);
-				m_nIdx = Network::Get()->Begin(m_nFromPort);
-				m_nState = TFTPState::RRQ_SEND_PACKET;
-				DoRead();
+				m_nIdx = Network::Get()->Begin(tftp::TRANSFER_PORT);
+				m_nLocalPort = tftp::TRANSFER_PORT;
+				if (m_nOptions != 0) {
+					// The client acknowledges the OACK with ACK 0
+					SendOptionAck();
+					m_nState = TFTPState::RRQ_RECV_ACK;
+				} else {
+					m_nState = TFTPState::RRQ_SEND_PACKET;
+					DoRead();
+				}
 			}
 			break;
 		case OP_CODE_WRQ:
@@ -220,9 +341,16 @@ void TFTPDaemon::HandleRequest() {
 				m_nState = TFTPState::WAITING_RQ;
 			} else {
 				Network::Get()->End(tftp::UDP_PORT);
-				m_nIdx = Network::Get()->Begin(m_nFromPort);
-				m_nState = TFTPState::WRQ_SEND_ACK;
-				DoWriteAck();
+				m_nIdx = Network::Get()->Begin(tftp::TRANSFER_PORT);
+				m_nLocalPort = tftp::TRANSFER_PORT;
+				if (m_nOptions != 0) {
+					// The OACK takes the place of ACK 0
+					SendOptionAck();
+					m_nState = TFTPState::WRQ_RECV_PACKET;
+				} else {
+					m_nState = TFTPState::WRQ_SEND_ACK;
+					DoWriteAck();
+				}
 			}
 			break;
 		default:
@@ -232,6 +360,68 @@ void TFTPDaemon::HandleRequest() {
 	}
 }
 
+/**
+ * The options follow the mode, as pairs of NUL terminated strings.
+ * Unknown options are ignored, the values of known options are limited to what is supported.
+ * The accepted options are sent back in the OACK.
+ */
+void TFTPDaemon::HandleOptions(const char *pOption, const uint16_t nOpCode) {
+	const auto *const pEnd = reinterpret_cast<const char *>(m_pBuffer) + m_nLength;
+
+	while (pOption < pEnd) {
+		const auto *pValue = tftp::skip_string(pOption, pEnd);
+
+		if ((pValue == nullptr) || (tftp::skip_string(pValue, pEnd) == nullptr)) {
+			break;
+		}
+
+		uint32_t nValue = 0;
+		const auto *pDigit = pValue;
+
+		while ((*pDigit >= '0') && (*pDigit <= '9') && (nValue <= 0xFFFF)) {
+			nValue = (nValue * 10U) + static_cast<uint32_t>(*pDigit++ - '0');
+		}
+
+		const auto isValid = (*pDigit == '\0') && (pDigit != pValue);
+
+		DEBUG_PRINTF("%s=%s [%d]", pOption, pValue, isValid);
+
+		if (isValid && (strcasecmp(pOption, "blksize") == 0) && (nValue >= tftp::min::BLKSIZE)) {
+			m_nBlockSize = (nValue < tftp::max::BLKSIZE) ? nValue : tftp::max::BLKSIZE;
+			m_nOptions |= tftp::option::BLKSIZE;
+		} else if (isValid && (strcasecmp(pOption, "windowsize") == 0) && (nValue >= 1)) {
+			const auto nWindowSizeMax = (nOpCode == OP_CODE_WRQ) ? tftp::max::WINDOWSIZE_RX : tftp::max::WINDOWSIZE;
+			m_nWindowSize = static_cast<uint16_t>((nValue < nWindowSizeMax) ? nValue : nWindowSizeMax);
+			m_nOptions |= tftp::option::WINDOWSIZE;
+		}
+
+		pOption = tftp::skip_string(pValue, pEnd);
+	}
+
+	DEBUG_PRINTF("m_nBlockSize=%u, m_nWindowSize=%u", m_nBlockSize, m_nWindowSize);
+}
+
+void TFTPDaemon::SendOptionAck() {
+	auto *const pOptionAckPacket = reinterpret_cast<struct tftp::OptionAckPacket *>(s_TxBuffer);
+
+	pOptionAckPacket->OpCode = __builtin_bswap16(OP_CODE_OACK);
+
+	uint32_t nLength = 0;
+
+	if ((m_nOptions & tftp::option::BLKSIZE) != 0) {
+		nLength += tftp::add_option(&pOptionAckPacket->Options[nLength], "blksize", m_nBlockSize);
+	}
+
+	if ((m_nOptions & tftp::option::WINDOWSIZE) != 0) {
+		nLength += tftp::add_option(&pOptionAckPacket->Options[nLength], "windowsize", m_nWindowSize);
+	}
+
+	assert(nLength <= tftp::max::OPTIONS_LEN);
+
+	Network::Get()->SendTo(m_nIdx, s_TxBuffer, static_cast<uint32_t>(sizeof(pOptionAckPacket->OpCode) + nLength), m_nFromIp, m_nFromPort);
+	m_nMillisSent = Hardware::Get()->Millis();
+}
+
 void TFTPDaemon::SendError (const uint16_t nErrorCode, const char *pErrorMessage) {
 	tftp::ErrorPacket ErrorPacket;
 
@@ -242,81 +432,196 @@ void TFTPDaemon::SendError (const uint16_t nErrorCode, const char *pErrorMessage
 	Network::Get()->SendTo(m_nIdx, &ErrorPacket, sizeof ErrorPacket, m_nFromIp, m_nFromPort);
 }
 
-void TFTPDaemon::DoRead() {
-	auto *const pDataPacket = reinterpret_cast<struct tftp::DataPacket*>(m_pBuffer);
-	assert(pDataPacket != nullptr);
+void TFTPDaemon::TransferDone() {
+	s_Stats.nTransfers++;
+	s_Stats.nBytes = m_nBytes;
+	s_Stats.nMillis = Hardware::Get()->Millis() - m_nMillisStart;
 
-	if (m_nState == TFTPState::RRQ_SEND_PACKET) {
-		m_nDataLength = FileRead(pDataPacket->Data, tftp::max::DATA_LEN, ++m_nBlockNumber);
+	DEBUG_PRINTF("nBytes=%u, nMillis=%u", s_Stats.nBytes, s_Stats.nMillis);
+}
 
-		pDataPacket->OpCode = __builtin_bswap16(OP_CODE_DATA);
-		pDataPacket->BlockNumber = __builtin_bswap16(m_nBlockNumber);
+/**
+ * Sends the next block of the window, one block for each Run().
+ */
+void TFTPDaemon::DoRead() {
+	auto *const pDataPacket = reinterpret_cast<struct tftp::DataPacket*>(s_TxBuffer);
 
-		m_nPacketLength = static_cast<uint16_t>(sizeof pDataPacket->OpCode + sizeof pDataPacket->BlockNumber + m_nDataLength);
-		m_bIsLastBlock = m_nDataLength < tftp::max::DATA_LEN;
+	assert(m_nState == TFTPState::RRQ_SEND_PACKET);
 
-		if (m_bIsLastBlock) {
-			FileClose();
-		}
+	m_nBlockSent++;
+	m_nDataLength = static_cast<uint32_t>(FileRead(pDataPacket->Data, m_nBlockSize, m_nBlockSent));
 
-		DEBUG_PRINTF("m_nDataLength=%u, m_nPacketLength=%d, m_bIsLastBlock=%d", m_nDataLength, m_nPacketLength, m_bIsLastBlock);
-	}
+	pDataPacket->OpCode = __builtin_bswap16(OP_CODE_DATA);
+	pDataPacket->BlockNumber = __builtin_bswap16(m_nBlockSent);
+
+	m_bIsLastBlock = m_nDataLength < m_nBlockSize;
 
+	DEBUG_PRINTF("m_nBlockSent=%u, m_nDataLength=%u, m_bIsLastBlock=%d", m_nBlockSent, m_nDataLength, m_bIsLastBlock);
 	DEBUG_PRINTF("Sending to " IPSTR ":%d", IP2STR(m_nFromIp), m_nFromPort);
 
-	Network::Get()->SendTo(m_nIdx, m_pBuffer, m_nPacketLength, m_nFromIp, m_nFromPort);
+	Network::Get()->SendTo(m_nIdx, s_TxBuffer, tftp::DATA_HEADER_LEN + m_nDataLength, m_nFromIp, m_nFromPort);
+	m_nMillisSent = Hardware::Get()->Millis();
 
-	m_nState = TFTPState::RRQ_RECV_ACK;
+	if (m_bIsLastBlock || (static_cast<uint16_t>(m_nBlockSent - m_nBlockNumber) >= m_nWindowSize)) {
+		m_nState = TFTPState::RRQ_RECV_ACK;
+	}
 }
 
+/**
+ * With a window, an ACK for an earlier block means that the blocks after it are lost.
+ * The sending continues with the block after the acknowledged one.
+ * With lockstep (windowsize 1) a duplicate ACK is ignored, the retransmission is left
+ * to the timer, otherwise each block would be sent twice from then on (Sorcerer's Apprentice Syndrome).
+ */
 void TFTPDaemon::HandleRecvAck() {
 	const auto *const pAckPacket = reinterpret_cast<struct tftp::AckPacket *>(m_pBuffer);
 	assert(pAckPacket != nullptr);
 
-	if (pAckPacket->OpCode == __builtin_bswap16(OP_CODE_ACK)) {
+	if (pAckPacket->OpCode == __builtin_bswap16(OP_CODE_ERROR)) {
+		DEBUG_PUTS("Error from client");
+		FileClose();
+		m_nState = TFTPState::INIT;
+		return;
+	}
+
+	if (pAckPacket->OpCode != __builtin_bswap16(OP_CODE_ACK)) {
+		return;
+	}
+
+	const auto nBlockNumber = __builtin_bswap16(pAckPacket->BlockNumber);
 
-		DEBUG_PRINTF("Incoming from " IPSTR ", BlockNumber=%d, m_nBlockNumber=%d", IP2STR(m_nFromIp), __builtin_bswap16(pAckPacket->BlockNumber), m_nBlockNumber	);
+	DEBUG_PRINTF("Incoming from " IPSTR ", BlockNumber=%d, m_nBlockNumber=%d, m_nBlockSent=%d", IP2STR(m_nFromIp), nBlockNumber, m_nBlockNumber, m_nBlockSent);
 
-		if (pAckPacket->BlockNumber == __builtin_bswap16(m_nBlockNumber)) {
-			m_nState = m_bIsLastBlock ? TFTPState::INIT : TFTPState::RRQ_SEND_PACKET;
+	const auto nInFlight = static_cast<uint16_t>(m_nBlockSent - m_nBlockNumber);
+	const auto nAcked = static_cast<uint16_t>(nBlockNumber - m_nBlockNumber);
+
+	if (nAcked > nInFlight) {
+		return;
+	}
+
+	s_Stats.nBlocks += nAcked;
+	m_nBytes += nAcked * m_nBlockSize;
+
+	if (nAcked != 0) {
+		m_nRetries = 0;
+	}
+
+	if (nBlockNumber == m_nBlockSent) {
+		if (m_bIsLastBlock) {
+			m_nBytes -= (m_nBlockSize - m_nDataLength);
+			FileClose();
+			TransferDone();
+			m_nState = TFTPState::INIT;
+			return;
 		}
+	} else if (m_nWindowSize == 1) {
+		return;
+	} else {
+		s_Stats.nRetransmits += static_cast<uint16_t>(m_nBlockSent - nBlockNumber);
+	}
+
+	m_nBlockNumber = nBlockNumber;
+	m_nBlockSent = nBlockNumber;
+	m_nState = TFTPState::RRQ_SEND_PACKET;
+}
+
+/**
+ * Without an ACK in time, the blocks after the last acknowledged one are sent again.
+ * The transfer is aborted after tftp::MAX_RETRIES timeouts without progress.
+ */
+void TFTPDaemon::HandleTimeout() {
+	if ((Hardware::Get()->Millis() - m_nMillisSent) < tftp::RETRANSMIT_MILLIS) {
+		return;
 	}
+
+	if (++m_nRetries > tftp::MAX_RETRIES) {
+		DEBUG_PUTS("No ACK from client");
+		FileClose();
+		m_nState = TFTPState::INIT;
+		return;
+	}
+
+	if (m_nBlockSent == m_nBlockNumber) {
+		// Nothing in flight, the OACK or its ACK 0 is lost
+		SendOptionAck();
+		return;
+	}
+
+	s_Stats.nRetransmits += static_cast<uint16_t>(m_nBlockSent - m_nBlockNumber);
+	m_nBlockSent = m_nBlockNumber;
+	m_nState = TFTPState::RRQ_SEND_PACKET;
 }
 
 void TFTPDaemon::DoWriteAck() {
-	auto *const pAckPacket = reinterpret_cast<struct tftp::AckPacket *>(m_pBuffer);
-	assert(pAckPacket != nullptr);
+	auto *const pAckPacket = reinterpret_cast<struct tftp::AckPacket *>(s_TxBuffer);
 
 	pAckPacket->OpCode = __builtin_bswap16(OP_CODE_ACK);
 	pAckPacket->BlockNumber =  __builtin_bswap16(m_nBlockNumber);
 	m_nState = m_bIsLastBlock ? TFTPState::INIT : TFTPState::WRQ_RECV_PACKET;
+	m_nWindowCount = 0;
 
 	DEBUG_PRINTF("Sending to " IPSTR ":%d, m_nState=%d", IP2STR(m_nFromIp), m_nFromPort, static_cast<int>(m_nState));
 
-	Network::Get()->SendTo(m_nIdx, m_pBuffer, sizeof(struct tftp::AckPacket), m_nFromIp, m_nFromPort);
+	Network::Get()->SendTo(m_nIdx, s_TxBuffer, sizeof(struct tftp::AckPacket), m_nFromIp, m_nFromPort);
 }
 
+/**
+ * An ACK is sent after each window of blocks, and for the last block.
+ * When a block of the window is lost, the last block received in sequence is acknowledged once,
+ * and the client continues from there.
+ */
 void TFTPDaemon::HandleRecvData() {
 	const auto *const pDataPacket = reinterpret_cast<struct tftp::DataPacket *>(m_pBuffer);
 	assert(pDataPacket != nullptr);
 
-	if (pDataPacket->OpCode == __builtin_bswap16(OP_CODE_DATA)) {
-		m_nDataLength = m_nLength - 4;
-		m_nBlockNumber = __builtin_bswap16(pDataPacket->BlockNumber);
+	if (pDataPacket->OpCode == __builtin_bswap16(OP_CODE_ERROR)) {
+		DEBUG_PUTS("Error from client");
+		m_nState = TFTPState::INIT;
+		return;
+	}
+
+	if (pDataPacket->OpCode != __builtin_bswap16(OP_CODE_DATA)) {
+		return;
+	}
 
-		DEBUG_PRINTF("Incoming from " IPSTR ", m_nLength=%u, m_nBlockNumber=%d, m_nDataLength=%u", IP2STR(m_nFromIp), m_nLength, m_nBlockNumber, m_nDataLength);
+	const auto nBlockNumber = __builtin_bswap16(pDataPacket->BlockNumber);
 
-		if (m_nDataLength == FileWrite(pDataPacket->Data, m_nDataLength, m_nBlockNumber)) {
+	if (nBlockNumber != static_cast<uint16_t>(m_nBlockNumber + 1U)) {
+		DEBUG_PRINTF("Out of order BlockNumber=%u, m_nBlockNumber=%u", nBlockNumber, m_nBlockNumber);
+		s_Stats.nOutOfOrder++;
 
-			if (m_nDataLength < tftp::max::DATA_LEN) {
-				m_bIsLastBlock = true;
-				FileClose();
-			}
+		if (nBlockNumber == m_nBlockNumber) {
+			// Retransmitted, the ACK for this block is lost
+			DoWriteAck();
+		} else if ((static_cast<uint16_t>(nBlockNumber - m_nBlockNumber) <= m_nWindowSize) && !m_bIsOutOfOrderAcked) {
+			// A block of the window is lost
+			m_bIsOutOfOrderAcked = true;
+			DoWriteAck();
+		}
+		return;
+	}
 
+	m_nBlockNumber = nBlockNumber;
+	m_nDataLength = m_nLength - tftp::DATA_HEADER_LEN;
+	m_bIsOutOfOrderAcked = false;
+
+	DEBUG_PRINTF("Incoming from " IPSTR ", m_nLength=%u, m_nBlockNumber=%d, m_nDataLength=%u", IP2STR(m_nFromIp), m_nLength, m_nBlockNumber, m_nDataLength);
+
+	if (m_nDataLength == FileWrite(pDataPacket->Data, m_nDataLength, m_nBlockNumber)) {
+		s_Stats.nBlocks++;
+		m_nBytes += m_nDataLength;
+
+		if (m_nDataLength < m_nBlockSize) {
+			m_bIsLastBlock = true;
+			FileClose();
+			TransferDone();
+		}
+
+		if (m_bIsLastBlock || (++m_nWindowCount >= m_nWindowSize)) {
 			DoWriteAck();
-		} else {
-			SendError(ERROR_CODE_DISK_FULL, "Write failed");
-			m_nState = TFTPState::INIT;
 		}
+	} else {
+		SendError(ERROR_CODE_DISK_FULL, "Write failed");
+		m_nState = TFTPState::INIT;
 	}
 }
@@ -59,11 +59,13 @@
 
 #include "debug.h"
 
-#if !defined ARP_MAX_RECORDS
-static constexpr auto MAX_RECORDS = 16;
-#else
-static constexpr auto MAX_RECORDS = ARP_MAX_RECORDS;
-#endif
+/*
+ * Open addressing with linear probing, the table is kept at most 3/4 full.
+ */
+static constexpr uint32_t MAX_RECORDS = ARP_MAX_RECORDS;
+static constexpr uint32_t MAX_LOAD = (MAX_RECORDS * 3) / 4;
+static constexpr uint32_t RECORDS_MASK = MAX_RECORDS - 1;
+static_assert((MAX_RECORDS & RECORDS_MASK) == 0, "ARP_MAX_RECORDS must be a power of 2");
 
 namespace net {
 namespace globals {
@@ -75,14 +77,22 @@ static constexpr uint32_t TIMER_INTERVAL	= 1000;			///< 1 second
 static constexpr uint32_t MAX_PROBING 		= 2;			///< 2 * 1 second
 static constexpr uint32_t MAX_REACHABLE 	= (10 * 60);	///< (10 * 60) * 1 second = 10 minutes
 static constexpr uint32_t MAX_STALE 		= ( 5 * 60);	///< ( 5 * 60) * 1 second =  5 minutes
+static constexpr uint32_t REFRESH_BEFORE	= 30;			///< Unicast request 30 seconds before REACHABLE expires
 
 enum class State {
 	STATE_EMPTY, STATE_PROBE, STATE_REACHABLE, STATE_STALE,
 };
 
+/*
+ * Frames waiting for the ARP reply, taken from a pool shared by all records.
+ * The index is 1-based, PACKET_NONE terminates a list.
+ */
+static constexpr uint8_t PACKET_NONE = 0;
+
 struct Packet {
-	uint8_t *p;
-	uint32_t nSize;
+	uint8_t data[sizeof(struct t_udp)] ALIGNED;
+	uint16_t nSize;
+	uint8_t nNext;
 #if defined CONFIG_ENET_ENABLE_PTP
 	bool isTimestamp;
 #endif
@@ -90,14 +100,21 @@ struct Packet {
 
 struct Record {
 	uint32_t nIp;
-	Packet packet;
 	uint8_t mac_address[ETH_ADDR_LEN];
 	uint16_t nAge;
 	State state;
+	uint8_t nPendingHead;
+	uint8_t nPendingTail;
+	uint8_t nPendingCount;
+	bool isUsed;	///< A frame was sent to this destination since the last refresh
 };
 }  // namespace arp
 
 static net::arp::Record s_ArpRecords[MAX_RECORDS] SECTION_NETWORK ALIGNED;
+static net::arp::Packet s_ArpPackets[ARP_PENDING_ENTRIES] SECTION_NETWORK ALIGNED;
+static uint8_t s_nPacketFree SECTION_NETWORK;
+static uint32_t s_nRecords SECTION_NETWORK;
+static struct net::arp::Stats s_Stats SECTION_NETWORK;
 
 static struct t_arp s_arp_request ALIGNED ;
 static struct t_arp s_arp_reply ALIGNED;
@@ -106,16 +123,16 @@ static struct t_arp s_arp_reply ALIGNED;
 static constexpr char STATE[4][12] = { "EMPTY", "PROBE", "REACHABLE", "STALE", };
 
 void static arp_cache_record_dump(net::arp::Record *pRecord) {
-	printf("%p %-4d %c " MACSTR " %-10s " IPSTR  "\n", pRecord, pRecord->nAge, pRecord->packet.p == nullptr ? '-' : 'Q' , MAC2STR(pRecord->mac_address), STATE[static_cast<unsigned>(pRecord->state)], IP2STR(pRecord->nIp));
+	printf("%p %-4d %u " MACSTR " %-10s " IPSTR  "\n", pRecord, pRecord->nAge, pRecord->nPendingCount, MAC2STR(pRecord->mac_address), STATE[static_cast<unsigned>(pRecord->state)], IP2STR(pRecord->nIp));
 }
 
 void static arp_cache_dump() {
 	uint32_t nIndex = 0;
 	for (auto &record : s_ArpRecords) {
-		printf("%p %02d %-4d" MACSTR " %-10s " IPSTR  "\n", &record, nIndex++, record.nAge, MAC2STR(record.mac_address), STATE[static_cast<unsigned>(record.state)], IP2STR(record.nIp));
-		if (nIndex ==6) {
-			return;
+		if (record.state != net::arp::State::STATE_EMPTY) {
+			printf("%p %02d %-4d" MACSTR " %-10s " IPSTR  "\n", &record, nIndex, record.nAge, MAC2STR(record.mac_address), STATE[static_cast<unsigned>(record.state)], IP2STR(record.nIp));
 		}
+		nIndex++;
 	}
 }
 #else
@@ -123,60 +140,230 @@ void static arp_cache_record_dump([[maybe_unused]] net::arp::Record *pRecord) {}
 void static arp_cache_dump() {}
 #endif
 
-static net::arp::Record *arp_find_record(const uint32_t nDestinationIp, [[maybe_unused]] const arp::Flags flag) {
+static net::arp::Packet *arp_packet(const uint8_t nIndex) {
+	assert(nIndex != net::arp::PACKET_NONE);
+	assert(nIndex <= ARP_PENDING_ENTRIES);
+	return &s_ArpPackets[nIndex - 1];
+}
+
+static void arp_packet_pool_init() {
+	for (uint32_t i = 0; i < ARP_PENDING_ENTRIES; i++) {
+		s_ArpPackets[i].nNext = static_cast<uint8_t>((i + 1 < ARP_PENDING_ENTRIES) ? (i + 2) : net::arp::PACKET_NONE);
+	}
+
+	s_nPacketFree = 1;
+}
+
+/**
+ * Remove the oldest pending packet of the record and return it to the pool
+ */
+static void arp_pending_free_head(net::arp::Record *pRecord) {
+	const auto nIndex = pRecord->nPendingHead;
+	assert(nIndex != net::arp::PACKET_NONE);
+
+	auto *pPacket = arp_packet(nIndex);
+
+	pRecord->nPendingHead = pPacket->nNext;
+	pRecord->nPendingCount--;
+
+	if (pRecord->nPendingHead == net::arp::PACKET_NONE) {
+		pRecord->nPendingTail = net::arp::PACKET_NONE;
+	}
+
+	pPacket->nNext = s_nPacketFree;
+	s_nPacketFree = nIndex;
+}
+
+static void arp_pending_release(net::arp::Record *pRecord) {
+	while (pRecord->nPendingHead != net::arp::PACKET_NONE) {
+		arp_pending_free_head(pRecord);
+		s_Stats.nPendingDropped++;
+	}
+}
+
+/**
+ * Append a copy of the frame to the pending queue of the record.
+ * When the record already holds ARP_PENDING_PER_RECORD frames, the oldest is dropped.
+ * When the pool is empty, the new frame is dropped.
+ */
+template<net::arp::EthSend S>
+static void arp_pending_add(net::arp::Record *pRecord, const struct t_udp *pFrame, const uint32_t nSize) {
+	assert(nSize <= sizeof(net::arp::Packet::data));
+
+	if (pRecord->nPendingCount == ARP_PENDING_PER_RECORD) {
+		arp_pending_free_head(pRecord);
+		s_Stats.nPendingDropped++;
+	}
+
+	const auto nIndex = s_nPacketFree;
+
+	if (__builtin_expect((nIndex == net::arp::PACKET_NONE), 0)) {
+		s_Stats.nPendingDropped++;
+		s_Stats.nPoolEmpty++;
+		return;
+	}
+
+	auto *pPacket = arp_packet(nIndex);
+	s_nPacketFree = pPacket->nNext;
+
+	net::memcpy(pPacket->data, pFrame, nSize);
+	pPacket->nSize = static_cast<uint16_t>(nSize);
+	pPacket->nNext = net::arp::PACKET_NONE;
+#if defined CONFIG_ENET_ENABLE_PTP
+	pPacket->isTimestamp = (S != net::arp::EthSend::IS_NORMAL);
+#endif
+
+	if (pRecord->nPendingTail == net::arp::PACKET_NONE) {
+		pRecord->nPendingHead = nIndex;
+	} else {
+		arp_packet(pRecord->nPendingTail)->nNext = nIndex;
+	}
+
+	pRecord->nPendingTail = nIndex;
+	pRecord->nPendingCount++;
+
+	s_Stats.nPendingQueued++;
+}
+
+/**
+ * The destination is resolved, send the pending frames in the order they were queued
+ */
+static void arp_pending_send(net::arp::Record *pRecord) {
+	while (pRecord->nPendingHead != net::arp::PACKET_NONE) {
+		auto *pPacket = arp_packet(pRecord->nPendingHead);
+		auto *udp = reinterpret_cast<struct t_udp *>(pPacket->data);
+
+		std::memcpy(udp->ether.dst, pRecord->mac_address, ETH_ADDR_LEN);
+#if defined CONFIG_ENET_ENABLE_PTP
+		if (!pPacket->isTimestamp) {
+#endif
+			emac_eth_send(pPacket->data, pPacket->nSize);
+#if defined CONFIG_ENET_ENABLE_PTP
+		} else {
+			emac_eth_send_timestamp(pPacket->data, pPacket->nSize);
+		}
+#endif
+		arp_pending_free_head(pRecord);
+		s_Stats.nPendingSent++;
+	}
+}
+
+/**
+ * Fibonacci hashing, the upper bits of the product are well mixed.
+ */
+static inline uint32_t arp_hash(const uint32_t nIp) {
+	return ((nIp * 2654435761U) >> 16) & RECORDS_MASK;
+}
+
+/**
+ * Backward shift deletion, no tombstones are needed with linear probing.
+ * A record in the probe sequence after the hole is moved into the hole
+ * when its home slot is not between the hole and its current slot.
+ */
+static void arp_cache_remove(const uint32_t nIndex) {
+	arp_pending_release(&s_ArpRecords[nIndex]);
+
+	auto nHole = nIndex;
+	auto nNext = (nIndex + 1) & RECORDS_MASK;
+
+	while (s_ArpRecords[nNext].state != net::arp::State::STATE_EMPTY) {
+		const auto nHome = arp_hash(s_ArpRecords[nNext].nIp);
+
+		if (((nNext - nHome) & RECORDS_MASK) >= ((nNext - nHole) & RECORDS_MASK)) {
+			s_ArpRecords[nHole] = s_ArpRecords[nNext];
+			nHole = nNext;
+		}
+
+		nNext = (nNext + 1) & RECORDS_MASK;
+	}
+
+	memset(&s_ArpRecords[nHole], 0, sizeof(struct net::arp::Record));
+
+	assert(s_nRecords != 0);
+	s_nRecords--;
+}
+
+/**
+ * The table is at its maximum load, remove the oldest STALE record or else the oldest REACHABLE record.
+ * Only a new destination can get here.
+ */
+static void arp_cache_evict() {
 	DEBUG_ENTRY
 
-	net::arp::Record *pStale = nullptr;
-	net::arp::Record *pReachable = nullptr;
+	uint32_t nStale = MAX_RECORDS;
+	uint32_t nReachable = MAX_RECORDS;
 	uint32_t nAgeStale = 0;
 	uint32_t nAgeReachable = 0;
 
-	for (auto &record : s_ArpRecords) {
-		if (record.nIp == nDestinationIp) {
-			DEBUG_EXIT
-			return &record;
-		}
+	for (uint32_t nIndex = 0; nIndex < MAX_RECORDS; nIndex++) {
+		const auto &record = s_ArpRecords[nIndex];
 
-		if (flag == arp::Flags::FLAG_UPDATE) {
-			continue;
+		if ((record.state == net::arp::State::STATE_STALE) && (record.nAge >= nAgeStale)) {
+			nAgeStale = record.nAge;
+			nStale = nIndex;
+		} else if ((record.state == net::arp::State::STATE_REACHABLE) && (record.nAge >= nAgeReachable)) {
+			nAgeReachable = record.nAge;
+			nReachable = nIndex;
 		}
+	}
+
+	const auto nIndex = (nStale != MAX_RECORDS) ? nStale : nReachable;
+
+	if (nIndex != MAX_RECORDS) {
+		arp_cache_remove(nIndex);
+		s_Stats.nEvictions++;
+	}
+
+	DEBUG_EXIT
+}
+
+static net::arp::Record *arp_find_record(const uint32_t nDestinationIp, const arp::Flags flag) {
+	DEBUG_ENTRY
+
+	auto nIndex = arp_hash(nDestinationIp);
+
+	for (uint32_t i = 0; i < MAX_RECORDS; i++) {
+		auto &record = s_ArpRecords[nIndex];
 
 		if (record.state == net::arp::State::STATE_EMPTY) {
-			record.nIp = nDestinationIp;
+			break;
+		}
+
+		if (record.nIp == nDestinationIp) {
 			DEBUG_EXIT
 			return &record;
 		}
 
-		if (record.state == net::arp::State::STATE_REACHABLE) {
-			if (record.nAge > nAgeReachable) {
-				nAgeReachable = record.nAge;
-				pReachable = &record;
-			}
-			continue;
-		}
+		nIndex = (nIndex + 1) & RECORDS_MASK;
+	}
 
+	if (flag == arp::Flags::FLAG_UPDATE) {
+		DEBUG_EXIT
+		return nullptr;
+	}
 
-		if (record.state == net::arp::State::STATE_STALE) {
-			if (record.nAge > nAgeStale) {
-				nAgeStale = record.nAge;
-				pStale = &record;
-			}
-			continue;
+	if (s_nRecords >= MAX_LOAD) {
+		arp_cache_evict();
+
+		if (s_nRecords >= MAX_LOAD) {
+			DEBUG_EXIT
+			return nullptr;	// All records are probing
 		}
 	}
 
-	if (pStale != nullptr) {
-		DEBUG_EXIT
-		return pStale;
-	}
+	nIndex = arp_hash(nDestinationIp);
 
-	if (pReachable != nullptr) {
-		DEBUG_EXIT
-		return pReachable;
+	while (s_ArpRecords[nIndex].state != net::arp::State::STATE_EMPTY) {
+		nIndex = (nIndex + 1) & RECORDS_MASK;
 	}
 
+	/* The caller sets the state */
+	auto &record = s_ArpRecords[nIndex];
+	record.nIp = nDestinationIp;
+	s_nRecords++;
+
 	DEBUG_EXIT
-	return nullptr;
+	return &record;
 }
 
 static void arp_cache_update(const uint8_t *pMacAddress, const uint32_t nIp, const arp::Flags flag) {
@@ -186,7 +373,6 @@ static void arp_cache_update(const uint8_t *pMacAddress, const uint32_t nIp, con
 	auto *record = arp_find_record(nIp, flag);
 
 	if (record == nullptr) {
-		assert(flag == arp::Flags::FLAG_UPDATE);
 		DEBUG_EXIT
 		return;
 	}
@@ -197,25 +383,7 @@ static void arp_cache_update(const uint8_t *pMacAddress, const uint32_t nIp, con
 
 	arp_cache_record_dump(record);
 
-	if (record->packet.p != nullptr) {
-		auto *udp = reinterpret_cast<struct t_udp *>(record->packet.p);
-		std::memcpy(udp->ether.dst, record->mac_address, ETH_ADDR_LEN);
-		udp->ip4.chksum = 0;
-#if !defined (CHECKSUM_BY_HARDWARE)
-		udp->ip4.chksum = net_chksum(reinterpret_cast<void *>(&udp->ip4), sizeof(udp->ip4));
-#endif
-#if defined CONFIG_ENET_ENABLE_PTP
-		if (!record->packet.isTimestamp) {
-#endif
-			emac_eth_send(record->packet.p, record->packet.nSize);
-#if defined CONFIG_ENET_ENABLE_PTP
-		} else {
-			emac_eth_send_timestamp(record->packet.p, record->packet.nSize);
-		}
-#endif
-		delete [] record->packet.p;
-		record->packet.p = nullptr;
-	}
+	arp_pending_send(record);
 
 	DEBUG_EXIT
 }
@@ -234,10 +402,17 @@ static void arp_query(const uint32_t nDestinationIp, struct t_udp *pPacket, cons
 	DEBUG_PRINTF(IPSTR " %c", IP2STR(nDestinationIp), flag == arp::Flags::FLAG_UPDATE ? 'U' : 'I');
 
 	auto *recordFound = arp_find_record(nDestinationIp, flag);
-	assert(recordFound != nullptr);
+
+	if (__builtin_expect((recordFound == nullptr), 0)) {
+		s_Stats.nPendingDropped++;
+		DEBUG_EXIT
+		return;
+	}
 
 	arp_cache_record_dump(recordFound);
 
+	recordFound->isUsed = true;
+
 	if (recordFound->state == net::arp::State::STATE_EMPTY) {
 		recordFound->state = net::arp::State::STATE_PROBE;
 		recordFound->nAge = 0;
@@ -245,30 +420,12 @@ static void arp_query(const uint32_t nDestinationIp, struct t_udp *pPacket, cons
 	}
 
 	if (recordFound->state == net::arp::State::STATE_PROBE) {
-		if (recordFound->packet.p != nullptr) {
-			delete[] recordFound->packet.p;
-		}
-
-		recordFound->packet.p = new uint8_t[nSize];
-		assert(recordFound->packet.p != nullptr);
-
-		net::memcpy(recordFound->packet.p, pPacket, nSize);
-		recordFound->packet.nSize = nSize;
-#if defined CONFIG_ENET_ENABLE_PTP
-		recordFound->packet.isTimestamp = (S != net::arp::EthSend::IS_NORMAL);
-#endif
+		arp_pending_add<S>(recordFound, pPacket, nSize);
 	}
 
 	DEBUG_EXIT
 }
 
-static void arp_cache_clean_record(net::arp::Record& record) {
-	if (record.packet.p != nullptr) {
-		delete[] record.packet.p;
-	}
-	memset(&record, 0, sizeof(struct net::arp::Record));
-}
-
 static void arp_send_request_unicast(const uint32_t nIp, const uint8_t *pMacAddress) {
 	DEBUG_PRINTF(IPSTR, IP2STR(nIp));
 
@@ -287,14 +444,19 @@ static void arp_timer() {
 			record.nAge++;
 
 			switch (state) {
-			case net::arp::State::STATE_PROBE:
-				if (record.nAge > net::arp::MAX_PROBING) {
-					arp_cache_clean_record(record);
-				}
-				break;
-
 			case net::arp::State::STATE_REACHABLE:
-				if (record.nAge > net::arp::MAX_REACHABLE) {
+				/*
+				 * Refresh while the record is still REACHABLE, the reply resets the age.
+				 * Sending is never blocked on ARP for an active destination.
+				 * A record not used since the last refresh is left to become STALE.
+				 */
+				if (record.nAge == (net::arp::MAX_REACHABLE - net::arp::REFRESH_BEFORE)) {
+					if (record.isUsed) {
+						record.isUsed = false;
+						arp_send_request_unicast(record.nIp, record.mac_address);
+						s_Stats.nRefreshes++;
+					}
+				} else if (record.nAge > net::arp::MAX_REACHABLE) {
 					record.state = net::arp::State::STATE_STALE;
 					record.nAge = 0;
 				}
@@ -303,7 +465,14 @@ static void arp_timer() {
 			case net::arp::State::STATE_STALE:
 				if (record.nAge > net::arp::MAX_STALE) {
 					record.state = net::arp::State::STATE_PROBE;
-					arp_send_request_unicast(record.nIp, record.mac_address);
+
+					if (record.isUsed) {
+						record.isUsed = false;
+						record.nAge = 0;
+						arp_send_request_unicast(record.nIp, record.mac_address);
+					} else {
+						record.nAge = net::arp::MAX_PROBING + 1;	// Not used, removed below
+					}
 				}
 				break;
 
@@ -313,6 +482,19 @@ static void arp_timer() {
 		}
 	}
 
+	/*
+	 * Remove the records without a reply. A removal can move a record into the current slot.
+	 */
+	for (uint32_t nIndex = 0; nIndex < MAX_RECORDS;) {
+		const auto &record = s_ArpRecords[nIndex];
+
+		if ((record.state == net::arp::State::STATE_PROBE) && (record.nAge > net::arp::MAX_PROBING)) {
+			arp_cache_remove(nIndex);
+		} else {
+			nIndex++;
+		}
+	}
+
 	arp_cache_dump();
 }
 
@@ -341,6 +523,10 @@ void __attribute__((cold)) arp_init() {
 		std::memset(&record, 0, sizeof(struct net::arp::Record));
 	}
 
+	s_nRecords = 0;
+
+	arp_packet_pool_init();
+
 	// ARP Request template
 	// Ethernet header
 	std::memcpy(s_arp_request.ether.src, net::globals::netif_default.hwaddr, ETH_ADDR_LEN);
@@ -425,6 +611,47 @@ __attribute__((hot)) void arp_handle(struct t_arp *pArp) {
 	}
 }
 
+static uint32_t arp_next_hop(const uint32_t nRemoteIp) {
+	if  (__builtin_expect((net::globals::nOnNetworkMask != (nRemoteIp & net::globals::nOnNetworkMask)), 0)) {
+	      /* According to RFC 3297, chapter 2.6.2 (Forwarding Rules), a packet with
+	         a link-local source address must always be "directly to its destination
+	         on the same physical link. The host MUST NOT send the packet to any
+	         router for forwarding". */
+		if (!network::is_linklocal_ip(nRemoteIp)) {
+			DEBUG_PUTS("");
+			return net::globals::netif_default.gw.addr;
+		}
+	}
+
+	return nRemoteIp;
+}
+
+static const uint8_t *arp_lookup(const uint32_t nDestinationIp) {
+	auto nIndex = arp_hash(nDestinationIp);
+
+	for (uint32_t i = 0; i < MAX_RECORDS; i++) {
+		auto &record = s_ArpRecords[nIndex];
+
+		if (record.state == net::arp::State::STATE_EMPTY) {
+			break;
+		}
+
+		if (record.nIp == nDestinationIp) {
+			if (__builtin_expect((record.state >= net::arp::State::STATE_REACHABLE), 1)) {
+				record.isUsed = true;
+				s_Stats.nHits++;
+				return record.mac_address;
+			}
+			break;
+		}
+
+		nIndex = (nIndex + 1) & RECORDS_MASK;
+	}
+
+	s_Stats.nMisses++;
+	return nullptr;
+}
+
 template<net::arp::EthSend S>
 static void arp_send_implementation(struct t_udp *pPacket, const uint32_t nSize, const uint32_t nRemoteIp) {
 	DEBUG_ENTRY
@@ -436,36 +663,22 @@ static void arp_send_implementation(struct t_udp *pPacket, const uint32_t nSize,
 	pPacket->ip4.chksum = net_chksum(reinterpret_cast<void *>(&pPacket->ip4), sizeof(pPacket->ip4));
 #endif
 
-	auto nDestinationIp = nRemoteIp;
-
-	if  (__builtin_expect((net::globals::nOnNetworkMask != (nRemoteIp & net::globals::nOnNetworkMask)), 0)) {
-	      /* According to RFC 3297, chapter 2.6.2 (Forwarding Rules), a packet with
-	         a link-local source address must always be "directly to its destination
-	         on the same physical link. The host MUST NOT send the packet to any
-	         router for forwarding". */
-		if (!network::is_linklocal_ip(nRemoteIp)) {
-			nDestinationIp = net::globals::netif_default.gw.addr;
-			DEBUG_PUTS("");
-		}
-	}
+	const auto nDestinationIp = arp_next_hop(nRemoteIp);
+	const auto *pMacAddress = arp_lookup(nDestinationIp);
 
-	for (auto &record : s_ArpRecords) {
-		if (record.state >= net::arp::State::STATE_REACHABLE) {
-			if (record.nIp == nDestinationIp) {
-				std::memcpy(pPacket->ether.dst, record.mac_address, ETH_ADDR_LEN);
+	if (pMacAddress != nullptr) {
+		std::memcpy(pPacket->ether.dst, pMacAddress, ETH_ADDR_LEN);
 
-				if (S == net::arp::EthSend::IS_NORMAL) {
-					emac_eth_send(reinterpret_cast<void *>(pPacket), nSize);
-				}
+		if (S == net::arp::EthSend::IS_NORMAL) {
+			emac_eth_send(reinterpret_cast<void *>(pPacket), nSize);
+		}
 #if defined CONFIG_ENET_ENABLE_PTP
-				else if (S == net::arp::EthSend::IS_TIMESTAMP) {
-					emac_eth_send_timestamp(reinterpret_cast<void *>(pPacket), nSize);
-				}
-#endif
-				DEBUG_EXIT
-				return;
-			}
+		else if (S == net::arp::EthSend::IS_TIMESTAMP) {
+			emac_eth_send_timestamp(reinterpret_cast<void *>(pPacket), nSize);
 		}
+#endif
+		DEBUG_EXIT
+		return;
 	}
 
 	arp_query<S>(nDestinationIp, pPacket, nSize, arp::Flags::FLAG_INSERT);
@@ -484,6 +697,17 @@ void arp_send_timestamp(struct t_udp *pPacket, const uint32_t nSize, const uint3
 }
 #endif
 
+/**
+ * @return MAC address of the next hop, nullptr when not resolved (yet)
+ */
+const uint8_t *arp_cache_lookup(const uint32_t nRemoteIp) {
+	return arp_lookup(arp_next_hop(nRemoteIp));
+}
+
+void arp_get_stats(arp::Stats& stats) {
+	stats = s_Stats;
+}
+
 /*
  *  The Sender IP is set to all zeros,
  *  which means it cannot map to the Sender MAC address.
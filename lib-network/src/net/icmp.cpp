@@ -53,27 +53,30 @@ __attribute__((hot)) void icmp_handle(struct t_icmp *p_icmp) {
 			std::memcpy(p_icmp->ether.dst, p_icmp->ether.src, ETH_ADDR_LEN);
 			std::memcpy(p_icmp->ether.src, globals::netif_default.hwaddr, ETH_ADDR_LEN);
 			// IPv4
-			p_icmp->ip4.id = static_cast<uint16_t>(~p_icmp->ip4.id);
+			const auto nId = p_icmp->ip4.id;
+			p_icmp->ip4.id = static_cast<uint16_t>(~nId);
 
 			const auto nIpDestination = net::memcpy_ip(p_icmp->ip4.dst);
+			const auto nIpSource = (nIpDestination == globals::netif_default.secondary_ip.addr) ? globals::netif_default.secondary_ip.addr : globals::netif_default.ip.addr;
 
 			std::memcpy(p_icmp->ip4.dst, p_icmp->ip4.src, IPv4_ADDR_LEN);
-
-			if (nIpDestination == globals::netif_default.secondary_ip.addr) {
-				net::memcpy_ip(p_icmp->ip4.src, globals::netif_default.secondary_ip.addr);
-			} else {
-				net::memcpy_ip(p_icmp->ip4.src, globals::netif_default.ip.addr);
-			}
-
-			p_icmp->ip4.chksum = 0;
+			net::memcpy_ip(p_icmp->ip4.src, nIpSource);
 #if !defined (CHECKSUM_BY_HARDWARE)
-			p_icmp->ip4.chksum = net_chksum(reinterpret_cast<void *>(&p_icmp->ip4), 20); //TODO
+			/*
+			 * The checksums are updated incrementally (RFC 1624).
+			 * The addresses are swapped, only a different source address changes the sum.
+			 */
+			auto nChksum = net_chksum_adjust(p_icmp->ip4.chksum, nId, static_cast<uint16_t>(~nId));
+			nChksum = net_chksum_adjust(nChksum, static_cast<uint16_t>(nIpDestination), static_cast<uint16_t>(nIpSource));
+			nChksum = net_chksum_adjust(nChksum, static_cast<uint16_t>(nIpDestination >> 16), static_cast<uint16_t>(nIpSource >> 16));
+			p_icmp->ip4.chksum = nChksum;
 #endif
 			// ICMP
 			p_icmp->icmp.type = ICMP_TYPE_ECHO_REPLY;
-			p_icmp->icmp.checksum = 0;
 #if !defined (CHECKSUM_BY_HARDWARE)
-			p_icmp->icmp.checksum = net_chksum(reinterpret_cast<void *>(&p_icmp->ip4), static_cast<uint32_t>(__builtin_bswap16(p_icmp->ip4.len)));
+			p_icmp->icmp.checksum = net_chksum_adjust(p_icmp->icmp.checksum, ICMP_TYPE_ECHO | (ICMP_CODE_ECHO << 8), ICMP_TYPE_ECHO_REPLY | (ICMP_CODE_ECHO << 8));
+#else
+			p_icmp->icmp.checksum = 0;
 #endif
 			emac_eth_send(reinterpret_cast<void *>(p_icmp), static_cast<uint32_t>(sizeof(struct ether_header) + __builtin_bswap16(p_icmp->ip4.len)));
 		}
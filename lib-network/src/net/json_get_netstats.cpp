@@ -0,0 +1,192 @@
+/**
+ * @file json_get_netstats.cpp
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cassert>
+
+#include "../../config/net_config.h"
+
+#include "net.h"
+#include "emac/emac.h"
+#include "net/arp.h"
+#include "net/tcp.h"
+#include "net/udp.h"
+#if defined (ENABLE_TFTP_SERVER)
+# include "net/apps/tftpdaemon.h"
+#endif
+
+namespace remoteconfig {
+namespace net {
+/*
+ * snprintf returns the length it would have written, only what fits in the buffer is used.
+ */
+static uint32_t fitted(const int nLength, const uint32_t nBufferSize) {
+	if ((nLength <= 0) || (nBufferSize == 0)) {
+		return 0;
+	}
+
+	return std::min(static_cast<uint32_t>(nLength), nBufferSize - 1);
+}
+
+static uint32_t get_rx(char *pOutBuffer, const uint32_t nOutBufferSize) {
+	::net::rx::Stats rxStats;
+	::net::net_get_rx_stats(rxStats);
+
+	::net::emac::Stats emacStats;
+	emac_get_stats(emacStats);
+
+	const auto nLength = fitted(snprintf(pOutBuffer, nOutBufferSize,
+			"\"rx\":{\"batch_max\":%u,\"batch_high_water\":%u,\"budget_exhausted\":%u},"
+			"\"emac\":{\"rx_pending_high_water\":%u,\"rx_buffer_unavailable\":%u,\"rx_overflow\":%u,"
+			"\"tx_ring_full\":%u,\"tx_dropped\":%u,\"tx_batch_high_water\":%u},",
+			static_cast<unsigned int>(NET_RX_BATCH_MAX),
+			static_cast<unsigned int>(rxStats.nBatchHighWater),
+			static_cast<unsigned int>(rxStats.nBudgetExhausted),
+			static_cast<unsigned int>(emacStats.nRxPendingHighWater),
+			static_cast<unsigned int>(emacStats.nRxBufferUnavailable),
+			static_cast<unsigned int>(emacStats.nRxOverflow),
+			static_cast<unsigned int>(emacStats.nTxRingFull),
+			static_cast<unsigned int>(emacStats.nTxDropped),
+			static_cast<unsigned int>(emacStats.nTxBatchHighWater)), nOutBufferSize);
+
+	return nLength;
+}
+
+static uint32_t get_arp(char *pOutBuffer, const uint32_t nOutBufferSize) {
+	::net::arp::Stats stats;
+	::net::arp_get_stats(stats);
+
+	const auto nLength = fitted(snprintf(pOutBuffer, nOutBufferSize,
+			"\"arp\":{\"records\":%u,\"hits\":%u,\"misses\":%u,\"refreshes\":%u,\"evictions\":%u,"
+			"\"pending_entries\":%u,\"pending_queued\":%u,\"pending_sent\":%u,\"pending_dropped\":%u,\"pool_empty\":%u},",
+			static_cast<unsigned int>(ARP_MAX_RECORDS),
+			static_cast<unsigned int>(stats.nHits),
+			static_cast<unsigned int>(stats.nMisses),
+			static_cast<unsigned int>(stats.nRefreshes),
+			static_cast<unsigned int>(stats.nEvictions),
+			static_cast<unsigned int>(ARP_PENDING_ENTRIES),
+			static_cast<unsigned int>(stats.nPendingQueued),
+			static_cast<unsigned int>(stats.nPendingSent),
+			static_cast<unsigned int>(stats.nPendingDropped),
+			static_cast<unsigned int>(stats.nPoolEmpty)), nOutBufferSize);
+
+	return nLength;
+}
+
+#if defined (ENABLE_HTTPD)
+static uint32_t get_tcp(char *pOutBuffer, const uint32_t nOutBufferSize) {
+	::net::tcp::Stats stats;
+	::net::tcp_get_stats(stats);
+
+	const auto nLength = fitted(snprintf(pOutBuffer, nOutBufferSize,
+			"\"tcp\":{\"segments_sent\":%u,\"retransmits\":%u,\"fast_retransmits\":%u,\"queue_full\":%u,\"aborted\":%u},",
+			static_cast<unsigned int>(stats.nSegmentsSent),
+			static_cast<unsigned int>(stats.nRetransmits),
+			static_cast<unsigned int>(stats.nFastRetransmits),
+			static_cast<unsigned int>(stats.nQueueFull),
+			static_cast<unsigned int>(stats.nAborted)), nOutBufferSize);
+
+	return nLength;
+}
+#endif
+
+#if defined (ENABLE_TFTP_SERVER)
+static uint32_t get_tftp(char *pOutBuffer, const uint32_t nOutBufferSize) {
+	const auto& stats = TFTPDaemon::GetStats();
+	const auto nBytesPerSecond = (stats.nMillis == 0) ? 0 : static_cast<uint32_t>((static_cast<uint64_t>(stats.nBytes) * 1000U) / stats.nMillis);
+
+	const auto nLength = fitted(snprintf(pOutBuffer, nOutBufferSize,
+			"\"tftp\":{\"transfers\":%u,\"bytes\":%u,\"millis\":%u,\"bytes_per_second\":%u,\"blksize\":%u,\"windowsize\":%u,"
+			"\"blocks\":%u,\"retransmits\":%u,\"out_of_order\":%u},",
+			static_cast<unsigned int>(stats.nTransfers),
+			static_cast<unsigned int>(stats.nBytes),
+			static_cast<unsigned int>(stats.nMillis),
+			static_cast<unsigned int>(nBytesPerSecond),
+			static_cast<unsigned int>(stats.nBlockSize),
+			static_cast<unsigned int>(stats.nWindowSize),
+			static_cast<unsigned int>(stats.nBlocks),
+			static_cast<unsigned int>(stats.nRetransmits),
+			static_cast<unsigned int>(stats.nOutOfOrder)), nOutBufferSize);
+
+	return nLength;
+}
+#endif
+
+static uint32_t get_udp(char *pOutBuffer, const uint32_t nOutBufferSize) {
+	auto nLength = fitted(snprintf(pOutBuffer, nOutBufferSize,
+			"\"udp\":{\"no_port\":%u,\"ports\":[",
+			static_cast<unsigned int>(::net::udp_get_stats_no_port())), nOutBufferSize);
+
+	auto nPorts = 0U;
+
+	for (uint32_t nIndex = 0; (nIndex < UDP_MAX_PORTS_ALLOWED) && ((nLength + 1) < nOutBufferSize); nIndex++) {
+		::net::udp::Stats stats;
+
+		if (::net::udp_get_stats(nIndex, stats)) {
+			nLength += fitted(snprintf(&pOutBuffer[nLength], nOutBufferSize - nLength,
+					"{\"port\":%u,\"depth\":%u,\"high_water\":%u,\"received\":%u,\"overrun\":%u},",
+					static_cast<unsigned int>(stats.nPort),
+					static_cast<unsigned int>(stats.nDepth),
+					static_cast<unsigned int>(stats.nHighWater),
+					static_cast<unsigned int>(stats.nReceived),
+					static_cast<unsigned int>(stats.nOverrun)), nOutBufferSize - nLength);
+			nPorts++;
+		}
+	}
+
+	if ((nPorts != 0) && (pOutBuffer[nLength - 1] == ',')) {
+		nLength--;
+	}
+
+	nLength += fitted(snprintf(&pOutBuffer[nLength], nOutBufferSize - nLength, "]}"), nOutBufferSize - nLength);
+
+	return nLength;
+}
+
+uint32_t json_get_netstats(char *pOutBuffer, const uint32_t nOutBufferSize) {
+	const auto nBufferSize = nOutBufferSize - 1U;
+	pOutBuffer[0] = '{';
+
+	auto nLength = 1U;
+
+	nLength += get_rx(&pOutBuffer[nLength], nBufferSize - nLength);
+	nLength += get_arp(&pOutBuffer[nLength], nBufferSize - nLength);
+#if defined (ENABLE_HTTPD)
+	nLength += get_tcp(&pOutBuffer[nLength], nBufferSize - nLength);
+#endif
+#if defined (ENABLE_TFTP_SERVER)
+	nLength += get_tftp(&pOutBuffer[nLength], nBufferSize - nLength);
+#endif
+	nLength += get_udp(&pOutBuffer[nLength], nBufferSize - nLength);
+
+	pOutBuffer[nLength++] = '}';
+
+	assert(nLength <= nOutBufferSize);
+	return nLength;
+}
+}  // namespace net
+}  // namespace remoteconfig
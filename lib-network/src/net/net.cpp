@@ -44,17 +44,31 @@
 #include "net_private.h"
 
 #include "netif.h"
+#include "emac/emac.h"
 #include "net/acd.h"
 #include "net/dhcp.h"
 
 #include "debug.h"
 
 static struct net::acd::Acd s_acd;
+static struct net::rx::Stats s_rxStats;
 
 namespace network {
 __attribute__((weak)) void mdns_shutdown() {}
 }  // namespace network
 
+__attribute__((weak)) void emac_rx_stats_update() {}
+__attribute__((weak)) void emac_get_stats(net::emac::Stats& stats) {
+	stats = net::emac::Stats();
+}
+__attribute__((weak)) uint8_t *emac_eth_tx_reserve() {
+	return nullptr;
+}
+__attribute__((weak)) void emac_eth_tx_commit([[maybe_unused]] uint32_t nLength) {}
+__attribute__((weak)) void emac_eth_tx_flush() {}
+__attribute__((weak)) void emac_eth_tx_batch_begin() {}
+__attribute__((weak)) void emac_eth_tx_batch_end() {}
+
 namespace net {
 namespace globals {
 uint32_t nBroadcastMask;
@@ -157,10 +171,29 @@ void __attribute__((cold)) net_init(const net::Link link, ip4_addr_t ipaddr, ip4
 }
 
 __attribute__((hot)) void net_handle() {
-	uint8_t *s_p;
-	const auto nLength = emac_eth_recv(&s_p);
+#if defined (UDP_RX_ZERO_COPY)
+	udp_rx_release();
+#endif
+	emac_rx_stats_update();
+	emac_eth_tx_batch_begin();
+
+	uint32_t nFrames = 0;
+
+	while (nFrames < NET_RX_BATCH_MAX) {
+		uint8_t *s_p;
+		const auto nLength = emac_eth_recv(&s_p);
+
+		if (__builtin_expect((nLength == 0), 1)) {
+			break;
+		}
+
+		nFrames++;
+
+		if (__builtin_expect((nLength < 0), 0)) {
+			// A bad frame is already given back, the frames after it are handled in this batch
+			continue;
+		}
 
-	if (__builtin_expect((nLength > 0), 0)) {
 		const auto *const eth = reinterpret_cast<struct ether_header *>(s_p);
 
 #if defined (CONFIG_ENET_ENABLE_PTP)
@@ -178,5 +211,19 @@ __attribute__((hot)) void net_handle() {
 
 		emac_free_pkt();
 	}
+
+	emac_eth_tx_batch_end();
+
+	if (__builtin_expect((nFrames > s_rxStats.nBatchHighWater), 0)) {
+		s_rxStats.nBatchHighWater = nFrames;
+	}
+
+	if (__builtin_expect((nFrames == NET_RX_BATCH_MAX), 0)) {
+		s_rxStats.nBudgetExhausted++;
+	}
+}
+
+void net_get_rx_stats(net::rx::Stats& stats) {
+	stats = s_rxStats;
 }
 }  // namespace net
@@ -28,28 +28,88 @@
 #pragma GCC optimize ("no-tree-loop-distribute-patterns")
 
 #include <cstdint>
+#if defined (__ARM_NEON)
+# include <arm_neon.h>
+#endif
+
+#include "net_private.h"
 
 namespace net {
-uint16_t net_chksum(const void *data, uint32_t len) {
-	auto *ptr = reinterpret_cast<const uint16_t *>(data);
-	uint32_t sum = 0;
-
-	while (len > 1) {
-		sum += *ptr;
-		ptr++;
-		len -= 2;
+/*
+ * The data can be in the EMAC DMA buffers, which take aligned loads only.
+ * A leading halfword brings the pointer to a word boundary, then 32-bit
+ * words are accumulated in 64 bits; the end-around carries are folded at
+ * the end.
+ */
+uint32_t net_chksum_add(uint32_t nSum, const void *pData, uint32_t nLength) {
+	auto *p = reinterpret_cast<const uint8_t *>(pData);
+	uint64_t nSum64 = nSum;
+
+	if ((reinterpret_cast<uintptr_t>(p) & 2) && (nLength >= 2)) {
+		nSum64 += *reinterpret_cast<const uint16_t *>(p);
+		p += 2;
+		nLength -= 2;
 	}
 
-	/* Add left-over byte, if any */
-	if (len > 0) {
-		sum += __builtin_bswap16(static_cast<uint16_t>(*(reinterpret_cast<const uint8_t *>(ptr)) << 8));
+	const auto *p32 = reinterpret_cast<const uint32_t *>(p);
+
+#if defined (__ARM_NEON)
+	if (nLength >= 64) {
+		auto nAccumulator = vdupq_n_u64(0);
+
+		do {
+			const auto v0 = vld1q_u32(p32);
+			const auto v1 = vld1q_u32(p32 + 4);
+			const auto v2 = vld1q_u32(p32 + 8);
+			const auto v3 = vld1q_u32(p32 + 12);
+			nAccumulator = vpadalq_u32(nAccumulator, v0);
+			nAccumulator = vpadalq_u32(nAccumulator, v1);
+			nAccumulator = vpadalq_u32(nAccumulator, v2);
+			nAccumulator = vpadalq_u32(nAccumulator, v3);
+			p32 += 16;
+			nLength -= 64;
+		} while (nLength >= 64);
+
+		nSum64 += vgetq_lane_u64(nAccumulator, 0);
+		nSum64 += vgetq_lane_u64(nAccumulator, 1);
+	}
+#endif
+
+	while (nLength >= 16) {
+		nSum64 += p32[0];
+		nSum64 += p32[1];
+		nSum64 += p32[2];
+		nSum64 += p32[3];
+		p32 += 4;
+		nLength -= 16;
 	}
 
-	/* Fold 32-bit sum into 16 bits */
-	while (sum >> 16) {
-		sum = (sum >> 16) + (sum & 0xFFFF);
+	while (nLength >= 4) {
+		nSum64 += *p32++;
+		nLength -= 4;
 	}
 
-	return static_cast<uint16_t>(~sum);
+	p = reinterpret_cast<const uint8_t *>(p32);
+
+	if (nLength >= 2) {
+		nSum64 += *reinterpret_cast<const uint16_t *>(p);
+		p += 2;
+		nLength -= 2;
+	}
+
+	/* Add left-over byte, if any */
+	if (nLength > 0) {
+		nSum64 += *p;
+	}
+
+	/* Fold 64-bit sum into 32 bits */
+	nSum64 = (nSum64 >> 32) + (nSum64 & 0xFFFFFFFF);
+	nSum64 = (nSum64 >> 32) + (nSum64 & 0xFFFFFFFF);
+
+	return static_cast<uint32_t>(nSum64);
+}
+
+uint16_t net_chksum(const void *pData, uint32_t nLength) {
+	return net_chksum_finish(net_chksum_add(0, pData, nLength));
 }
 }  // namespace net
@@ -55,13 +55,38 @@ void emac_eth_send(void *, uint32_t);
 #if defined CONFIG_ENET_ENABLE_PTP
 void emac_eth_send_timestamp(void *, uint32_t);
 #endif
+/**
+ * @return the length of the frame, 0 when there is no frame, -1 for a bad frame which is already given back
+ */
 int emac_eth_recv(uint8_t **);
 void emac_free_pkt();
+bool emac_loan_pkt();
+void emac_release_pkt(const uint8_t *);
 
 namespace net {
 void net_handle();
 
 uint16_t net_chksum(const void *, uint32_t);
+/**
+ * One's complement sum, the data of all but the last call must have an even length
+ */
+uint32_t net_chksum_add(uint32_t, const void *, uint32_t);
+
+inline uint16_t net_chksum_finish(uint32_t nSum) {
+	/* Fold 32-bit sum into 16 bits */
+	nSum = (nSum >> 16) + (nSum & 0xFFFF);
+	nSum += (nSum >> 16);
+	return static_cast<uint16_t>(~nSum);
+}
+
+/**
+ * RFC 1624 incremental update, a 16-bit field changes from nOld to nNew
+ * HC' = ~(~HC + ~m + m')
+ */
+inline uint16_t net_chksum_adjust(const uint16_t nChksum, const uint16_t nOld, const uint16_t nNew) {
+	const uint32_t nSum = static_cast<uint16_t>(~nChksum) + static_cast<uint32_t>(static_cast<uint16_t>(~nOld)) + nNew;
+	return net_chksum_finish(nSum);
+}
 void net_timers_run();
 
 void ip_init();
@@ -72,6 +97,7 @@ void ip_handle(struct t_ip4 *);
 void udp_init();
 void udp_set_ip();
 void udp_handle(struct t_udp *);
+void udp_rx_release();
 void udp_shutdown();
 
 void igmp_init();
@@ -50,6 +50,7 @@
 #include "../config/net_config.h"
 
 #include "net.h"
+#include "net/tcp.h"
 #include "net/protocol/tcp.h"
 
 #include "net_memcpy.h"
@@ -66,6 +67,18 @@ namespace net {
 #define TCP_MAX_RX_WND 					(TCP_RX_MAX_ENTRIES * TCP_RX_MSS);
 #define TCP_TX_MSS						(TCP_DATA_SIZE)
 
+/*
+ * Retransmission timer, RFC 6298. The minimum RTO is 200ms instead of 1s,
+ * the node is used on a local network.
+ */
+static constexpr uint32_t TCP_TMR_INTERVAL		= 100;		///< Timer granularity G in ms
+static constexpr uint32_t TCP_RTO_INITIAL		= 1000;
+static constexpr uint32_t TCP_RTO_MIN			= 200;
+static constexpr uint32_t TCP_RTO_MAX			= 60000;
+static constexpr uint32_t TCP_MAX_RETRIES		= 8;
+static constexpr uint32_t TCP_DUP_ACK_THRESHOLD	= 3;		///< Fast retransmit, RFC 5681
+static constexpr uint32_t TCP_FIN_WAIT_TIMEOUT	= 10000;	///< FIN-WAIT-2 without a FIN from the peer
+
 /**
  * Transmission control block (TCB)
  */
@@ -101,6 +114,32 @@ struct tcb {
 		uint16_t size;
 	} TX;
 
+	/* Retransmission queue, the segment numbers are 1 based, 0 is none */
+	struct {
+		uint32_t SRTT;		/* smoothed round-trip time (ms) */
+		uint32_t RTTVAR;	/* round-trip time variation (ms) */
+		uint32_t RTO;		/* retransmission timeout (ms) */
+		uint32_t nTimer;	/* Millis() when the retransmission timer was (re)started */
+		uint32_t RttSeq;	/* round-trip time is measured until this sequence number is acknowledged */
+		uint32_t nRttStart;
+		uint32_t Recover;	/* SND.NXT at the retransmission timeout, RFC 6582 */
+		uint8_t nHead;		/* oldest segment */
+		uint8_t nTail;		/* newest segment */
+		uint8_t nUnsent;	/* first segment not sent yet */
+		uint8_t nRetries;
+		uint8_t nDupAcks;
+		bool isTiming;
+		bool isRecovering;	/* after a retransmission timeout, until RTX.Recover is acknowledged */
+	} RTX;
+
+	/* Congestion control, RFC 5681 */
+	uint32_t CWND;
+	uint32_t SSTHRESH;
+
+	uint32_t nConnectionId;		/* set when the connection is established */
+	uint32_t nLastReceived;		/* Millis() of the last acceptable segment */
+	bool isCloseRequested;		/* tcp_close(), the FIN is sent after the queued data */
+
 	/* Receive Sequence Variables */
 	struct {
 		uint32_t NXT; 	/* receive next */
@@ -137,9 +176,23 @@ struct Port {
 	uint16_t nLocalPort;
 };
 
+static constexpr uint8_t TX_SEGMENT_NONE = 0;
+
+struct TxSegment {
+	uint8_t data[TCP_DATA_SIZE];
+	uint32_t SEQ;
+	uint16_t nSize;
+	uint8_t CTL;
+	uint8_t nNext;		///< Next segment in the queue or in the free list
+};
+
 static struct Port s_Port[TCP_MAX_PORTS_ALLOWED] SECTION_NETWORK ALIGNED;
 static uint16_t s_id SECTION_NETWORK ALIGNED;
 static struct t_tcp s_tcp SECTION_NETWORK ALIGNED;
+static struct TxSegment s_TxSegments[TCP_TX_QUEUE_ENTRIES] SECTION_NETWORK ALIGNED;
+static uint8_t s_nTxFree SECTION_NETWORK;
+static struct tcp::Stats s_Stats SECTION_NETWORK;
+static uint32_t s_nConnectionId SECTION_NETWORK;
 
 #if !defined (NDEBUG)
 static const char *s_aStateName[] = {
@@ -306,7 +359,47 @@ static void _bswap32(struct t_tcp *p_tcp) {
 	memcpy(&p_tcp->tcp.seqnum, src.u8, 4);
 }
 
+static struct TxSegment *tx_segment(const uint8_t nSegment) {
+	assert(nSegment != TX_SEGMENT_NONE);
+	return &s_TxSegments[nSegment - 1];
+}
+
+static uint8_t tx_segment_alloc() {
+	const auto nSegment = s_nTxFree;
+
+	if (nSegment != TX_SEGMENT_NONE) {
+		auto *pSegment = tx_segment(nSegment);
+		s_nTxFree = pSegment->nNext;
+		pSegment->nNext = TX_SEGMENT_NONE;
+		pSegment->nSize = 0;
+		pSegment->CTL = Control::ACK;
+	}
+
+	return nSegment;
+}
+
+static void tx_segment_free(const uint8_t nSegment) {
+	tx_segment(nSegment)->nNext = s_nTxFree;
+	s_nTxFree = nSegment;
+}
+
+static void tx_queue_release(struct tcb *pTcb) {
+	auto nSegment = pTcb->RTX.nHead;
+
+	while (nSegment != TX_SEGMENT_NONE) {
+		const auto nNext = tx_segment(nSegment)->nNext;
+		tx_segment_free(nSegment);
+		nSegment = nNext;
+	}
+
+	pTcb->RTX.nHead = TX_SEGMENT_NONE;
+	pTcb->RTX.nTail = TX_SEGMENT_NONE;
+	pTcb->RTX.nUnsent = TX_SEGMENT_NONE;
+}
+
 static void _init_tcb(struct tcb *pTcb, const uint16_t nLocalPort) {
+	tx_queue_release(pTcb);
+
 	memset(pTcb, 0, sizeof(struct tcb));
 
 	pTcb->nLocalPort = nLocalPort;
@@ -319,9 +412,16 @@ static void _init_tcb(struct tcb *pTcb, const uint16_t nLocalPort) {
 	pTcb->SND.NXT = pTcb->ISS;
 	pTcb->SND.WL2 = pTcb->ISS;
 
+	pTcb->RTX.RTO = TCP_RTO_INITIAL;
+
+	pTcb->CWND = 3 * TCP_TX_MSS;	// RFC 5681 IW
+	pTcb->SSTHRESH = 0xFFFF;
+
 	NEW_STATE(pTcb, STATE_LISTEN);
 }
 
+static void tcp_timer();
+
 __attribute__((cold)) void tcp_init() {
 	DEBUG_ENTRY
 
@@ -334,6 +434,15 @@ __attribute__((cold)) void tcp_init() {
 	s_tcp.ip4.flags_froff = __builtin_bswap16(IPv4_FLAG_DF);
 	s_tcp.ip4.ttl = 64;
 	s_tcp.ip4.proto = IPv4_PROTO_TCP;
+	/* Retransmission queue */
+	for (uint32_t i = 0; i < TCP_TX_QUEUE_ENTRIES; i++) {
+		s_TxSegments[i].nNext = static_cast<uint8_t>(i + 2);
+	}
+
+	s_TxSegments[TCP_TX_QUEUE_ENTRIES - 1].nNext = TX_SEGMENT_NONE;
+	s_nTxFree = 1;
+
+	Hardware::Get()->SoftwareTimerAdd(TCP_TMR_INTERVAL, tcp_timer);
 
 	DEBUG_EXIT
 }
@@ -356,26 +465,19 @@ struct tcpPseudo {
 static constexpr auto TCP_PSEUDO_LEN = 12;
 
 static uint16_t _chksum(struct t_tcp *pTcp, const struct tcb *pTcb, uint16_t nLength) {
-	uint8_t buf[TCP_PSEUDO_LEN];
-	uint16_t nSum;
-
-	// Store current data before TCP header in temporary buffer
-	auto *pseu = reinterpret_cast<struct tcpPseudo *>(reinterpret_cast<uint8_t *>(&pTcp->tcp) - TCP_PSEUDO_LEN);
-	memcpy(buf, pseu, TCP_PSEUDO_LEN);
+	struct tcpPseudo pseudo;
 
 	// Generate TCP psuedo header
-	std::memcpy(pseu->srcIp, pTcb->localIp, IPv4_ADDR_LEN);
-	std::memcpy(pseu->dstIp, pTcb->remoteIp, IPv4_ADDR_LEN);
-	pseu->zero = 0;
-	pseu->proto = IPv4_PROTO_TCP;
-	pseu->length = __builtin_bswap16(nLength);
-
-	nSum = net_chksum(pseu, static_cast<uint32_t>(nLength + TCP_PSEUDO_LEN));
+	std::memcpy(pseudo.srcIp, pTcb->localIp, IPv4_ADDR_LEN);
+	std::memcpy(pseudo.dstIp, pTcb->remoteIp, IPv4_ADDR_LEN);
+	pseudo.zero = 0;
+	pseudo.proto = IPv4_PROTO_TCP;
+	pseudo.length = __builtin_bswap16(nLength);
 
-	// Restore data before TCP header from temporary buffer
-	memcpy(pseu, buf, TCP_PSEUDO_LEN);
+	auto nSum = net_chksum_add(0, &pseudo, TCP_PSEUDO_LEN);
+	nSum = net_chksum_add(nSum, &pTcp->tcp, nLength);
 
-	return nSum;
+	return net_chksum_finish(nSum);
 }
 
 static void send_package(const struct tcb *pTcb, const struct SendInfo &sendInfo) {
@@ -495,6 +597,226 @@ struct Options {
 	uint8_t Data;
 };
 
+static void send_segment(struct tcb *pTcb, const struct TxSegment *pSegment) {
+	pTcb->TX.data = const_cast<uint8_t *>(pSegment->data);
+	pTcb->TX.size = pSegment->nSize;
+
+	struct SendInfo info;
+	info.SEQ = pSegment->SEQ;
+	info.ACK = pTcb->RCV.NXT;
+	info.CTL = pSegment->CTL;
+
+	send_package(pTcb, info);
+
+	pTcb->TX.data = nullptr;
+	pTcb->TX.size = 0;
+}
+
+/**
+ * <SEQ=SND.NXT><ACK=RCV.NXT><CTL=FIN,ACK>
+ */
+static void send_fin(struct tcb *pTcb, const uint8_t nNextState) {
+	struct SendInfo info;
+	info.SEQ = pTcb->SND.NXT;
+	info.ACK = pTcb->RCV.NXT;
+	info.CTL = Control::FIN | Control::ACK;
+
+	send_package(pTcb, info);
+
+	if (pTcb->SND.NXT == pTcb->SND.UNA) {
+		pTcb->RTX.nTimer = Hardware::Get()->Millis();
+	}
+
+	pTcb->SND.NXT++;
+
+	NEW_STATE(pTcb, nNextState);
+}
+
+/**
+ * Send the queued segments which fit in the send window and the congestion window.
+ * SND.WND is relative to SND.UNA.
+ * @param isForced send one segment, even when the window is closed (window probe)
+ */
+static void tcp_output(struct tcb *pTcb, const bool isForced = false) {
+	const auto nWindow = std::min(pTcb->SND.WND, pTcb->CWND);
+
+	while (pTcb->RTX.nUnsent != TX_SEGMENT_NONE) {
+		auto *pSegment = tx_segment(pTcb->RTX.nUnsent);
+		const auto nFlight = pTcb->SND.NXT - pTcb->SND.UNA;
+
+		if (((nFlight + pSegment->nSize) > nWindow) && !(isForced && (nFlight == 0))) {
+			return;
+		}
+
+		pSegment->SEQ = pTcb->SND.NXT;
+
+		if (nFlight == 0) {
+			pTcb->RTX.nTimer = Hardware::Get()->Millis();
+		}
+
+		if (!pTcb->RTX.isTiming) {
+			pTcb->RTX.isTiming = true;
+			pTcb->RTX.RttSeq = pSegment->SEQ + pSegment->nSize;
+			pTcb->RTX.nRttStart = Hardware::Get()->Millis();
+		}
+
+		send_segment(pTcb, pSegment);
+
+		pTcb->SND.NXT += pSegment->nSize;
+		pTcb->RTX.nUnsent = pSegment->nNext;
+
+		s_Stats.nSegmentsSent++;
+
+		if (isForced) {
+			return;
+		}
+	}
+}
+
+/**
+ * Remove the acknowledged segments from the retransmission queue
+ */
+static void tx_queue_ack(struct tcb *pTcb, const uint32_t nAck) {
+	while ((pTcb->RTX.nHead != TX_SEGMENT_NONE) && (pTcb->RTX.nHead != pTcb->RTX.nUnsent)) {
+		const auto nSegment = pTcb->RTX.nHead;
+		const auto *pSegment = tx_segment(nSegment);
+
+		if (SEQ_GT(pSegment->SEQ + pSegment->nSize, nAck)) {
+			break;
+		}
+
+		pTcb->RTX.nHead = pSegment->nNext;
+		tx_segment_free(nSegment);
+	}
+
+	if (pTcb->RTX.nHead == TX_SEGMENT_NONE) {
+		pTcb->RTX.nTail = TX_SEGMENT_NONE;
+	}
+}
+
+/**
+ * RFC 6298 with alpha = 1/8 and beta = 1/4
+ */
+static void rtt_update(struct tcb *pTcb, const uint32_t nRtt) {
+	auto &rtx = pTcb->RTX;
+
+	if (rtx.SRTT == 0) {
+		rtx.SRTT = std::max(nRtt, static_cast<uint32_t>(1));
+		rtx.RTTVAR = nRtt / 2;
+	} else {
+		const auto nDelta = (rtx.SRTT > nRtt) ? (rtx.SRTT - nRtt) : (nRtt - rtx.SRTT);
+		rtx.RTTVAR = (3 * rtx.RTTVAR + nDelta) / 4;
+		rtx.SRTT = (7 * rtx.SRTT + nRtt) / 8;
+	}
+
+	const auto nRto = rtx.SRTT + std::max(TCP_TMR_INTERVAL, 4 * rtx.RTTVAR);
+
+	rtx.RTO = std::min(std::max(nRto, TCP_RTO_MIN), TCP_RTO_MAX);
+}
+
+static void congestion_loss(struct tcb *pTcb) {
+	const auto nFlight = pTcb->SND.NXT - pTcb->SND.UNA;
+
+	pTcb->SSTHRESH = std::max(nFlight / 2, static_cast<uint32_t>(2 * TCP_TX_MSS));
+	/* Karn's algorithm, no RTT sample from a retransmitted segment */
+	pTcb->RTX.isTiming = false;
+}
+
+/**
+ * Sends the oldest unacknowledged segment again, or the FIN when no data is in flight.
+ * Used by fast retransmit, after a retransmission timeout and for each partial ACK
+ * during the recovery which follows it (RFC 5681 section 3.1, RFC 6582).
+ * The other segments in flight are sent again when they are the oldest, clocked by the ACKs.
+ */
+static void retransmit(struct tcb *pTcb) {
+	const auto nSegment = pTcb->RTX.nHead;
+
+	if ((nSegment != TX_SEGMENT_NONE) && (nSegment != pTcb->RTX.nUnsent)) {
+		send_segment(pTcb, tx_segment(nSegment));
+	} else if ((pTcb->state == STATE_LAST_ACK) || (pTcb->state == STATE_FIN_WAIT_1) || (pTcb->state == STATE_CLOSING)) {
+		struct SendInfo info;
+		info.SEQ = pTcb->SND.NXT - 1;
+		info.ACK = pTcb->RCV.NXT;
+		info.CTL = Control::FIN | Control::ACK;
+
+		send_package(pTcb, info);
+	}
+
+	pTcb->RTX.nTimer = Hardware::Get()->Millis();
+}
+
+/**
+ * <SEQ=SND.NXT><CTL=RST>
+ */
+static void tcp_abort(struct tcb *pTcb) {
+	struct SendInfo info;
+	info.SEQ = pTcb->SND.NXT;
+	info.ACK = pTcb->RCV.NXT;
+	info.CTL = Control::RST;
+
+	send_package(pTcb, info);
+	_init_tcb(pTcb, pTcb->nLocalPort);
+
+	s_Stats.nAborted++;
+}
+
+static void tcp_timer() {
+	const auto nMillis = Hardware::Get()->Millis();
+
+	for (auto& port : s_Port) {
+		for (auto& tcb : port.TCB) {
+			if (tcb.state == STATE_FIN_WAIT_2) {
+				if ((nMillis - tcb.nLastReceived) >= TCP_FIN_WAIT_TIMEOUT) {
+					_init_tcb(&tcb, tcb.nLocalPort);
+				}
+				continue;
+			}
+
+			if ((tcb.state != STATE_ESTABLISHED) && (tcb.state != STATE_CLOSE_WAIT) && (tcb.state != STATE_LAST_ACK)
+			 && (tcb.state != STATE_FIN_WAIT_1) && (tcb.state != STATE_CLOSING)) {
+				continue;
+			}
+
+			if ((tcb.SND.NXT == tcb.SND.UNA) && (tcb.RTX.nUnsent == TX_SEGMENT_NONE)) {
+				continue;
+			}
+
+			if ((nMillis - tcb.RTX.nTimer) < tcb.RTX.RTO) {
+				continue;
+			}
+
+			/*
+			 * The window probes count against TCP_MAX_RETRIES as well.
+			 * An ACK with a zero window does not reset the count, a peer which keeps
+			 * the window closed is aborted.
+			 */
+			if (++tcb.RTX.nRetries > TCP_MAX_RETRIES) {
+				DEBUG_PUTS("Too many retransmissions");
+				tcp_abort(&tcb);
+				continue;
+			}
+
+			tcb.RTX.RTO = std::min(tcb.RTX.RTO * 2, TCP_RTO_MAX);
+
+			if (tcb.SND.NXT == tcb.SND.UNA) {
+				/* Nothing in flight, the send window is closed */
+				tcp_output(&tcb, true);
+				tcb.RTX.nTimer = nMillis;
+				continue;
+			}
+
+			congestion_loss(&tcb);
+			tcb.CWND = TCP_TX_MSS;
+			tcb.RTX.nDupAcks = 0;
+			tcb.RTX.isRecovering = true;
+			tcb.RTX.Recover = tcb.SND.NXT;
+
+			retransmit(&tcb);
+			s_Stats.nRetransmits++;
+		}
+	}
+}
+
 static void scan_options(struct t_tcp *pTcp, struct tcb *pTcb, const int32_t nDataOffset) {
 	const auto *pTcpHeaderEnd = reinterpret_cast<uint8_t *>(&pTcp->tcp) +  nDataOffset;
 
@@ -551,17 +873,17 @@ static void scan_options(struct t_tcp *pTcp, struct tcb *pTcb, const int32_t nDa
 __attribute__((hot)) void tcp_run() {
 	for (auto& port : s_Port) {
 		for (auto& tcb : port.TCB) {
-			if (tcb.state == STATE_CLOSE_WAIT) {
-				SendInfo info;
-				info.SEQ = tcb.SND.NXT;
-				info.ACK = tcb.RCV.NXT;
-				info.CTL = Control::FIN | Control::ACK;
-
-				send_package(&tcb, info);
-
-				NEW_STATE(&tcb, STATE_LAST_ACK);
+			if ((tcb.state == STATE_ESTABLISHED) || (tcb.state == STATE_CLOSE_WAIT)) {
+				tcp_output(&tcb);
+			}
 
-				tcb.SND.NXT++;
+			/* The FIN is sent after all queued data */
+			if (tcb.RTX.nUnsent == TX_SEGMENT_NONE) {
+				if (tcb.state == STATE_CLOSE_WAIT) {
+					send_fin(&tcb, STATE_LAST_ACK);
+				} else if ((tcb.state == STATE_ESTABLISHED) && tcb.isCloseRequested) {
+					send_fin(&tcb, STATE_FIN_WAIT_1);
+				}
 			}
 		}
 	}
@@ -847,6 +1169,8 @@ __attribute__((hot)) void tcp_handle(struct t_tcp *pTcp) {
 			return;
 		}
 
+		pTCB->nLastReceived = Hardware::Get()->Millis();
+
 		// third check security and precedence. No code needed here
 
 		/* fourth, check the SYN bit, *//* Page 71 */
@@ -880,6 +1204,9 @@ __attribute__((hot)) void tcp_handle(struct t_tcp *pTcp) {
 
 				pTCB->SND.UNA = SEG_ACK;		// got ACK for SYN
 
+				pTCB->nConnectionId = ++s_nConnectionId;
+				pTCB->nLastReceived = Hardware::Get()->Millis();
+
 				NEW_STATE(pTCB, STATE_ESTABLISHED);
 				return;
 			} else {
@@ -901,6 +1228,36 @@ __attribute__((hot)) void tcp_handle(struct t_tcp *pTcp) {
 				auto nBytesAck = SEG_ACK - pTCB->SND.UNA;
 				pTCB->SND.UNA = SEG_ACK;
 
+				tx_queue_ack(pTCB, SEG_ACK);
+
+				if (pTCB->RTX.isTiming && !SEQ_LT(SEG_ACK, pTCB->RTX.RttSeq)) {
+					pTCB->RTX.isTiming = false;
+					rtt_update(pTCB, Hardware::Get()->Millis() - pTCB->RTX.nRttStart);
+				}
+
+				if (SEG_WND != 0) {
+					pTCB->RTX.nRetries = 0;
+				}
+
+				pTCB->RTX.nDupAcks = 0;
+				pTCB->RTX.nTimer = Hardware::Get()->Millis();
+
+				if (pTCB->RTX.isRecovering) {
+					if (!SEQ_LT(SEG_ACK, pTCB->RTX.Recover)) {
+						pTCB->RTX.isRecovering = false;
+					} else {
+						/* Partial ACK, the next segment in flight is lost as well */
+						retransmit(pTCB);
+						s_Stats.nRetransmits++;
+					}
+				}
+
+				if (pTCB->CWND < pTCB->SSTHRESH) {
+					pTCB->CWND += std::min(nBytesAck, static_cast<uint32_t>(TCP_TX_MSS));	// slow start
+				} else {
+					pTCB->CWND += std::max(static_cast<uint32_t>((TCP_TX_MSS * TCP_TX_MSS) / pTCB->CWND), static_cast<uint32_t>(1));	// congestion avoidance
+				}
+
 				if (SEG_ACK == pTCB->SND.NXT) {
 					DEBUG_PUTS("/* all segments are acknowledged */");
 				}
@@ -922,6 +1279,18 @@ __attribute__((hot)) void tcp_handle(struct t_tcp *pTcp) {
 				}
 			} else if (SEQ_LEQ(SEG_ACK, pTCB->SND.UNA)) { /* RFC 1122 section 4.2.2.20 (g) */
 				DEBUG_PUTS("/* ignore duplicate ACK */");
+				/* RFC 5681 duplicate ACK: no data, same window, data in flight */
+				if ((SEG_ACK == pTCB->SND.UNA) && (SEG_LEN == 0) && (SEG_WND == pTCB->SND.WND) && (pTCB->SND.NXT != pTCB->SND.UNA)) {
+					if (++pTCB->RTX.nDupAcks == TCP_DUP_ACK_THRESHOLD) {
+						congestion_loss(pTCB);
+						pTCB->CWND = pTCB->SSTHRESH;
+
+						retransmit(pTCB);
+
+						s_Stats.nFastRetransmits++;
+					}
+				}
+
 				if (SEQ_BETWEEN_LH(pTCB->SND.UNA, SEG_ACK, pTCB->SND.NXT)) {
 					// ... but update send window
 					if ( SEQ_LT(pTCB->SND.WL1, SEG_SEQ) || (pTCB->SND.WL1 == SEG_SEQ && SEQ_LEQ(pTCB->SND.WL2, SEG_ACK))) {
@@ -940,10 +1309,26 @@ __attribute__((hot)) void tcp_handle(struct t_tcp *pTcp) {
 				send_package(pTCB, sendInfo);
 				return;
 			}
+
+			if (pTCB->SND.UNA == pTCB->SND.NXT) {	// if our FIN is now acknowledged
+				if (pTCB->state == STATE_FIN_WAIT_1) {
+					NEW_STATE(pTCB, STATE_FIN_WAIT_2);
+				} else if (pTCB->state == STATE_CLOSING) {
+					/* No TIME-WAIT, the TCB is needed for a new connection */
+					_init_tcb(pTCB, pTCB->nLocalPort);
+					return;
+				}
+			}
 			break;
 		case STATE_LAST_ACK:
 			if (SEG_ACK == pTCB->SND.NXT) { 	// if our FIN is now acknowledged
 				_init_tcb(pTCB, pTCB->nLocalPort);
+			} else if (SEQ_BETWEEN_H(pTCB->SND.UNA, SEG_ACK, pTCB->SND.NXT)) {
+				pTCB->SND.UNA = SEG_ACK;
+				pTCB->RTX.nRetries = 0;
+				pTCB->RTX.nTimer = Hardware::Get()->Millis();
+
+				tx_queue_ack(pTCB, SEG_ACK);
 			}
 			break;
 		case STATE_TIME_WAIT:
@@ -1047,16 +1432,15 @@ __attribute__((hot)) void tcp_handle(struct t_tcp *pTcp) {
 			 timers; otherwise enter the CLOSING state.
 			 */
 			if (SEG_ACK == pTCB->SND.NXT) { /* if our FIN is now acknowledged */
-				NEW_STATE(pTCB, STATE_TIME_WAIT);
-				CLIENT_NOT_IMPLEMENTED;
+				/* No TIME-WAIT, the TCB is needed for a new connection */
+				_init_tcb(pTCB, pTCB->nLocalPort);
 			} else {
 				NEW_STATE(pTCB, STATE_CLOSING);
 			}
 			break;
 		case STATE_FIN_WAIT_2:
-			// Enter the TIME-WAIT state.  Start the time-wait timer, turn off the other timers.
-			NEW_STATE(pTCB, STATE_TIME_WAIT);
-			CLIENT_NOT_IMPLEMENTED;
+			/* No TIME-WAIT, the TCB is needed for a new connection */
+			_init_tcb(pTCB, pTCB->nLocalPort);
 			break;
 		case STATE_CLOSE_WAIT:
 			// Remain in the CLOSE-WAIT state.
@@ -1136,56 +1520,112 @@ uint16_t tcp_read(const int32_t nHandleListen, const uint8_t **pData, uint32_t &
 	return pQueueEntry->nSize;
 }
 
-static void _write(struct tcb *pTCB, const uint8_t *pBuffer, const uint32_t nLength, const bool isLastSegment) {
-	assert(nLength != 0);
-	assert(nLength <= static_cast<uint32_t>(TCP_DATA_SIZE));
+/**
+ * The data is copied into the retransmission queue, a segment is filled up before the next one is used.
+ * tcp_write() does not wait, when there is no free segment it returns a short count.
+ * The caller writes the rest later, after segments have been acknowledged.
+ * @return the number of bytes queued
+ */
+uint32_t tcp_write(const int32_t nHandleListen, const uint8_t *pBuffer, uint32_t nLength, uint32_t nHandleConnection) {
+	assert(nHandleListen >= 0);
+	assert(nHandleListen < TCP_MAX_PORTS_ALLOWED);
+	assert(pBuffer != nullptr);
+	assert(nHandleConnection < TCP_MAX_TCBS_ALLOWED);
 
-	DEBUG_PRINTF("nLength=%u, pTCB->SND.WND=%u", nLength, pTCB->SND.WND);
+	auto *pTCB = &s_Port[nHandleListen].TCB[nHandleConnection];
+	assert(pTCB != nullptr);
 
-    if (nLength > pTCB->SND.WND) {
-    	console_error("Retry or queue the data for later transmission\n");
-        // TODO retry or queue the data for later transmission.
-        return;
-    }
+	if ((pTCB->state != STATE_ESTABLISHED) && (pTCB->state != STATE_CLOSE_WAIT)) {
+		DEBUG_PUTS("Connection is closed");
+		return 0;
+	}
 
-	pTCB->TX.data = const_cast<uint8_t *>(pBuffer);
-	pTCB->TX.size = nLength;
+	const auto *p = pBuffer;
 
-	struct SendInfo info;
-	info.SEQ = pTCB->SND.NXT;
-	info.ACK = pTCB->RCV.NXT;
-	info.CTL = Control::ACK;
-	if (isLastSegment) {
-		info.CTL |= Control::PSH;
-	}
+	while (nLength > 0) {
+		struct TxSegment *pSegment = nullptr;
 
-	send_package(pTCB, info);
+		if ((pTCB->RTX.nUnsent != TX_SEGMENT_NONE) && (tx_segment(pTCB->RTX.nTail)->nSize < TCP_DATA_SIZE)) {
+			pSegment = tx_segment(pTCB->RTX.nTail);
+		} else {
+			const auto nSegment = tx_segment_alloc();
+
+			if (__builtin_expect((nSegment == TX_SEGMENT_NONE), 0)) {
+				s_Stats.nQueueFull++;
+				break;
+			}
+
+			if (pTCB->RTX.nTail == TX_SEGMENT_NONE) {
+				pTCB->RTX.nHead = nSegment;
+			} else {
+				tx_segment(pTCB->RTX.nTail)->nNext = nSegment;
+			}
 
-	pTCB->TX.data = nullptr;
-	pTCB->TX.size = 0;
+			pTCB->RTX.nTail = nSegment;
 
-    pTCB->SND.NXT += nLength;
-    pTCB->SND.WND -= nLength;
+			if (pTCB->RTX.nUnsent == TX_SEGMENT_NONE) {
+				pTCB->RTX.nUnsent = nSegment;
+			}
+
+			pSegment = tx_segment(nSegment);
+		}
+
+		const auto nWriteLength = std::min(nLength, static_cast<uint32_t>(TCP_DATA_SIZE - pSegment->nSize));
+
+		memcpy(&pSegment->data[pSegment->nSize], p, nWriteLength);
+		pSegment->nSize = static_cast<uint16_t>(pSegment->nSize + nWriteLength);
+
+		p += nWriteLength;
+		nLength -= nWriteLength;
+
+		if (nLength == 0) {
+			pSegment->CTL |= Control::PSH;
+		}
+	}
+
+	tcp_output(pTCB);
+
+	return static_cast<uint32_t>(p - pBuffer);
 }
 
-void tcp_write(const int32_t nHandleListen, const uint8_t *pBuffer, uint32_t nLength, uint32_t nHandleConnection) {
+/**
+ * Active close, the FIN is sent after the queued data
+ */
+void tcp_close(const int32_t nHandleListen, const uint32_t nHandleConnection) {
 	assert(nHandleListen >= 0);
 	assert(nHandleListen < TCP_MAX_PORTS_ALLOWED);
-	assert(pBuffer != nullptr);
 	assert(nHandleConnection < TCP_MAX_TCBS_ALLOWED);
 
 	auto *pTCB = &s_Port[nHandleListen].TCB[nHandleConnection];
-	assert(pTCB != nullptr);
 
-	const auto *p = pBuffer;
+	if (pTCB->state != STATE_ESTABLISHED) {
+		return;
+	}
 
-	while (nLength > 0) {
-		const auto nWriteLength = (nLength > TCP_DATA_SIZE) ? TCP_DATA_SIZE : nLength;
-		const bool isLastSegment = (nLength < TCP_DATA_SIZE);
-		_write(pTCB, p, nWriteLength, isLastSegment);
-		p += nWriteLength;
-		nLength -= nWriteLength;
+	pTCB->isCloseRequested = true;
+
+	tcp_output(pTCB);
+
+	if (pTCB->RTX.nUnsent == TX_SEGMENT_NONE) {
+		send_fin(pTCB, STATE_FIN_WAIT_1);
 	}
 }
+
+void tcp_get_connection(const int32_t nHandleListen, const uint32_t nHandleConnection, tcp::Connection& connection) {
+	assert(nHandleListen >= 0);
+	assert(nHandleListen < TCP_MAX_PORTS_ALLOWED);
+	assert(nHandleConnection < TCP_MAX_TCBS_ALLOWED);
+
+	const auto *pTCB = &s_Port[nHandleListen].TCB[nHandleConnection];
+
+	connection.isEstablished = (pTCB->state == STATE_ESTABLISHED) && !pTCB->isCloseRequested;
+	connection.isWritable = (pTCB->state == STATE_ESTABLISHED) || (pTCB->state == STATE_CLOSE_WAIT);
+	connection.nId = pTCB->nConnectionId;
+	connection.nIdleMillis = Hardware::Get()->Millis() - pTCB->nLastReceived;
+}
+
+void tcp_get_stats(tcp::Stats& stats) {
+	stats = s_Stats;
+}
 }  // namespace net
 // <---
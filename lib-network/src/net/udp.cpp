@@ -40,12 +40,16 @@
 
 #include "../../config/net_config.h"
 
+#include "net/udp.h"
+#include "net/arp.h"
 #include "net/protocol/udp.h"
 
 #include "net.h"
 #include "net_private.h"
 #include "net_memcpy.h"
 
+#include "emac/emac.h"
+
 #include "debug.h"
 
 namespace net {
@@ -54,20 +58,88 @@ extern uint32_t nBroadcastMask;
 }  // namespace globals
 
 struct data_entry {
+	const uint8_t *pData;	///< Points to data[] or, when loaned, into the EMAC RX buffer
 	uint32_t from_ip;
 	uint32_t size;
 	uint16_t from_port;
 	uint8_t data[UDP_DATA_SIZE];
 } ALIGNED;
 
+/*
+ * Single producer (udp_handle) / single consumer (udp_recv1, udp_recv2) ring.
+ * nHead is written by the producer only, nTail by the consumer only.
+ */
+struct queue {
+	uint32_t nHead;
+	uint32_t nTail;
+	uint16_t nBase;			///< First entry in s_data
+	uint16_t nMask;			///< Depth - 1
+	uint16_t nCapacity;		///< Entries reserved in s_data, kept after udp_end
+	uint16_t nHighWater;
+	uint32_t nReceived;
+	uint32_t nOverrun;
+} ALIGNED;
+
+struct queue_depth {
+	uint16_t nPort;
+	uint16_t nDepth;
+};
+
+static constexpr struct queue_depth s_QueueDepth[] = UDP_RX_QUEUE_DEPTH_PORTS;
+
 static uint16_t s_Port[UDP_MAX_PORTS_ALLOWED] SECTION_NETWORK ALIGNED;
-static struct data_entry s_data[UDP_MAX_PORTS_ALLOWED] SECTION_NETWORK ALIGNED;
+static struct queue s_Queue[UDP_MAX_PORTS_ALLOWED] SECTION_NETWORK ALIGNED;
+static struct data_entry s_data[UDP_RX_QUEUE_ENTRIES] SECTION_NETWORK ALIGNED;
+static uint32_t s_nDataEntriesReserved SECTION_NETWORK;
+static uint32_t s_nNoPort SECTION_NETWORK;
+#if defined (UDP_RX_ZERO_COPY)
+static const uint8_t *s_pReleasePending[UDP_RX_QUEUE_ENTRIES] SECTION_NETWORK ALIGNED;
+static uint32_t s_nReleasePending SECTION_NETWORK;
+
+static bool is_loaned(const struct data_entry *p_data) {
+	return p_data->pData != p_data->data;
+}
+#endif
 static struct t_udp s_send_packet SECTION_NETWORK ALIGNED;
 static uint16_t s_id SECTION_NETWORK ALIGNED;
 static uint8_t s_multicast_mac[ETH_ADDR_LEN] SECTION_NETWORK ALIGNED;
 
+/*
+ * Header templates for udp_send_reserve(), direct mapped on the destination.
+ * The IPv4 checksum is kept as the one's complement sum without id and len,
+ * these are added when the datagram is committed.
+ */
+static constexpr uint32_t SEND_TEMPLATES = 16;
+
+struct udp_headers {
+	struct ether_header ether;
+	struct ip4_header ip4;
+	uint16_t source_port;
+	uint16_t destination_port;
+	uint16_t len;
+	uint16_t checksum;
+} PACKED;
+
+static_assert(sizeof(struct udp_headers) == UDP_PACKET_HEADERS_SIZE);
+
+struct send_template {
+	struct udp_headers headers;
+	uint16_t nLocalPort;	///< 0 is an empty entry
+	uint32_t nRemoteIp;
+	uint32_t nChksum;
+	bool isUnicast;			///< The destination MAC address is taken from the ARP cache
+} ALIGNED;
+
+static struct send_template s_Templates[SEND_TEMPLATES] SECTION_NETWORK ALIGNED;
+static struct udp_headers *s_pReserved SECTION_NETWORK;
+static uint32_t s_nReservedChksum SECTION_NETWORK;
+
 void udp_set_ip() {
 	net::memcpy_ip(s_send_packet.ip4.src, net::globals::netif_default.ip.addr);
+
+	for (auto& t : s_Templates) {
+		t.nLocalPort = 0;
+	}
 }
 
 void __attribute__((cold)) udp_init() {
@@ -100,33 +172,216 @@ __attribute__((hot)) void udp_handle(struct t_udp *pUdp) {
 
 	for (uint32_t nPortIndex = 0; nPortIndex < UDP_MAX_PORTS_ALLOWED; nPortIndex++) {
 		if (s_Port[nPortIndex] == nDestinationPort) {
-			if (__builtin_expect ((s_data[nPortIndex].size != 0), 0)) {
+			auto &queue = s_Queue[nPortIndex];
+			const auto nQueued = queue.nHead - queue.nTail;
+
+			if (__builtin_expect((nQueued > queue.nMask), 0)) {
+				queue.nOverrun++;
 				DEBUG_PRINTF(IPSTR ":%d[%x]", pUdp->ip4.src[0],pUdp->ip4.src[1],pUdp->ip4.src[2],pUdp->ip4.src[3], nDestinationPort, nDestinationPort);
+				return;
 			}
 
-			auto *p_queue_entry = &s_data[nPortIndex];
+			auto *p_queue_entry = &s_data[queue.nBase + (queue.nHead & queue.nMask)];
 			const auto nDataLength = static_cast<uint16_t>(__builtin_bswap16(pUdp->udp.len) - UDP_HEADER_SIZE);
 			const auto i = std::min(static_cast<uint16_t>(UDP_DATA_SIZE), nDataLength);
 
-			net::memcpy(p_queue_entry->data, pUdp->udp.data, i);
+#if defined (UDP_RX_ZERO_COPY)
+			if (emac_loan_pkt()) {
+				p_queue_entry->pData = pUdp->udp.data;
+			} else
+#endif
+			{
+				net::memcpy(p_queue_entry->data, pUdp->udp.data, i);
+				p_queue_entry->pData = p_queue_entry->data;
+			}
 
 			p_queue_entry->from_ip = net::memcpy_ip(pUdp->ip4.src);
 			p_queue_entry->from_port = __builtin_bswap16(pUdp->udp.source_port);
 			p_queue_entry->size = static_cast<uint16_t>(i);
 
+			queue.nReceived++;
+
+			if (__builtin_expect((nQueued >= queue.nHighWater), 0)) {
+				queue.nHighWater = static_cast<uint16_t>(nQueued + 1);
+			}
+
+			// The entry must be complete before the consumer can see it
+			__sync_synchronize();
+			queue.nHead++;
+
 			return;
 		}
 	}
 
+	s_nNoPort++;
+
 	DEBUG_PRINTF(IPSTR ":%d[%x] " MACSTR, pUdp->ip4.src[0],pUdp->ip4.src[1],pUdp->ip4.src[2],pUdp->ip4.src[3], nDestinationPort, nDestinationPort, MAC2STR(pUdp->ether.dst));
 }
 
+static struct send_template *udp_send_template(const uint16_t nLocalPort, const uint32_t nRemoteIp, const uint16_t nRemotePort) {
+	const auto nHash = ((nRemoteIp >> 24) ^ (nRemoteIp >> 16) ^ nRemotePort ^ nLocalPort) & (SEND_TEMPLATES - 1);
+	auto &t = s_Templates[nHash];
+
+	if ((t.nLocalPort == nLocalPort) && (t.nRemoteIp == nRemoteIp) && (t.headers.destination_port == __builtin_bswap16(nRemotePort))) {
+		return &t;
+	}
+
+	std::memcpy(&t.headers, &s_send_packet, sizeof(struct udp_headers));
+	//IPv4
+	t.headers.ip4.id = 0;
+	t.headers.ip4.len = 0;
+	t.headers.ip4.chksum = 0;
+	//UDP
+	t.headers.source_port = __builtin_bswap16(nLocalPort);
+	t.headers.destination_port = __builtin_bswap16(nRemotePort);
+	t.headers.len = 0;
+	t.headers.checksum = 0;
+
+	t.isUnicast = false;
+
+	if (nRemoteIp == network::IP4_BROADCAST) {
+		memset(t.headers.ether.dst, 0xFF, ETH_ADDR_LEN);
+		memset(t.headers.ip4.dst, 0xFF, IPv4_ADDR_LEN);
+	} else if ((nRemoteIp & net::globals::nBroadcastMask) == net::globals::nBroadcastMask) {
+		memset(t.headers.ether.dst, 0xFF, ETH_ADDR_LEN);
+		net::memcpy_ip(t.headers.ip4.dst, nRemoteIp);
+	} else {
+		if ((nRemoteIp & 0xF0) == 0xE0) {
+			std::memcpy(t.headers.ether.dst, s_multicast_mac, 3);
+			t.headers.ether.dst[3] = static_cast<uint8_t>((nRemoteIp >> 8) & 0x7F);
+			t.headers.ether.dst[4] = static_cast<uint8_t>(nRemoteIp >> 16);
+			t.headers.ether.dst[5] = static_cast<uint8_t>(nRemoteIp >> 24);
+		} else {
+			t.isUnicast = true;
+		}
+		net::memcpy_ip(t.headers.ip4.dst, nRemoteIp);
+	}
+
+	t.nChksum = static_cast<uint16_t>(~net_chksum(reinterpret_cast<void *>(&t.headers.ip4), sizeof(t.headers.ip4)));
+	t.nLocalPort = nLocalPort;
+	t.nRemoteIp = nRemoteIp;
+
+	return &t;
+}
+
+/*
+ * The TX buffer takes aligned stores only. Bytes are stored until the
+ * destination is word aligned, then whole words. An unaligned source is merged
+ * from aligned word loads; these never go past the last source word.
+ */
+void udp_copy_payload(uint8_t *pDst, const uint8_t *pSrc, uint32_t nSize) {
+	while (((reinterpret_cast<uintptr_t>(pDst) & 3) != 0) && (nSize != 0)) {
+		*pDst++ = *pSrc++;
+		nSize--;
+	}
+
+	auto *pDst32 = reinterpret_cast<uint32_t *>(pDst);
+	const auto nOffset = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(pSrc) & 3);
+
+	if (nOffset == 0) {
+		const auto *pSrc32 = reinterpret_cast<const uint32_t *>(pSrc);
+
+		while (nSize >= 4) {
+			*pDst32++ = *pSrc32++;
+			nSize -= 4;
+		}
+	} else {
+		const auto nShift = nOffset * 8;
+		const auto *pSrc32 = reinterpret_cast<const uint32_t *>(pSrc - nOffset);
+		auto nPrevious = *pSrc32++;
+
+		/*
+		 * Each word stored needs the next source word, which ends
+		 * (7 - nOffset) bytes after the current source position.
+		 */
+		while (nSize >= (8 - nOffset)) {
+			const auto nNext = *pSrc32++;
+			*pDst32++ = (nPrevious >> nShift) | (nNext << (32 - nShift));
+			nPrevious = nNext;
+			nSize -= 4;
+		}
+	}
+
+	const auto nCopied = reinterpret_cast<uintptr_t>(pDst32) - reinterpret_cast<uintptr_t>(pDst);
+	pDst += nCopied;
+	pSrc += nCopied;
+
+	while (nSize--) {
+		*pDst++ = *pSrc++;
+	}
+}
+
+uint8_t *udp_send_reserve(int nIndex, uint32_t nRemoteIp, uint16_t nRemotePort) {
+	assert(nIndex >= 0);
+	assert(nIndex < UDP_MAX_PORTS_ALLOWED);
+	assert(s_Port[nIndex] != 0);
+	assert(s_pReserved == nullptr);
+
+	auto *pBuffer = emac_eth_tx_reserve();
+
+	if (__builtin_expect((pBuffer == nullptr), 0)) {
+		return nullptr;
+	}
+
+	const auto *pTemplate = udp_send_template(s_Port[nIndex], nRemoteIp, nRemotePort);
+	const uint8_t *pMacAddress = nullptr;
+
+	if (pTemplate->isUnicast) {
+		pMacAddress = net::arp_cache_lookup(nRemoteIp);
+
+		if (pMacAddress == nullptr) {
+			return nullptr;
+		}
+	}
+
+	net::memcpy(pBuffer, &pTemplate->headers, sizeof(struct udp_headers));
+
+	if (pMacAddress != nullptr) {
+		net::memcpy(pBuffer, pMacAddress, ETH_ADDR_LEN);
+	}
+
+	s_pReserved = reinterpret_cast<struct udp_headers *>(pBuffer);
+	s_nReservedChksum = pTemplate->nChksum;
+
+	return pBuffer + sizeof(struct udp_headers);
+}
+
+void udp_send_commit(uint32_t nSize) {
+	assert(s_pReserved != nullptr);
+	assert(nSize <= UDP_DATA_SIZE);
+
+	const auto nId = s_id++;
+	const auto nLength = __builtin_bswap16(static_cast<uint16_t>(nSize + IPv4_UDP_HEADERS_SIZE));
+
+	s_pReserved->ip4.id = nId;
+	s_pReserved->ip4.len = nLength;
+#if !defined (CHECKSUM_BY_HARDWARE)
+	s_pReserved->ip4.chksum = net_chksum_finish(s_nReservedChksum + nId + nLength);
+#endif
+	s_pReserved->len = __builtin_bswap16(static_cast<uint16_t>(nSize + UDP_HEADER_SIZE));
+
+	s_pReserved = nullptr;
+
+	emac_eth_tx_commit(nSize + UDP_PACKET_HEADERS_SIZE);
+}
+
 template<net::arp::EthSend S>
 static void udp_send_implementation(int nIndex, const uint8_t *pData, uint32_t nSize, uint32_t nRemoteIp, uint16_t nRemotePort) {
 	assert(nIndex >= 0);
 	assert(nIndex < UDP_MAX_PORTS_ALLOWED);
 	assert(s_Port[nIndex] != 0);
 
+	if (S == net::arp::EthSend::IS_NORMAL) {
+		auto *pBuffer = udp_send_reserve(nIndex, nRemoteIp, nRemotePort);
+
+		if (__builtin_expect((pBuffer != nullptr), 1)) {
+			nSize = std::min(static_cast<uint32_t>(UDP_DATA_SIZE), nSize);
+			udp_copy_payload(pBuffer, pData, nSize);
+			udp_send_commit(nSize);
+			return;
+		}
+	}
+
 	//IPv4
 	s_send_packet.ip4.id = s_id++;
 	s_send_packet.ip4.len = __builtin_bswap16(static_cast<uint16_t>(nSize + IPv4_UDP_HEADERS_SIZE));
@@ -190,24 +445,91 @@ static void udp_send_implementation(int nIndex, const uint8_t *pData, uint32_t n
 	return;
 }
 
+static uint32_t floor_power_of_2(const uint32_t n) {
+	return (n == 0) ? 0 : (1U << (31 - __builtin_clz(n)));
+}
+
+static uint32_t queue_depth(const uint16_t nLocalPort) {
+	for (const auto& queueDepth : s_QueueDepth) {
+		if (queueDepth.nPort == nLocalPort) {
+			return std::max(1U, static_cast<uint32_t>(queueDepth.nDepth));
+		}
+	}
+
+	return std::max(1U, static_cast<uint32_t>(UDP_RX_QUEUE_DEPTH_DEFAULT));
+}
+
+static void queue_setup(const uint32_t nIndex, const uint32_t nDepth) {
+	auto &queue = s_Queue[nIndex];
+
+	if (queue.nCapacity == 0) {
+		// Keep at least one entry for each index not used yet
+		uint32_t nUnreserved = 0;
+
+		for (const auto& q : s_Queue) {
+			if (q.nCapacity == 0) {
+				nUnreserved++;
+			}
+		}
+
+		const auto nAvailable = UDP_RX_QUEUE_ENTRIES - s_nDataEntriesReserved - (nUnreserved - 1);
+
+		queue.nBase = static_cast<uint16_t>(s_nDataEntriesReserved);
+		queue.nCapacity = static_cast<uint16_t>(floor_power_of_2(std::min(nDepth, nAvailable)));
+		s_nDataEntriesReserved += queue.nCapacity;
+	}
+
+	queue.nMask = static_cast<uint16_t>(floor_power_of_2(std::min(nDepth, static_cast<uint32_t>(queue.nCapacity))) - 1);
+	queue.nHead = 0;
+	queue.nTail = 0;
+	queue.nHighWater = 0;
+	queue.nReceived = 0;
+	queue.nOverrun = 0;
+
+	DEBUG_PRINTF("nIndex=%u, nBase=%u, nDepth=%u", nIndex, queue.nBase, queue.nMask + 1U);
+}
+
 // -->
 
 int udp_begin(uint16_t nLocalPort) {
 	DEBUG_PRINTF("nLocalPort=%u", nLocalPort);
 
+	const auto nDepth = queue_depth(nLocalPort);
+	int nIndex = -1;
+
 	for (int i = 0; i < UDP_MAX_PORTS_ALLOWED; i++) {
 		if (s_Port[i] == nLocalPort) {
 			return i;
 		}
 
 		if (s_Port[i] == 0) {
-			s_Port[i] = nLocalPort;
-
-			DEBUG_PRINTF("i=%d, local_port=%d[%x]", i, nLocalPort, nLocalPort);
-			return i;
+			/*
+			 * A released index keeps its ring, take one which is deep enough or not reserved yet.
+			 * Otherwise the first free index.
+			 */
+			const auto nCapacity = s_Queue[i].nCapacity;
+			const auto isFit = (nCapacity == 0) || (nCapacity >= floor_power_of_2(nDepth));
+
+			if (nIndex < 0) {
+				nIndex = i;
+				if (isFit) {
+					break;
+				}
+			} else if (isFit) {
+				nIndex = i;
+				break;
+			}
 		}
 	}
 
+	if (nIndex >= 0) {
+		queue_setup(static_cast<uint32_t>(nIndex), nDepth);
+		s_Port[nIndex] = nLocalPort;
+
+		DEBUG_PRINTF("i=%d, local_port=%d[%x]", nIndex, nLocalPort, nLocalPort);
+		return nIndex;
+	}
+
 #ifndef NDEBUG
 	console_error("udp_begin\n");
 #endif
@@ -220,7 +542,18 @@ int udp_end(uint16_t nLocalPort) {
 	for (auto i = 0; i < UDP_MAX_PORTS_ALLOWED; i++) {
 		if (s_Port[i] == nLocalPort) {
 			s_Port[i] = 0;
-			s_data[i].size = 0;
+#if defined (UDP_RX_ZERO_COPY)
+			auto &queue = s_Queue[i];
+			while (queue.nTail != queue.nHead) {
+				const auto *p_data = &s_data[queue.nBase + (queue.nTail & queue.nMask)];
+				if (is_loaned(p_data)) {
+					emac_release_pkt(p_data->pData);
+				}
+				queue.nTail++;
+			}
+#else
+			s_Queue[i].nTail = s_Queue[i].nHead;
+#endif
 			return 0;
 		}
 	}
@@ -233,42 +566,93 @@ uint32_t udp_recv1(int nIndex, uint8_t *pData, uint32_t nSize, uint32_t *pFromIp
 	assert(nIndex >= 0);
 	assert(nIndex < UDP_MAX_PORTS_ALLOWED);
 
-	if (__builtin_expect((s_data[nIndex].size == 0), 1)) {
+	auto &queue = s_Queue[nIndex];
+
+	if (__builtin_expect((queue.nHead == queue.nTail), 1)) {
 		return 0;
 	}
 
-	auto *p_data = &s_data[nIndex];
+	const auto *p_data = &s_data[queue.nBase + (queue.nTail & queue.nMask)];
 	const auto i = std::min(nSize, p_data->size);
 
-	net::memcpy(pData, p_data->data, i);
+	net::memcpy(pData, p_data->pData, i);
 
 	*pFromIp = p_data->from_ip;
 	*FromPort = p_data->from_port;
 
-	p_data->size = 0;
+#if defined (UDP_RX_ZERO_COPY)
+	if (is_loaned(p_data)) {
+		emac_release_pkt(p_data->pData);
+	}
+#endif
+
+	queue.nTail++;
 
 	return i;
 }
 
+/**
+ * The returned data is valid until the next call to net_handle()
+ */
 uint32_t udp_recv2(int nIndex, const uint8_t **pData, uint32_t *pFromIp, uint16_t *pFromPort) {
 	assert(nIndex >= 0);
 	assert(nIndex < UDP_MAX_PORTS_ALLOWED);
 
-	auto &p_data = s_data[nIndex];
+	auto &queue = s_Queue[nIndex];
 
-	if (__builtin_expect((p_data.size == 0), 1)) {
+	if (__builtin_expect((queue.nHead == queue.nTail), 1)) {
 		return 0;
 	}
 
-	*pData = p_data.data;
+	const auto &p_data = s_data[queue.nBase + (queue.nTail & queue.nMask)];
+
+	*pData = p_data.pData;
 	*pFromIp = p_data.from_ip;
 	*pFromPort = p_data.from_port;
 
-	const auto nSize = p_data.size;
+#if defined (UDP_RX_ZERO_COPY)
+	if (is_loaned(&p_data)) {
+		assert(s_nReleasePending < UDP_RX_QUEUE_ENTRIES);
+		s_pReleasePending[s_nReleasePending++] = p_data.pData;
+	}
+#endif
+
+	queue.nTail++;
+
+	return p_data.size;
+}
+
+#if defined (UDP_RX_ZERO_COPY)
+/**
+ * Give the EMAC RX buffers handed out by udp_recv2() back, called from net_handle()
+ */
+void udp_rx_release() {
+	for (uint32_t i = 0; i < s_nReleasePending; i++) {
+		emac_release_pkt(s_pReleasePending[i]);
+	}
 
-	p_data.size = 0;
+	s_nReleasePending = 0;
+}
+#endif
+
+bool udp_get_stats(const uint32_t nIndex, udp::Stats& stats) {
+	if ((nIndex >= UDP_MAX_PORTS_ALLOWED) || (s_Port[nIndex] == 0)) {
+		return false;
+	}
+
+	const auto &queue = s_Queue[nIndex];
+
+	stats.nReceived = queue.nReceived;
+	stats.nOverrun = queue.nOverrun;
+	stats.nPort = s_Port[nIndex];
+	stats.nDepth = static_cast<uint16_t>(queue.nMask + 1U);
+	stats.nHighWater = queue.nHighWater;
+
+	return true;
+}
 
-	return nSize;
+uint32_t udp_get_stats_no_port() {
+	return s_nNoPort;
 }
 
 void udp_send(int nIndex, const uint8_t *pData, uint32_t nSize, uint32_t nRemoteIp, uint16_t nRemotePort) {
@@ -38,6 +38,9 @@ struct DevicesParamsConst {
 	static const char COUNT[];
 	static const char GROUPING_COUNT[];
 
+	static const char LAYOUT[];
+	static const char SEGMENT_LENGTH[];
+
 	static const char SPI_SPEED_HZ[];
 
 	static const char GLOBAL_BRIGHTNESS[];
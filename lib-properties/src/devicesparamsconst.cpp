@@ -37,6 +37,9 @@ const char DevicesParamsConst::LED_T1H[] = "led_t1h";
 const char DevicesParamsConst::COUNT[] = "led_count";
 const char DevicesParamsConst::GROUPING_COUNT[] = "led_group_count";
 
+const char DevicesParamsConst::LAYOUT[] = "led_layout";
+const char DevicesParamsConst::SEGMENT_LENGTH[] = "led_segment_length";
+
 const char DevicesParamsConst::SPI_SPEED_HZ[] = "clock_speed_hz";
 
 const char DevicesParamsConst::GLOBAL_BRIGHTNESS[] = "global_brightness";
@@ -6,98 +6,101 @@
 #include "httpd/httpd.h"
 
 #if !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI))
-# include "dmx.js.h"
+# include "dmx.html.h"
 #endif /* !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI)) */
 #if !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC)
-# include "rtc.html.h"
+# include "rtc.js.h"
 #endif /* !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC) */
-#include "static.js.h"
+#include "default.js.h"
 #include "styles.css.h"
-#include "index.js.h"
-#include "date.js.h"
-#if defined (ENABLE_PHY_SWITCH)
-# include "dsa.js.h"
-#endif /* (ENABLE_PHY_SWITCH) */
+#if !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC)
+# include "rtc.html.h"
+#endif /* !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC) */
 #if defined (NODE_SHOWFILE)
 # include "showfile.html.h"
 #endif /* (NODE_SHOWFILE) */
-#include "default.js.h"
-#if !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC)
-# include "rtc.js.h"
-#endif /* !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC) */
+#if defined (ENABLE_PHY_SWITCH)
+# include "dsa.js.h"
+#endif /* (ENABLE_PHY_SWITCH) */
+#include "index.html.h"
+#if !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI))
+# include "dmx.js.h"
+#endif /* !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI)) */
+#include "date.js.h"
+#if defined (ENABLE_PHY_SWITCH)
+# include "dsa.html.h"
+#endif /* (ENABLE_PHY_SWITCH) */
+#include "static.js.h"
+#include "index.js.h"
 #if !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER)
 # include "rdm.js.h"
 #endif /* !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER) */
 #if !defined (CONFIG_HTTP_HTML_NO_TIME)
 # include "time.js.h"
 #endif /* !defined (CONFIG_HTTP_HTML_NO_TIME) */
-#if !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER)
-# include "rdm.html.h"
-#endif /* !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER) */
-#include "index.html.h"
 #if defined (NODE_SHOWFILE)
 # include "showfile.js.h"
 #endif /* (NODE_SHOWFILE) */
+#if !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER)
+# include "rdm.html.h"
+#endif /* !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER) */
 #if !defined (CONFIG_HTTP_HTML_NO_TIME)
 # include "time.html.h"
 #endif /* !defined (CONFIG_HTTP_HTML_NO_TIME) */
-#if !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI))
-# include "dmx.html.h"
-#endif /* !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI)) */
-#if defined (ENABLE_PHY_SWITCH)
-# include "dsa.html.h"
-#endif /* (ENABLE_PHY_SWITCH) */
 
 struct FilesContent {
 	const char *pFileName;
 	const char *pContent;
 	const uint32_t nContentLength;
+	const char *pContentGzip;
+	const uint32_t nContentGzipLength;
+	const char *pETag;
 	const http::contentTypes contentType;
 };
 
 static constexpr struct FilesContent HttpContent[] = {
 #if !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI))
-	{ "dmx.js", dmx_js, 1361, static_cast<http::contentTypes>(2) },
+	{ "dmx.html", dmx_html, 538, dmx_html_gz, 285, "6e5dc781", static_cast<http::contentTypes>(0) },
 #endif /* !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI)) */
 #if !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC)
-	{ "rtc.html", rtc_html, 1013, static_cast<http::contentTypes>(0) },
+	{ "rtc.js", rtc_js, 843, rtc_js_gz, 354, "7f6bf346", static_cast<http::contentTypes>(2) },
 #endif /* !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC) */
-	{ "static.js", static_js, 1219, static_cast<http::contentTypes>(2) },
-	{ "styles.css", styles_css, 409, static_cast<http::contentTypes>(1) },
-	{ "index.js", index_js, 1140, static_cast<http::contentTypes>(2) },
-	{ "date.js", date_js, 716, static_cast<http::contentTypes>(2) },
-#if defined (ENABLE_PHY_SWITCH)
-	{ "dsa.js", dsa_js, 613, static_cast<http::contentTypes>(2) },
-#endif /* (ENABLE_PHY_SWITCH) */
-#if defined (NODE_SHOWFILE)
-	{ "showfile.html", showfile_html, 1305, static_cast<http::contentTypes>(0) },
-#endif /* (NODE_SHOWFILE) */
-	{ "default.js", default_js, 254, static_cast<http::contentTypes>(2) },
+	{ "default.js", default_js, 254, default_js_gz, 208, "dfd22bbb", static_cast<http::contentTypes>(2) },
+	{ "styles.css", styles_css, 409, styles_css_gz, 228, "2e4b735d", static_cast<http::contentTypes>(1) },
 #if !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC)
-	{ "rtc.js", rtc_js, 843, static_cast<http::contentTypes>(2) },
+	{ "rtc.html", rtc_html, 1013, rtc_html_gz, 453, "24c351c3", static_cast<http::contentTypes>(0) },
 #endif /* !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC) */
+#if defined (NODE_SHOWFILE)
+	{ "showfile.html", showfile_html, 1305, showfile_html_gz, 554, "93e16e9b", static_cast<http::contentTypes>(0) },
+#endif /* (NODE_SHOWFILE) */
+#if defined (ENABLE_PHY_SWITCH)
+	{ "dsa.js", dsa_js, 613, dsa_js_gz, 298, "ab2c5cb7", static_cast<http::contentTypes>(2) },
+#endif /* (ENABLE_PHY_SWITCH) */
+	{ "index.html", index_html, 669, index_html_gz, 344, "04d62a4e", static_cast<http::contentTypes>(0) },
+#if !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI))
+	{ "dmx.js", dmx_js, 1361, dmx_js_gz, 568, "f1713cb1", static_cast<http::contentTypes>(2) },
+#endif /* !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI)) */
+	{ "date.js", date_js, 716, date_js_gz, 316, "b16efd14", static_cast<http::contentTypes>(2) },
+#if defined (ENABLE_PHY_SWITCH)
+	{ "dsa.html", dsa_html, 447, dsa_html_gz, 258, "62152df7", static_cast<http::contentTypes>(0) },
+#endif /* (ENABLE_PHY_SWITCH) */
+	{ "static.js", static_js, 1219, static_js_gz, 496, "2ca1b4af", static_cast<http::contentTypes>(2) },
+	{ "index.js", index_js, 1140, index_js_gz, 593, "cc7ce1f0", static_cast<http::contentTypes>(2) },
 #if !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER)
-	{ "rdm.js", rdm_js, 991, static_cast<http::contentTypes>(2) },
+	{ "rdm.js", rdm_js, 991, rdm_js_gz, 484, "52907924", static_cast<http::contentTypes>(2) },
 #endif /* !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER) */
 #if !defined (CONFIG_HTTP_HTML_NO_TIME)
-	{ "time.js", time_js, 390, static_cast<http::contentTypes>(2) },
+	{ "time.js", time_js, 390, time_js_gz, 216, "1122013c", static_cast<http::contentTypes>(2) },
 #endif /* !defined (CONFIG_HTTP_HTML_NO_TIME) */
-#if !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER)
-	{ "rdm.html", rdm_html, 1142, static_cast<http::contentTypes>(0) },
-#endif /* !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER) */
-	{ "index.html", index_html, 669, static_cast<http::contentTypes>(0) },
 #if defined (NODE_SHOWFILE)
-	{ "showfile.js", showfile_js, 1425, static_cast<http::contentTypes>(2) },
+	{ "showfile.js", showfile_js, 1425, showfile_js_gz, 585, "9e9421c7", static_cast<http::contentTypes>(2) },
 #endif /* (NODE_SHOWFILE) */
+#if !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER)
+	{ "rdm.html", rdm_html, 1142, rdm_html_gz, 601, "7b13c7a7", static_cast<http::contentTypes>(0) },
+#endif /* !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER) */
 #if !defined (CONFIG_HTTP_HTML_NO_TIME)
-	{ "time.html", time_html, 599, static_cast<http::contentTypes>(0) },
+	{ "time.html", time_html, 599, time_html_gz, 305, "11923fc8", static_cast<http::contentTypes>(0) },
 #endif /* !defined (CONFIG_HTTP_HTML_NO_TIME) */
-#if !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI))
-	{ "dmx.html", dmx_html, 538, static_cast<http::contentTypes>(0) },
-#endif /* !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI)) */
-#if defined (ENABLE_PHY_SWITCH)
-	{ "dsa.html", dsa_html, 447, static_cast<http::contentTypes>(0) },
-#endif /* (ENABLE_PHY_SWITCH) */
 };
 
 #endif /* CONTENT_H_ */
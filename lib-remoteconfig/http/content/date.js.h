@@ -45,3 +45,25 @@ static constexpr char date_js[] = {
 0x73, 0x65, 0x74, 0x48, 0x6F, 0x75, 0x72, 0x7D, 0x3A, 0x24, 0x7B, 0x6F, 0x66, 0x66, 0x73, 0x65,
 0x74, 0x4D, 0x69, 0x6E, 0x7D, 0x60, 0x3B, 0x20, 0x20, 0x20, 0x0A, 0x7D, 0x00
 };
+static constexpr char date_js_gz[] = {
+0x1F, '\x8B', 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, '\x9D', 0x52, 0x3D, 0x6F, '\x83', 0x30,
+0x10, '\xDD', '\xF9', 0x15, 0x37, '\xD0', 0x70, 0x56, 0x04, '\xA5', 0x1D, 0x3A, '\x84', '\xA2', 0x2E, 0x55,
+'\x95', 0x05, 0x75, 0x68, '\x96', 0x76, 0x0A, 0x05, 0x13, 0x2C, '\x81', 0x2D, '\x81', 0x19, 0x52, '\xC4',
+0x7F, '\xEF', 0x5D, '\x9A', 0x0F, 0x1A, '\xE8', '\xD2', '\xC5', 0x67, '\xBD', 0x7B, '\xEF', '\xFC', '\xEE', '\xCE',
+0x45, '\xA7', 0x33, '\xAB', '\x8C', '\x86', '\xC2', 0x34, 0x75, 0x6A, '\x9F', 0x53, 0x2B, 0x37, '\xAA', '\x96',
+'\x98', '\xD3', 0x45, 0x40, '\xEF', 0x64, 0x46, '\xB7', 0x16, '\xF6', 0x32, 0x6D, 0x20, 0x06, 0x06, '\x83',
+'\x9D', '\xB4', 0x2F, 0x5D, 0x55, '\xBD', 0x13, '\x84', 0x22, 0x3A, 0x12, 0x6A, '\xAA', 0x10, 0x03, 0x7A,
+'\xA1', 0x07, 0x4B, '\xC0', 0x13, 0x2F, 0x31, '\xDA', '\x96', 0x28, 0x08, '\xBA', 0x13, 0x22, 0x68, 0x2B,
+'\x95', 0x49, '\xF4', '\xEF', '\xCF', '\xA2', 0x3C, '\xDD', 0x5F, 0x44, 0x27, 0x0D, 0x3B, '\xC0', 0x39, 0x76,
+0x69, '\xBA', 0x66, 0x4A, 0x5F, 0x13, '\xDA', '\xCE', '\xF2', 0x6B, '\xA5', '\xA7', '\xF4', 0x44, '\xE9', '\xCE',
+'\xCA', 0x79, 0x41, 0x2B, '\xB3', '\xA9', '\xE0', 0x4D, 0x52, 0x32, '\x9F', 0x17, '\x98', '\xA2', 0x68, '\xA5',
+0x1D, '\xCD', '\x85', 0x27, '\xF7', 0x65, '\xB4', 0x7C, 0x3D, 0x24, '\xF0', '\x8A', '\xB8', '\xFE', '\xD5', 0x40,
+'\x92', '\xDA', 0x32, 0x28, 0x2A, 0x63, 0x1A, 0x3C, 0x5C, '\xD3', '\xCF', 0x16, 0x7F, 0x78, 0x02, 0x6E,
+'\xE1', 0x21, '\xFC', '\xFB', '\xC1', 0x64, '\xDC', '\xD8', 0x44, 0x7B, '\xC3', '\xDA', '\x99', '\xE6', '\xD4', '\x8E',
+0x55, 0x47, '\xCB', '\x8F', 0x31, '\x84', '\xF0', 0x04, '\xDE', '\xD2', '\x83', 0x15, 0x78, '\xBE', 0x17, 0x39,
+'\xAA', 0x00, '\xC4', '\xB1', 0x4F, 0x62, 0x08, 0x58, 0x2C, 0x00, 0x47, '\x8F', 0x32, '\xC6', '\x9F', '\xA2',
+'\x91', '\xB6', 0x6B, 0x34, 0x6C, '\xDD', '\x9E', 0x3F, '\xC6', '\xE0', '\xBB', 0x3D, '\xED', '\x9F', 0x03, 0x6D,
+0x74, '\xD8', '\xB8', 0x3D, '\xAF', 0x6A, 0x58, 0x11, '\xAA', 0x34, 0x07, 0x1A, '\xEC', '\xF0', '\xB1', '\x8D',
+0x00, '\x9C', 0x01, '\xFE', '\xA3', '\xA5', '\x93', '\xDC', 0x53, '\xB8', '\xF8', '\xE3', '\xD4', '\xD9', '\xD8', '\xC0',
+'\xB5', '\xA9', '\xF8', 0x37, '\xCC', 0x53, '\xC1', '\xA9', '\xCC', 0x02, 0x00, 0x00, 
+};
@@ -16,3 +16,19 @@ static constexpr char default_js[] = {
 0x6E, 0x73, 0x65, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x7B, 0x20, 0x67, 0x65, 0x74, 0x5F, 0x74, 0x78,
 0x74, 0x28, 0x73, 0x65, 0x6C, 0x29, 0x3B, 0x20, 0x7D, 0x7D, 0x29, 0x3B, 0x0A, 0x7D, 0x00
 };
+static constexpr char default_js_gz[] = {
+0x1F, '\x8B', 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x3D, 0x4F, 0x31, '\x8E', '\xC2', 0x30,
+0x10, '\xEC', '\xFD', '\x8A', '\xED', '\x9C', 0x48, '\xB9', 0x5C, '\x9F', 0x08, '\x9A', '\xEB', '\xAE', '\x80', '\x93',
+'\xA0', 0x3B, 0x21, 0x64, '\xE2', 0x0D, 0x31, '\xE4', '\xBC', 0x56, '\xBC', 0x20, '\xA2', '\xC8', 0x7F, 0x67,
+0x21, 0x70, '\xDD', '\xCC', '\xCE', 0x68, 0x76, '\xA6', '\xBD', '\xF8', '\x86', 0x1D, 0x79, 0x18, 0x30, 0x22,
+0x67, 0x11, '\xFB', 0x1C, 0x26, 0x75, 0x35, 0x03, 0x58, 0x58, '\xC0', '\x94', '\xEA', 0x27, '\xA6', 0x0B,
+'\xBF', '\x98', '\xA0', 0x5F, 0x31, '\xED', '\x84', '\xDA', 0x59, 0x0B, 0x66, '\xEC', '\xC9', 0x3C, '\xDC', '\xDF',
+'\x9B', '\xF5', '\xAA', '\x8C', 0x3C, 0x38, 0x7F, 0x74, '\xED', '\x98', '\x89', 0x35, '\xAF', 0x55, '\x8B', '\xDC',
+0x74, '\x99', '\xFE', 0x3C, 0x45, '\xF2', '\xBA', '\x90', '\xEC', 0x3F, '\xE4', '\x8E', 0x6C, 0x05, '\xFA', 0x67,
+'\xBD', '\xD9', '\xEA', 0x42, 0x75, 0x68, 0x2C, 0x0E, '\xB1', 0x12, 0x49, 0x7F, '\x91', 0x67, '\xF4', '\xFC',
+'\xB1', 0x1D, 0x03, 0x6A, '\xB1', '\x98', 0x10, 0x7A, '\xD7', '\x98', 0x47, '\xC1', 0x39, 0x40, '\xA5', 0x42,
+0x1D, '\xC8', '\x8E', '\xD5', '\xFB', '\xAD', 0x4A, 0x39, '\x94', '\xDC', '\xA1', '\xCF', 0x64, 0x40, 0x20, 0x1F,
+0x11, 0x16, 0x4B, '\x98', 0x5C, 0x0B, '\xFF', '\x87', '\x92', '\xCE', '\xB2', 0x09, '\x8E', '\xC8', 0x7B, '\xBE',
+'\xCD', 0x13, 0x6B, 0x48, 0x49, '\xBA', '\xA5', 0x3B, 0x57, 0x00, 0x60, 0x78, '\xFE', 0x00, 0x00, 0x00,
+
+};
@@ -34,3 +34,23 @@ static constexpr char dmx_html[] = {
 0x29, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x62, 0x6F, 0x64,
 0x79, 0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x00
 };
+static constexpr char dmx_html_gz[] = {
+0x1F, '\x8B', 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, '\x95', 0x52, '\xCD', 0x4E, '\xC3', 0x30,
+0x0C, '\xBE', '\xF7', 0x29, 0x42, 0x2E, '\xDB', 0x2E, '\x8B', 0x38, '\xE3', '\xE6', '\xC2', '\xB8', '\x81', '\x98',
+0x00, 0x21, 0x38, '\xA6', '\xA9', '\xA7', 0x66, '\xCB', '\x9A', 0x2A, 0x71, '\xAB', '\xED', '\xED', '\xF1', '\x9A',
+0x6E, 0x62, 0x20, 0x21, 0x71, '\xB2', 0x65, 0x7F, 0x3F, '\xB6', 0x13, '\xB8', 0x59, 0x3D, '\xDF', '\xBF',
+0x7D, '\xAE', 0x1F, 0x44, 0x43, 0x7B, '\xAF', 0x0B, 0x38, 0x07, 0x34, '\xB5', 0x06, '\xEF', '\xDA', '\x9D',
+'\x88', '\xE8', 0x4B, '\x99', '\xE8', '\xE8', 0x31, 0x35, '\x88', 0x24, 0x45, 0x13, 0x71, 0x73, '\xAE', 0x2C,
+0x6D, 0x4A, 0x52, 0x28, 0x0D, '\xE4', '\xC8', '\xA3', 0x5E, 0x3D, 0x7D, '\x80', '\xCA', 0x29, '\xA8', 0x51,
+'\xA3', '\x80', 0x2A, '\xD4', '\xC7', 0x49, 0x11, '\xA3', '\x86', '\xDE', 0x0B, 0x57, '\x97', '\xD2', '\xD5', '\x8F',
+0x2E, '\x91', 0x64, 0x58, '\xEF', 0x27, 0x2C, 0x77, 0x0B, '\xE8', 0x34, 0x54, 0x3D, 0x51, 0x68, 0x45,
+0x68, '\xAD', 0x77, 0x76, 0x57, 0x4A, '\xB6', '\x8B', '\xEC', 0x3D, 0x5F, 0x48, '\xFD', '\x92', 0x53, 0x50,
+0x19, '\xC3', '\xC4', '\x8E', 0x39, '\xB5', 0x1B, '\x84', '\xF5', 0x26, '\xA5', '\xD3', 0x54, '\x86', 0x12, '\xAB',
+'\x92', '\xA9', 0x3C, 0x4E, 0x46, '\xAF', 0x63, 0x4D, 0x54, 0x21, '\xB2', 0x45, 0x39, '\xBB', '\x9D', 0x31,
+0x6D, '\xEC', 0x73, 0x64, '\xEA', '\xB5', 0x40, 0x17, '\xE2', 0x2F, '\x81', '\xF5', 0x58, '\xFB', 0x4B, 0x60,
+0x13, 0x02, 0x5D, 0x2D, '\xF7', '\x8E', 0x31, '\xB9', '\xD0', 0x5E, '\xF6', '\x9B', 0x00, 0x05, 0x24, 0x1B,
+0x5D, 0x47, 0x22, 0x45, '\x9B', '\x87', 0x75, 0x76, '\xB9', 0x65, 0x6D, 0x3A, 0x76, 0x58, 0x4A, '\xC2',
+0x03, '\xA9', '\xAD', 0x19, 0x4C, 0x46, '\x9D', '\xD8', 0x39, '\xFB', 0x41, '\xAC', '\xF7', '\x87', 0x7F, '\xB1',
+'\xB4', '\xE7', 0x5B, '\xCF', 0x17, 0x77, 0x43, '\x9E', '\x8A', '\xB3', '\xCB', 0x4D, '\xBF', 0x61, '\xD5', '\xF4',
+0x52, 0x6A, '\xFC', 0x03, 0x5F, '\xF8', '\x90', 0x25, '\xF0', 0x1A, 0x02, 0x00, 0x00, 
+};
@@ -86,3 +86,41 @@ static constexpr char dmx_js[] = {
 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x7B, 0x7D, 0x0A,
 0x7D, 0x00
 };
+static constexpr char dmx_js_gz[] = {
+0x1F, '\x8B', 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, '\x8D', 0x54, 0x5D, 0x6F, '\x9B', 0x30,
+0x14, 0x7D, '\xE7', 0x57, 0x5C, '\xA1', 0x49, '\x80', '\x92', 0x11, 0x69, '\xD5', 0x5E, '\x92', '\xC0', '\xA4',
+0x2E, '\xD5', '\xD6', 0x69, '\xDD', '\xAA', 0x66, 0x0F, 0x7B, '\x8C', '\x8B', '\x9D', '\x82', 0x04, 0x36, '\xB2',
+'\x9D', '\xB6', 0x11, '\xE2', '\xBF', '\xEF', '\xDA', 0x0E, 0x6E, '\xC2', 0x12, 0x6D, 0x79, '\x88', '\xF0', 0x39,
+'\xE7', 0x7E, 0x70, 0x7D, 0x2E, 0x44, '\xED', 0x79, 0x01, '\xDB', 0x1D, 0x2F, 0x74, 0x25, 0x38, 0x48,
+'\xB6', '\x95', 0x4C, '\x95', 0x71, 0x02, 0x5D, '\xA0', '\xE5', 0x1E, '\xFF', 0x6B, '\xA6', '\x81', 0x66, '\xE4',
+'\x85', 0x54, 0x1A, '\x9E', '\x98', '\xFE', '\xB6', '\xFE', '\xF9', 0x23, '\x8E', 0x68, '\xF3', 0x3A, 0x6B, '\x85',
+'\xD4', 0x4A, 0x13, '\xBD', 0x53, 0x51, 0x62, 0x55, 0x25, '\x95', 0x2A, '\x8B', '\x96', 0x5A, '\xE6', '\x91',
+0x3D, 0x6B, 0x4A, '\x87', 0x23, 0x4D, '\xB7', 0x42, '\xDE', '\x90', '\xA2', '\x8C', 0x2B, '\xCD', 0x1A, '\xC8',
+0x72, 0x4C, 0x6C, '\xE4', '\x93', 0x6C, '\xB3', '\xD4', 0x65, '\xFE', '\xAE', 0x33, 0x70, 0x6A, 0x32, '\xF6',
+'\xCB', 0x19, 0x02, '\x9B', 0x00, '\x83', 0x2D, 0x49, 0x07, '\x92', 0x56, '\x92', '\xD9', 0x1E, '\x8D', '\x82',
+'\xA2', '\xA2', 0x4F, 0x16, 0x01, 0x15, '\xC5', '\xAE', 0x61, 0x5C, '\xA7', '\xD8', '\xD9', 0x4D, '\xCD', '\xCC',
+'\xE3', '\xF5', '\xFE', '\x96', '\xC6', 0x61, 0x45, '\xD7', '\xD8', '\x9A', 0x0A, '\x93', '\xB4', '\xE2', '\x9C', '\xC9',
+'\xAF', '\xBF', '\xEE', '\xBE', 0x67, '\xB6', 0x60, '\x84', '\xD1', '\xD8', '\xD1', '\xC4', '\xE4', 0x3F, 0x3C, '\xBB',
+0x66, 0x25, 0x64, '\xE0', '\xDE', '\xF2', 0x5E, '\x8A', '\xA6', 0x52, 0x2C, 0x25, 0x75, 0x1D, 0x63, '\xE7',
+0x0D, 0x69, 0x7D, '\xD7', 0x27, 0x03, 0x70, 0x2F, '\xFF', 0x29, '\x82', 0x09, '\xF8', '\xF6', '\x93', 0x54,
+'\x97', '\x8C', '\xC7', 0x38, '\xC3', '\xD6', '\xE8', '\xE3', 0x2E, 0x30, '\xE8', '\xFC', 0x4D, 0x30, 0x0D, '\xE8',
+0x1C, 0x3A, 0x50, '\xD8', '\xE9', 0x1C, '\x8C', 0x2C, '\xC5', 0x54, '\xA9', 0x39, 0x4E, '\xF1', 0x58, '\xB0',
+'\xEA', '\x99', '\xD1', 0x23, 0x62, '\x80', '\xA0', '\x9F', 0x06, 0x12, 0x03, 0x03, 0x17, '\xD8', 0x41, 0x51,
+0x13, '\xA5', 0x0E, 0x42, 0x49, 0x1B, '\x9B', 0x21, '\xB5', '\xE0', 0x14, 0x68, '\xA5', 0x0A, '\xF1', '\xCC',
+'\xE4', 0x7E, '\xCC', 0x7B, '\xC2', '\xA6', '\xF3', '\xD5', 0x3A, 0x78, 0x12, '\x82', 0x1E, '\x89', 0x07, 0x2A,
+0x35, '\xF8', 0x14, 0x1E, '\xC9', 0x59, 0x12, '\xE1', '\xF3', '\xB5', '\xBC', '\xC2', '\x93', 0x41, '\xDF', '\xF7',
+0x09, '\xFE', 0x16, 0x68, '\xAA', 0x54, '\xE1', 0x18, '\xE2', '\x98', 0x60, '\xDE', '\xC4', 0x39, 0x41, 0x32,
+'\xBD', '\x93', 0x1C, '\xD0', 0x24, 0x15, '\xA7', '\xB7', '\x9C', '\xB2', 0x57, 0x3F, 0x70, 0x3F, 0x37, '\xC8',
+0x32, '\xBC', 0x1F, 0x37, 0x63, 0x78, '\xFF', 0x1F, '\xDA', 0x47, '\xA7', '\xB5', 0x36, 0x79, 0x73, 0x26,
+'\xBA', 0x0D, '\xA4', 0x78, 0x51, 0x2D, '\xE1', 0x59, 0x78, 0x15, '\xE6', '\xF7', '\xA8', '\xB1', '\x8E', 0x33,
+0x44, 0x21, 0x6A, 0x47, 0x7C, 0x08, '\xF3', '\xD5', '\xDD', '\xEF', '\xBF', '\xF1', '\x8F', 0x61, '\xFE', '\xB0',
+'\xBA', 0x73, '\xF8', '\xCC', 0x66, 0x1B, 0x65, '\xC4', '\xC0', 0x35, 0x0E, '\xDA', 0x47, 0x1E, 0x13, 0x0F,
+'\x87', '\xA9', '\x9C', 0x2D, 0x77, 0x12, '\xE5', '\x89', '\xAB', 0x71, '\xD4', 0x51, '\xD1', '\xFC', '\xB3', '\xB9',
+'\xEC', 0x21, 0x26, 0x5F, 0x0D, '\xA3', '\xF6', '\xC8', 0x17, '\xBC', 0x3B, 0x7F, '\xB8', 0x26, '\xF4', '\x92',
+'\xD4', '\xED', '\x80', 0x5D, '\xD6', '\xC8', 0x5C, '\xCF', '\xB0', '\xA9', '\xAD', '\xBB', '\x9C', 0x61, 0x11, 0x4D,
+0x51, '\xB3', '\x8C', '\xAD', 0x5F, 0x53, '\xEA', 0x11, 0x6A, '\xED', 0x35, '\xC6', 0x06, 0x1B, '\x9C', '\xE2',
+'\xF2', '\xC8', '\xAA', 0x67, 0x19, 0x6F, '\x9A', 0x31, 0x7B, '\xE2', '\xCA', '\x8B', 0x24, '\xBA', '\xF2', 0x22,
+0x37, 0x4E, 0x6D, 0x5E, 0x7D, '\xB3', '\xF8', '\xD7', '\x97', '\xC4', 0x78, '\xE4', '\xCC', '\x97', 0x04, 0x07,
+0x13, '\xF4', 0x50, 0x10, 0x5D, '\x94', 0x10, 0x33, 0x29, '\x85', 0x4C, '\xBA', 0x3E, '\xE8', '\xFF', 0x00,
+'\xD4', 0x61, '\x89', '\xD8', 0x51, 0x05, 0x00, 0x00, 
+};
@@ -28,3 +28,22 @@ static constexpr char dsa_html[] = {
 0x65, 0x73, 0x68, 0x28, 0x29, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C,
 0x2F, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A, 0x00
 };
+static constexpr char dsa_html_gz[] = {
+0x1F, '\x8B', 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, '\x95', '\x91', '\xB1', 0x6E, 0x03, 0x21,
+0x0C, '\x86', '\xF7', 0x7B, 0x0A, '\xCA', '\x92', 0x64, 0x09, '\xEA', 0x5C, 0x60, 0x69, '\xBB', 0x55, 0x4A,
+0x54, 0x45, '\x95', 0x3A, 0x72, '\xE0', '\xE8', 0x48, '\xE8', 0x71, 0x02, 0x5F, '\x94', 0x7B, '\xFB', 0x1A,
+0x41, '\xA2', '\xB6', 0x5B, 0x27, 0x5B, '\xF8', '\xFB', '\xED', '\xDF', 0x46, 0x3E, '\xBC', '\xEC', '\x9E', 0x0F,
+'\x9F', '\xFB', 0x57, 0x36, '\xE0', 0x57, '\xD0', '\x9D', '\xBC', 0x05, 0x30, '\x8E', 0x42, '\xF0', '\xE3', '\x99',
+0x25, 0x08, '\x8A', 0x67, 0x5C, 0x02, '\xE4', 0x01, 0x00, 0x39, 0x1B, 0x12, 0x1C, 0x6F, 0x2F, 0x5B,
+'\x9B', 0x33, 0x67, '\x82', 0x58, '\xF4', 0x18, 0x40, 0x4B, 0x51, 0x63, 0x27, 0x45, '\xEB', '\xD1', 0x47,
+'\xB7', '\xB4', '\x8E', '\x90', '\xB4', '\x9C', 0x03, '\xF3', 0x4E, 0x71, '\xEF', '\xDE', 0x7C, 0x46, 0x4E, '\xFC',
+0x1C, 0x74, 0x65, '\xA9', '\xDA', '\xC9', 0x49, '\xCB', 0x7E, 0x46, '\x8C', 0x23, '\x8B', '\xA3', 0x0D, '\xDE',
+'\x9E', 0x15, '\xA7', 0x69, '\x89', 0x46, '\xAF', 0x37, 0x5C, '\xBF', '\xD7', 0x54, '\x8A', '\xCA', '\x90', 0x70,
+0x2A, '\x93', 0x4D, 0x1F, '\xA0', 0x75, 0x3D, 0x5C, '\xC9', 0x60, 0x1F, 0x13, 0x75, 0x53, '\xAB', '\xC7',
+0x55, '\xF1', 0x53, '\xAA', 0x44, 0x1D, 0x63, '\xC4', 0x5F, 0x06, 0x3E, 0x20, 0x65, 0x1F, '\xC7', '\xBB',
+'\x87', 0x06, 0x74, 0x32, '\xDB', '\xE4', 0x27, 0x64, 0x39, '\xD9', '\xB2', '\xA5', 0x41, 0x6F, '\xB7', 0x27,
+0x5A, 0x12, '\x97', 0x09, 0x14, 0x47, '\xB8', '\xA2', 0x38, '\x99', '\x8B', '\xA9', 0x54, 0x51, '\xD7', '\xEC',
+'\x8F', '\xD0', 0x65, '\xF3', 0x2F, '\x95', 0x0E, 0x74, '\x8F', '\xF5', '\xE6', '\xE9', 0x52, 0x5D, 0x51, 0x76,
+'\xDF', '\xFB', 0x07, 0x2B, '\xDA', 0x35, 0x45, '\xFD', '\xA7', 0x6F, 0x39, '\x97', '\xDC', '\x94', '\xBF', 0x01,
+0x00, 0x00, 
+};
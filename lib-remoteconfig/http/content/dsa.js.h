@@ -39,3 +39,24 @@ static constexpr char dsa_js[] = {
 0x78, 0x74, 0x22, 0x29, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D,
 0x20, 0x68, 0x3B, 0x0A, 0x7D, 0x00
 };
+static constexpr char dsa_js_gz[] = {
+0x1F, '\x8B', 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, '\xAD', '\x90', 0x5D, 0x4B, '\xC3', 0x30,
+0x14, '\x86', '\xEF', '\xFB', 0x2B, '\xC2', 0x10, '\xDA', 0x22, '\xB4', 0x3F, '\xA0', 0x1F, '\xE0', '\xC7', 0x44,
+'\xA5', 0x4E, 0x61, '\xC3', '\xEB', 0x65, 0x4D, 0x6A, '\x82', 0x59, 0x52, '\x92', 0x53, '\xB7', 0x31, '\xF6',
+'\xDF', 0x3D, 0x69, 0x67, 0x11, '\x8A', 0x7A, '\xE3', 0x45, 0x21, '\xEF', 0x7B, 0x3E, '\xFA', '\x9C', '\x97',
+'\xBA', '\x83', '\xAE', 0x49, '\xD3', '\xE9', 0x1A, '\xA4', '\xD1', '\xC4', '\xF2', '\xC6', 0x72, 0x27, '\xA2', '\x98',
+0x1C, 0x03, '\xC5', '\x81', 0x30, 0x0A, '\x94', 0x14, '\x84', '\xEE', '\xA8', 0x04, '\xF2', '\xC6', '\xE1', 0x71,
+'\xF9', '\xBC', '\x88', 0x42, '\xE6', 0x68, '\xDA', 0x1A, 0x0B, 0x0E, 0x28, 0x74, 0x2E, '\x8C', '\xFB', 0x56,
+'\x81', 0x7D, 0x61, 0x0E, 0x74, '\xA3', 0x78, '\x99', '\x83', '\xC5', 0x4F, '\x94', 0x2F, '\xD8', '\x94', '\xA7',
+'\xF8', '\xF0', '\xA2', '\x92', '\xFA', 0x7D, 0x14, '\xCB', '\x96', 0x73, 0x36, '\xAA', '\xDB', '\xAE', 0x55, 0x7C,
+0x3F, '\xCA', 0x3B, 0x65, 0x76, '\xE4', '\xC6', 0x68, '\xB0', 0x46, 0x0D, 0x66, '\x8A', 0x0B, '\xC3', 0x2C,
+'\xF0', 0x38, 0x49, 0x63, '\xEC', '\x9C', '\xD6', 0x22, '\x92', '\xC0', '\xB7', '\xA4', 0x28, '\x91', 0x54, '\x90',
+'\xCB', '\x82', '\xAC', '\x87', '\x9F', '\xB2', '\xF2', '\xE2', '\xE8', 0x2B, '\x89', 0x07, 0x3C, '\xE1', 0x20, '\xFB',
+0x6E, 0x2A, 0x64, '\x98', '\x98', '\xCE', '\xB3', 0x4C, 0x5C, '\xD6', 0x33, 0x4D, '\xEC', 0x06, '\xD9', '\xEA',
+0x01, '\xED', 0x5C, '\xF3', 0x6C, '\xEB', 0x2C, 0x38, '\xC5', '\xD9', 0x00, 0x12, '\xA2', '\xD3', '\xA7', 0x10,
+0x7E, '\xE9', 0x0D, '\xC2', 0x07, 0x3F, 0x47, '\xF9', '\xA1', '\xA8', '\xEE', 0x27, 0x30, '\xC9', '\xF3', '\xC4',
+0x2F, 0x31, '\xBE', 0x56, 0x57, '\x8B', '\x95', 0x2F, '\xFF', 0x6F, 0x32, '\xE3', '\xDA', '\xBF', '\xAF', 0x62,
+'\xA6', '\xEE', '\xB6', 0x5C, 0x43, '\x82', 0x57, '\xCC', 0x15, '\xF7', '\xCF', '\xEB', '\xC3', 0x03, '\x8B', 0x66,
+'\x92', '\xAD', '\xF6', 0x30, '\x8B', 0x13, '\xA9', 0x35, '\xB7', '\xF7', '\xAB', '\xA7', 0x0A, '\xEF', 0x15, '\xB8',
+'\xE3', 0x13, '\xEB', 0x00, 0x0C, '\xC1', 0x65, 0x02, 0x00, 0x00, 
+};
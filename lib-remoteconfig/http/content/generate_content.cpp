@@ -25,9 +25,11 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <cstdint>
 #include <cstring>
 #include <dirent.h>
 #include <cassert>
+#include <zlib.h>
 
 #include "httpd/httpd.h"
 
@@ -44,6 +46,9 @@ static constexpr char content_header[] =
 		"\tconst char *pFileName;\n"
 		"\tconst char *pContent;\n"
 		"\tconst uint32_t nContentLength;\n"
+		"\tconst char *pContentGzip;\n"
+		"\tconst uint32_t nContentGzipLength;\n"
+		"\tconst char *pETag;\n"
 		"\tconst http::contentTypes contentType;\n"
 		"};\n\n"
 		"static constexpr struct FilesContent HttpContent[] = {\n";
@@ -66,6 +71,8 @@ static constexpr char HAVE_TIME_END[] = "#endif /* !defined (CONFIG_HTTP_HTML_NO
 static constexpr char HAVE_RTC_BEGIN[] = "#if !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC)\n";
 static constexpr char HAVE_RTC_END[] = "#endif /* !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC) */\n";
 
+static constexpr uint32_t MAX_FILE_SIZE = 65536;
+
 static FILE *pFileContent;
 static FILE *pFileIncludes;
 
@@ -86,6 +93,67 @@ static http::contentTypes getContentType(const char *pFileName) {
 	return http::contentTypes::NOT_DEFINED;
 }
 
+static void write_array(FILE *pFileOut, const char *pConstantName, const uint8_t *pData, const uint32_t nSize, const bool bTerminate) {
+	char buffer[64];
+
+	fwrite("static constexpr char ", sizeof(char), 22, pFileOut);
+	fwrite(pConstantName, sizeof(char), strlen(pConstantName), pFileOut);
+	fwrite("[] = {\n", sizeof(char), 7, pFileOut);
+
+	for (uint32_t nOffset = 0; nOffset < nSize; nOffset++) {
+		/* A character literal above 0x7F is valid when char is signed */
+		const auto i = snprintf(buffer, sizeof(buffer) - 1, pData[nOffset] < 0x80 ? "0x%02X,%c" : "'\\x%02X',%c", pData[nOffset], (nOffset + 1) % 16 == 0 ? '\n' : ' ');
+		assert(i < static_cast<int>(sizeof(buffer)));
+
+		fwrite(buffer, sizeof(char), i, pFileOut);
+	}
+
+	if (bTerminate) {
+		fwrite("0x00\n};\n", sizeof(char), 8, pFileOut);
+	} else {
+		fwrite("\n};\n", sizeof(char), 4, pFileOut);
+	}
+}
+
+/*
+ * gzip format, no file name and no time stamp in the header, so the output is reproducible.
+ */
+static uint32_t compress_gzip(const uint8_t *pIn, const uint32_t nInSize, uint8_t *pOut, const uint32_t nOutSize) {
+	z_stream stream;
+	memset(&stream, 0, sizeof(stream));
+
+	auto nResult = deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 9, Z_DEFAULT_STRATEGY);
+	assert(nResult == Z_OK);
+
+	stream.next_in = const_cast<uint8_t *>(pIn);
+	stream.avail_in = nInSize;
+	stream.next_out = pOut;
+	stream.avail_out = nOutSize;
+
+	nResult = deflate(&stream, Z_FINISH);
+	assert(nResult == Z_STREAM_END);
+
+	const auto nSize = static_cast<uint32_t>(stream.total_out);
+
+	deflateEnd(&stream);
+
+	return nSize;
+}
+
+/*
+ * FNV-1a, the strong ETag changes when the content changes.
+ */
+static uint32_t etag(const uint8_t *pData, const uint32_t nSize) {
+	uint32_t nHash = 2166136261U;
+
+	for (uint32_t i = 0; i < nSize; i++) {
+		nHash ^= pData[i];
+		nHash *= 16777619U;
+	}
+
+	return nHash;
+}
+
 static int convert_to_h(const char *pFileName) {
 	printf("File to convert: %s, ", pFileName);
 
@@ -179,9 +247,7 @@ static int convert_to_h(const char *pFileName) {
 		fwrite(HAVE_RTC_END, sizeof(char),sizeof(HAVE_RTC_END) - 1, pFileIncludes);
 	}
 
-	fwrite("static constexpr char ", sizeof(char), 22, pFileOut);
-
-	char *pConstantName = new char[nFileNameLength + 1];
+	char *pConstantName = new char[nFileNameLength + 4];
 	assert(pConstantName != nullptr);
 
 	strncpy(pConstantName, pFileName, nFileNameLength);
@@ -195,13 +261,11 @@ static int convert_to_h(const char *pFileName) {
 
 	printf("Constant name: %s, ", pConstantName);
 
-	fwrite(pConstantName, sizeof(char), strlen(pConstantName), pFileOut);
-	fwrite(pConstantName, sizeof(char), strlen(pConstantName), pFileContent);
-	fwrite("[] = {\n", sizeof(char), 7, pFileOut);
+	auto *pContent = new uint8_t[MAX_FILE_SIZE];
+	assert(pContent != nullptr);
 
-	unsigned nOffset = 0;
 	auto doRemoveWhiteSpaces = true;
-	int nFileSize = 0;
+	uint32_t nFileSize = 0;
 	int c;
 
 	while ((c = fgetc (pFileIn)) != EOF) {
@@ -217,25 +281,44 @@ static int convert_to_h(const char *pFileName) {
 			}
 		}
 
-		i = snprintf(buffer, sizeof(buffer) - 1, "0x%02X,%c", c, ++nOffset % 16 == 0 ? '\n' : ' ');
-		assert(i < static_cast<int>(sizeof(buffer)));
+		assert(nFileSize < MAX_FILE_SIZE);
+		pContent[nFileSize++] = static_cast<uint8_t>(c);
+	}
 
-		fwrite(buffer, sizeof(char), i, pFileOut);
+	write_array(pFileOut, pConstantName, pContent, nFileSize, true);
 
-		nFileSize++;
-	}
+	auto *pContentGzip = new uint8_t[MAX_FILE_SIZE];
+	assert(pContentGzip != nullptr);
+
+	const auto nGzipSize = compress_gzip(pContent, nFileSize, pContentGzip, MAX_FILE_SIZE);
+	const auto nETag = etag(pContent, nFileSize);
+
+	const auto nConstantNameLength = strlen(pConstantName);
 
-	fwrite("0x00\n};\n", sizeof(char), 8, pFileOut);
+	fwrite(pConstantName, sizeof(char), nConstantNameLength, pFileContent);
+	i = snprintf(buffer, sizeof(buffer) - 1, ", %u, ", nFileSize);
+	fwrite(buffer, sizeof(char), i, pFileContent);
+
+	strcat(pConstantName, "_gz");
+
+	write_array(pFileOut, pConstantName, pContentGzip, nGzipSize, false);
+
+	fwrite(pConstantName, sizeof(char), strlen(pConstantName), pFileContent);
+	i = snprintf(buffer, sizeof(buffer) - 1, ", %u, \"%08x\"", nGzipSize, nETag);
+	assert(i < static_cast<int>(sizeof(buffer)));
+	fwrite(buffer, sizeof(char), i, pFileContent);
 
+	delete [] pContent;
+	delete [] pContentGzip;
 	delete [] pFileNameOut;
 	delete [] pConstantName;
 
 	fclose(pFileIn);
 	fclose(pFileOut);
 
-	printf("File size: %d\n", nFileSize);
+	printf("File size: %u, gzip: %u\n", nFileSize, nGzipSize);
 
-	return nFileSize;
+	return static_cast<int>(nFileSize);
 }
 
 int main() {
@@ -299,10 +382,10 @@ int main() {
 				fwrite(pFileName, sizeof(char), i, pFileContent);
 				delete[] pFileName;
 
-				auto nContentLength = convert_to_h(pDirEntry->d_name);
+				convert_to_h(pDirEntry->d_name);
 
 				char buffer[64];
-				i = snprintf(buffer, sizeof(buffer) - 1, ", %d, static_cast<http::contentTypes>(%d)", nContentLength, static_cast<int>(contentType));
+				i = snprintf(buffer, sizeof(buffer) - 1, ", static_cast<http::contentTypes>(%d)", static_cast<int>(contentType));
 				assert(i < static_cast<int>(sizeof(buffer)));
 				fwrite(buffer, sizeof(char), i, pFileContent);
 
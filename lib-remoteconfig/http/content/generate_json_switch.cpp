@@ -30,74 +30,161 @@
 #include <ctype.h>
 #include <cassert>
 
-static constexpr int MAX_LENGTH = 12;
-
-static constexpr char JSON_ENDPOINTS[][MAX_LENGTH] = {
-		"list",
-		"version",
-		"uptime",
-		"display",
-		"directory",
-		"rdm",
-		"queue",
-		"tod",
-		"phystatus",
-		"portstatus",
-		"vlantable",
-		"status",
-		"timedate",
-		"rtcalarm",
-		"polltable",
-		"types"
+/*
+ * Generates json_switch.h with a perfect hash table for the request URIs and
+ * for the request header fields. A lookup is a single hash and one compare.
+ */
+
+struct Key {
+	const char *pName;
+	const char *pId;
 };
 
-inline uint16_t get_uint(const char *pString) {					/* djb2 */
-	uint16_t hash = 5381;										/* djb2 */
-	uint16_t c;													/* djb2 */
-																/* djb2 */
-	while ((c = *pString++) != '\0') {							/* djb2 */
-		hash = static_cast<uint16_t>(((hash << 5) + hash) + c);	/* djb2 */
-	}															/* djb2 */
-																/* djb2 */
-	return hash;												/* djb2 */
-}																/* djb2 */
+static constexpr Key URIS[] = {
+		{ "/",							"INDEX" },
+		{ "/dmx",						"DMX" },
+		{ "/rdm",						"RDM" },
+		{ "/showfile",					"SHOWFILE" },
+		{ "/dsa",						"DSA" },
+		{ "/time",						"TIME" },
+		{ "/rtc",						"RTC" },
+		{ "/json",						"JSON" },
+		{ "/json/action",				"JSON_ACTION" },
+		{ "/json/list",					"JSON_LIST" },
+		{ "/json/version",				"JSON_VERSION" },
+		{ "/json/uptime",				"JSON_UPTIME" },
+		{ "/json/display",				"JSON_DISPLAY" },
+		{ "/json/directory",			"JSON_DIRECTORY" },
+		{ "/json/timedate",				"JSON_TIMEDATE" },
+		{ "/json/rtcalarm",				"JSON_RTCALARM" },
+		{ "/json/rdm",					"JSON_RDM" },
+		{ "/json/polltable",			"JSON_POLLTABLE" },
+		{ "/json/phystatus",			"JSON_PHYSTATUS" },
+		{ "/json/netstats",				"JSON_NETSTATS" },
+		{ "/json/httpstats",			"JSON_HTTPSTATS" },
+		{ "/json/dmx/portstatus",		"JSON_DMX_PORTSTATUS" },
+		{ "/json/dmx/status",			"JSON_DMX_STATUS" },
+		{ "/json/pixel/types",			"JSON_PIXEL_TYPES" },
+		{ "/json/pixel/status",			"JSON_PIXEL_STATUS" },
+		{ "/json/rdm/queue",			"JSON_RDM_QUEUE" },
+		{ "/json/rdm/portstatus",		"JSON_RDM_PORTSTATUS" },
+		{ "/json/rdm/tod",				"JSON_RDM_TOD" },
+		{ "/json/storage/directory",	"JSON_STORAGE_DIRECTORY" },
+		{ "/json/dsa/portstatus",		"JSON_DSA_PORTSTATUS" },
+		{ "/json/dsa/vlantable",		"JSON_DSA_VLANTABLE" },
+		{ "/json/showfile/status",		"JSON_SHOWFILE_STATUS" },
+		{ "/json/showfile/directory",	"JSON_SHOWFILE_DIRECTORY" }
+};
 
-int main() {
-	const auto pFile = fopen("json_switch.h", "w");
-	assert(pFile != nullptr);
+/*
+ * Header field names are case-insensitive, these are hashed in lower case.
+ */
+static constexpr Key HEADERS[] = {
+		{ "content-type",				"CONTENT_TYPE" },
+		{ "content-length",				"CONTENT_LENGTH" },
+		{ "accept-encoding",			"ACCEPT_ENCODING" },
+		{ "if-none-match",				"IF_NONE_MATCH" },
+		{ "connection",					"CONNECTION" }
+};
 
+// begin json_switch.h
+inline uint32_t hash_step(const uint32_t nHash, const uint32_t c) {
+	return (nHash * 33U) ^ c;
+}
 
-	fwrite("#ifndef JSON_SWITCH_H_\n", sizeof(char), 23, pFile);
-	fwrite("#define JSON_SWITCH_H_\n\n", sizeof(char), 24, pFile);
-	fwrite("#include <cstdint>\n\n", sizeof(char), 20, pFile);
-	fwrite("namespace http {\n", sizeof(char), 17, pFile);
-	fwrite("namespace json {\n", sizeof(char), 17, pFile);
-	fwrite("namespace get {\n", sizeof(char), 16, pFile);
+inline uint32_t hash_index(const uint32_t nHash, const uint32_t nMask) {
+	return (nHash ^ (nHash >> 16)) & nMask;
+}
+// end json_switch.h
 
-	char toUpper[MAX_LENGTH];
+static uint32_t hash(uint32_t nSeed, const char *pString) {
+	while (*pString != '\0') {
+		nSeed = hash_step(nSeed, static_cast<uint8_t>(*pString++));
+	}
+	return nSeed;
+}
+
+/*
+ * Search for the seed which gives each key its own slot.
+ */
+static uint32_t find_seed(const Key *pKeys, const uint32_t nKeys, const uint32_t nTableSize) {
+	assert(nKeys <= nTableSize);
+
+	for (uint32_t nSeed = 5381; nSeed != 0; nSeed++) {
+		bool isUsed[256] = {};
+		uint32_t i;
 
-	for (uint32_t i = 0; i < sizeof(JSON_ENDPOINTS) / sizeof(JSON_ENDPOINTS[0]); i++) {
-		size_t j;
-		uint32_t k = 0;
-		for (j = 0; j < strlen(JSON_ENDPOINTS[i]); j++) {
-			if (isalpha(static_cast<int>(JSON_ENDPOINTS[i][j]))) {
-				toUpper[k++] = toupper(static_cast<int>(JSON_ENDPOINTS[i][j]));
+		for (i = 0; i < nKeys; i++) {
+			const auto nIndex = hash_index(hash(nSeed, pKeys[i].pName), nTableSize - 1);
+			if (isUsed[nIndex]) {
+				break;
 			}
+			isUsed[nIndex] = true;
 		}
-		toUpper[k] = '\0';
 
-		char buffer[255];
-		const auto nLength = snprintf(buffer, sizeof(buffer) - 1, "static constexpr uint16_t %-*s= 0x%.4x;\n", MAX_LENGTH, toUpper, get_uint(JSON_ENDPOINTS[i]));
-		fwrite(buffer, sizeof(char), nLength, pFile);
+		if (i == nKeys) {
+			return nSeed;
+		}
+	}
+
+	assert(0);
+	return 0;
+}
 
-		printf("%s", buffer);
+static void write_table(FILE *pFile, const char *pNamespace, const Key *pKeys, const uint32_t nKeys, const uint32_t nTableSize) {
+	assert(nTableSize <= 256);
+	const auto nSeed = find_seed(pKeys, nKeys, nTableSize);
+
+	fprintf(pFile, "namespace %s {\n", pNamespace);
+	fprintf(pFile, "enum class Id : uint8_t {\n");
+	for (uint32_t i = 0; i < nKeys; i++) {
+		fprintf(pFile, "\t%s,\n", pKeys[i].pId);
+	}
+	fprintf(pFile, "\tUNKNOWN\n};\n\n");
+
+	fprintf(pFile, "static constexpr uint32_t SEED = 0x%.8x;\n", nSeed);
+	fprintf(pFile, "static constexpr uint32_t MASK = 0x%.2x;\n\n", nTableSize - 1);
+
+	fprintf(pFile, "static constexpr HashEntry TABLE[%u] = {\n", nTableSize);
+
+	for (uint32_t nIndex = 0; nIndex < nTableSize; nIndex++) {
+		uint32_t i;
+		for (i = 0; i < nKeys; i++) {
+			if (hash_index(hash(nSeed, pKeys[i].pName), nTableSize - 1) == nIndex) {
+				break;
+			}
+		}
+
+		if (i == nKeys) {
+			fprintf(pFile, "\t{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },\n");
+		} else {
+			fprintf(pFile, "\t{ \"%s\", %u, static_cast<uint8_t>(Id::%s) },\n", pKeys[i].pName, static_cast<unsigned int>(strlen(pKeys[i].pName)), pKeys[i].pId);
+		}
+
+		printf("%3u %s\n", nIndex, i == nKeys ? "" : pKeys[i].pName);
 	}
 
-	fwrite("}\n}\n}\n\n", sizeof(char), 7, pFile);
+	fprintf(pFile, "};\n}  // namespace %s\n\n", pNamespace);
+}
+
+int main() {
+	const auto pFile = fopen("json_switch.h", "w");
+	assert(pFile != nullptr);
+
+	fprintf(pFile, "#ifndef JSON_SWITCH_H_\n");
+	fprintf(pFile, "#define JSON_SWITCH_H_\n\n");
+	fprintf(pFile, "#include <cstdint>\n\n");
+	fprintf(pFile, "namespace http {\n");
+	fprintf(pFile, "struct HashEntry {\n\tconst char *pName;\n\tuint8_t nLength;\n\tuint8_t nId;\n};\n\n");
+
+	write_table(pFile, "uri", URIS, sizeof(URIS) / sizeof(URIS[0]), 64);
+	write_table(pFile, "header", HEADERS, sizeof(HEADERS) / sizeof(HEADERS[0]), 16);
+
+	fprintf(pFile, "}  // namespace http\n\n");
 	fclose(pFile);
 
 	system("echo \'namespace http {\' >> json_switch.h");
-	system("grep 'djb2' generate_json_switch.cpp | grep -v grep >> json_switch.h");
+	system("sed -n '/^\\/\\/ begin json_switch.h$/,/^\\/\\/ end json_switch.h$/{//!p}' generate_json_switch.cpp >> json_switch.h");
 	system("echo \'}\n\' >> json_switch.h");
 	system("echo \'#endif /* JSON_SWITCH_H_ */' >> json_switch.h");
 
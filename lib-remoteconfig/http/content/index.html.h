@@ -42,3 +42,27 @@ static constexpr char index_html[] = {
 0x28, 0x29, 0x3B, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x62,
 0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A, 0x00
 };
+static constexpr char index_html_gz[] = {
+0x1F, '\x8B', 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, '\x9D', '\x92', 0x3F, 0x4F, '\xC3', 0x30,
+0x10, '\xC5', '\xF7', 0x7C, 0x0A, '\xE3', '\xA5', '\xED', 0x52, '\x8B', 0x19, 0x27, 0x03, '\x94', '\xAD', 0x52,
+0x11, '\xAA', '\x90', '\x98', '\x90', 0x63, 0x5F, 0x1A, '\xB7', 0x26, '\x8E', '\xEC', 0x4B, '\x94', 0x7C, 0x7B,
+0x2E, '\xFF', 0x4A, 0x61, '\x83', '\xC9', 0x2F, '\xF6', '\xEF', '\x9E', 0x5F, '\xEE', 0x2C, '\xEF', 0x76, '\x87',
+'\xA7', '\xE3', '\xFB', '\xCB', 0x33, 0x2B, '\xF1', '\xD3', 0x65, '\x89', 0x5C, 0x16, 0x50, '\x86', 0x16, 0x67,
+'\xAB', 0x0B, 0x0B, '\xE0', 0x52, 0x1E, '\xB1', 0x77, 0x10, 0x4B, 0x00, '\xE4', '\xAC', 0x0C, 0x50, 0x2C,
+0x3B, 0x5B, 0x1D, 0x23, 0x67, '\x82', 0x58, '\xB4', '\xE8', 0x20, '\x93', 0x62, 0x5A, 0x13, 0x29, 0x66,
+'\x8F', '\xDC', '\x9B', 0x7E, 0x76, '\x84', '\x90', '\xC9', '\xC6', 0x31, 0x6B, 0x52, 0x6E, '\xCD', '\xDE', 0x46,
+'\xE4', '\xC4', 0x37, 0x2E, '\x9B', 0x58, 0x3A, 0x4D, 0x64, '\x9D', '\xC9', 0x08, 0x0E, 0x34, '\xCE', '\xD4',
+'\xCE', 0x06, '\xFA', '\xF0', '\xA1', '\xE7', '\xCC', 0x57, '\xBA', 0x54, '\xD5', 0x09, 0x52, 0x7E, 0x02, '\xFC',
+'\xC0', 0x0E, '\xD7', 0x58, '\xDA', '\xB8', 0x6D, '\x95', 0x6B, 0x60, 0x33, 0x38, 0x4D, '\x85', 0x24, '\xEA',
+0x21, '\x8E', '\xCA', 0x1D, '\xCC', 0x26, '\xC7', '\x8E', 0x52, '\xE7', 0x3E, '\xD0', 0x15, '\xE9', '\xEA', 0x7E,
+0x35, '\x84', 0x1C, 0x4E, '\x89', 0x2A, '\xBC', '\xC7', 0x1F, '\xA9', '\xDE', 0x20, 0x44, '\xEB', '\xAB', 0x6B,
+'\xB0', 0x19, 0x48, '\xA4', '\xB1', '\xED', '\xF0', 0x33, 0x0D, '\xA2', '\xAF', 0x46, '\xD6', 0x79, '\xAD', 0x10,
+0x1E, '\xC7', 0x0D, '\xCE', '\xB4', 0x53, 0x31, '\x92', 0x41, '\xA5', 0x34, '\xDA', 0x16, '\xC6', '\xB4', '\xCE',
+'\xEA', '\xCB', '\xC2', '\xAD', 0x29, '\xE1', 0x7E, 0x54, '\xEC', 0x50, 0x14, 0x52, 0x4C, 0x46, '\xDF', '\x8E',
+0x57, 0x3C, 0x40, 0x4E, 0x57, 0x0E, '\xF8', '\xEB', '\xA8', 0x6E, 0x50, 0x31, 0x65, '\x88', 0x3A, '\xD8',
+0x1A, 0x59, 0x0C, 0x7A, 0x18, '\x82', 0x42, '\xAB', '\xB7', 0x67, '\x9A', 0x01, '\xF6', 0x35, '\xB5', 0x06,
+'\xA1', 0x43, 0x71, 0x56, '\xAD', '\x9A', '\xA8', '\xB1', 0x2D, '\xA3', '\xFA', 0x55, 0x68, 0x2B, 0x03, '\xDD',
+0x3F, '\xEA', 0x0C, 0x14, '\xAA', 0x71, '\xF8', '\xA7', '\xCA', '\xCC', '\xD1', '\xA8', '\xD7', '\x9B', '\x87', 0x76,
+'\xEA', 0x2D, 0x29, '\xB3', 0x4C, '\x95', '\xF4', 0x0D, 0x2E, '\xE6', '\xB7', 0x22, '\xA6', 0x57, '\xF8', 0x05,
+0x01, '\x94', 0x32, '\xA8', '\x9D', 0x02, 0x00, 0x00, 
+};
@@ -72,3 +72,43 @@ static constexpr char index_js[] = {
 0x65, 0x74, 0x5F, 0x74, 0x78, 0x74, 0x28, 0x73, 0x65, 0x6C, 0x29, 0x3B, 0x20, 0x7D, 0x7D, 0x29,
 0x3B, 0x0A, 0x7D, 0x0A, 0x00
 };
+static constexpr char index_js_gz[] = {
+0x1F, '\x8B', 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, '\x85', 0x53, 0x4D, 0x6F, '\xDB', 0x30,
+0x0C, '\xBD', '\xEB', 0x57, 0x08, '\xBA', '\xC8', '\x86', 0x33, '\xA7', '\xD8', 0x31, 0x75, 0x7C, '\xE8', 0x5A,
+0x60, 0x1B, '\xB6', 0x66, 0x40, 0x72, 0x73, '\x83', 0x41, '\xB1', '\xE4', 0x58, '\x8D', 0x23, 0x19, '\x96',
+'\x9C', '\xD5', 0x08, '\xFC', '\xDF', 0x47, '\xC9', 0x71, 0x3E, 0x3A, 0x60, 0x3D, '\x85', 0x26, 0x1F, '\x9F',
+0x1E, 0x1F, 0x19, 0x66, 0x3A, '\x95', '\xE3', '\xA2', 0x55, '\xB9', '\x95', 0x5A, 0x61, 0x2E, 0x1B, '\x91',
+0x5B, '\xDD', 0x74, 0x41, '\x88', '\x8F', '\xA8', 0x12, 0x16, 0x73, 0x3C, '\xC7', '\xEC', 0x0F, '\x93', 0x16,
+0x6F, '\x85', '\xFD', '\xBE', 0x5C, 0x3C, 0x07, '\xF4', 0x0C, '\xA2', '\xA1', '\x87', '\x94', 0x00, 0x21, '\xC4',
+'\x87', 0x05, '\x84', '\x8B', '\xCD', 0x2B, '\x94', '\xE3', '\x9D', '\xE8', 0x4C, '\xC0', 0x33, 0x52, '\xC8', 0x4A,
+0x18, '\xB2', 0x0E, 0x51, 0x11, 0x17, '\xBA', 0x79, 0x62, 0x79, 0x19, '\x8C', '\xCF', 0x05, '\x80', 0x71,
+'\xEF', 0x1C, 0x58, '\x83', 0x0F, '\xD0', 0x79, 0x41, 0x67, 0x50, 0x59, '\xA3', 0x12, 0x47, '\xC0', '\x9C',
+'\xE8', '\xDA', 0x6B, 0x3B, '\xB0', '\xAA', 0x15, 0x73, 0x12, 0x41, 0x29, 0x22, 0x29, '\x89', 0x0E, 0x11,
+0x49, '\xA6', 0x43, 0x2D, 0x25, '\xA8', 0x0F, '\xEF', 0x11, '\xD7', 0x79, '\xBB', 0x17, '\xCA', '\xC6', 0x20,
+'\xF5', '\xA9', 0x12, 0x2E, 0x7C, '\xE8', '\xBE', '\xF1', '\x80', 0x48, '\xFE', 0x38, 0x6A, 0x26, 0x61, 0x2C,
+'\x95', 0x12, '\xCD', '\xD7', '\xD5', '\xCF', 0x1F, '\xF0', 0x64, '\x89', 0x00, '\xFB', '\xDB', '\xBE', '\xD9', '\xA0',
+'\xC8', '\xEE', 0x40, 0x64, '\x8F', '\xD8', '\xAD', 0x23, 0x63, '\xD9', '\x88', 0x6A, '\xB4', 0x04, 0x3E, '\xFF',
+0x31, '\xC5', '\x95', '\xAF', '\xCD', '\xB8', 0x36, 0x01, '\xF0', 0x19, '\xD4', '\xD7', '\xE1', '\x87', 0x06, '\x8C',
+'\xC8', '\x9B', '\xF1', 0x6D, '\x93', 0x26, '\x96', '\xA7', '\xC3', '\xE0', 0x34, '\x99', 0x42, '\xEC', '\xBE', 0x13,
+'\xA9', '\xEA', 0x16, '\xC4', 0x74, 0x35, '\x98', 0x62, '\xC5', '\x9B', 0x25, '\xA3', 0x43, 0x14, '\xAC', '\xA1',
+0x04, 0x4B, '\xEE', 0x42, '\xDF', 0x44, '\xD2', '\xA1', 0x6D, 0x0A, 0x5C, '\xD4', 0x5B, '\xE5', '\xB9', '\xE9',
+'\x89', 0x1B, '\xE7', '\xBA', 0x32, 0x35, 0x53, 0x73, '\xF2', 0x19, '\x90', '\x9B', '\xD6', 0x5A, 0x18, 0x5C,
+'\xAB', '\xBC', '\x92', '\xF9', 0x6E, 0x4E, 0x0C, 0x3B, '\x88', '\xE0', '\x85', '\xD2', 0x08, '\x94', 0x45, '\xF4',
+'\x85', '\x86', 0x24, 0x5D, 0x42, 0x2A, '\x99', 0x0E, '\xC0', '\x94', '\x9E', '\xD9', 0x4E, '\x9D', 0x79, '\xC5',
+'\x8C', '\x99', '\x93', '\x8D', 0x55, '\xE4', '\xC2', '\xD2', 0x08, 0x23, '\xEC', 0x3B, '\x9A', 0x47, 0x51, '\xB0',
+'\xB6', '\xB2', '\xE6', 0x4C, 0x75, '\xA5', '\xF2', '\xBF', '\xDB', 0x5C, '\xC1', '\xB4', '\xEF', '\xF7', '\xD8', '\xA3',
+'\xF3', '\xCE', '\xBC', '\xE2', '\xD3', '\xC2', '\x9C', '\xB5', '\xEE', '\x86', '\x8F', '\xBD', 0x0F, '\xBD', 0x69, '\xC6',
+'\xDD', '\xDA', 0x47, '\xEC', '\x97', '\xBC', 0x79, '\xE8', 0x56, 0x6C, '\xFB', '\xCC', '\xF6', 0x02, '\xAA', '\xAE',
+'\x9F', '\xC0', 0x31, '\xEB', 0x06, 0x07, '\x9E', 0x10, '\xB8', '\xEE', '\xEE', '\xE1', 0x27, 0x39, 0x71, '\xC7',
+'\x95', 0x50, 0x5B, 0x5B, 0x42, 0x2A, '\x8A', 0x46, 0x01, 0x3B, 0x00, 0x0D, '\xD5', 0x4C, '\xAE', 0x63,
+'\xC9', '\xCF', 0x0B, '\xBF', 0x24, '\xFD', '\xEE', 0x10, '\xCF', 0x76, 0x6B, 0x48, 0x1F, '\xD0', '\xA0', 0x56,
+'\xB7', 0x76, '\x90', 0x0E, '\x81', 0x3F, 0x0C, 0x27, '\xDC', 0x57, 0x6A, '\xD6', 0x55, '\x9A', '\xB9', '\xC1',
+'\xDC', '\xF9', '\xC5', '\xC6', 0x36, 0x52, 0x6D, 0x65, '\xD1', 0x05, '\x80', 0x04, 0x75, '\xC2', '\xC2', '\x95',
+'\xD1', '\xE9', '\xAB', '\xD1', '\x8A', 0x4E, 0x40, '\xC4', 0x5E, '\xD8', 0x52, '\xF3', 0x19, '\xA6', '\xBF', 0x16,
+'\xCB', 0x15, '\x9D', '\xA0', 0x52, 0x30, 0x2E, 0x1A, 0x33, '\x83', 0x12, '\xFD', '\xA2', '\x95', '\x85', 0x29,
+0x3F, '\xAD', '\xE0', '\x92', 0x28, 0x40, 0x58, 0x5D, '\xC3', '\xCA', '\x98', 0x73, 0x72, 0x20, 0x40, '\xFD',
+0x04, 0x6D, 0x34, '\xEF', 0x66, '\xE3', '\xAB', 0x70, 0x41, 0x38, '\xB6', '\xA5', 0x50, 0x01, 0x6C, '\xB5',
+'\xD6', '\xCA', 0x08, 0x3C, 0x4F, '\xF1', 0x51, 0x16, '\xF8', '\x9C', '\x88', '\xF5', 0x0E, '\x86', '\xBF', '\xF9',
+'\xF7', '\xDC', '\xE3', '\xDE', 0x5D, 0x5E, '\x8F', '\xFE', 0x02, '\x9C', '\xC6', '\xE0', '\xA0', 0x74, 0x04, 0x00,
+0x00, 
+};
@@ -4,39 +4,164 @@
 #include <cstdint>
 
 namespace http {
-namespace json {
-namespace get {
-static constexpr uint16_t LIST        = 0x1661;
-static constexpr uint16_t VERSION     = 0x6c4b;
-static constexpr uint16_t UPTIME      = 0xb7d9;
-static constexpr uint16_t DISPLAY     = 0x479b;
-static constexpr uint16_t DIRECTORY   = 0x11fa;
-static constexpr uint16_t RDM         = 0xa528;
-static constexpr uint16_t QUEUE       = 0xb68a;
-static constexpr uint16_t TOD         = 0xaf0c;
-static constexpr uint16_t PHYSTATUS   = 0xb63a;
-static constexpr uint16_t PORTSTATUS  = 0x394e;
-static constexpr uint16_t VLANTABLE   = 0xe4be;
-static constexpr uint16_t STATUS      = 0x8d49;
-static constexpr uint16_t TIMEDATE    = 0x2472;
-static constexpr uint16_t RTCALARM    = 0x817b;
-static constexpr uint16_t POLLTABLE   = 0x0864;
-static constexpr uint16_t TYPES       = 0x5e5a;
-}
-}
-}
+struct HashEntry {
+	const char *pName;
+	uint8_t nLength;
+	uint8_t nId;
+};
+
+namespace uri {
+enum class Id : uint8_t {
+	INDEX,
+	DMX,
+	RDM,
+	SHOWFILE,
+	DSA,
+	TIME,
+	RTC,
+	JSON,
+	JSON_ACTION,
+	JSON_LIST,
+	JSON_VERSION,
+	JSON_UPTIME,
+	JSON_DISPLAY,
+	JSON_DIRECTORY,
+	JSON_TIMEDATE,
+	JSON_RTCALARM,
+	JSON_RDM,
+	JSON_POLLTABLE,
+	JSON_PHYSTATUS,
+	JSON_NETSTATS,
+	JSON_HTTPSTATS,
+	JSON_DMX_PORTSTATUS,
+	JSON_DMX_STATUS,
+	JSON_PIXEL_TYPES,
+	JSON_PIXEL_STATUS,
+	JSON_RDM_QUEUE,
+	JSON_RDM_PORTSTATUS,
+	JSON_RDM_TOD,
+	JSON_STORAGE_DIRECTORY,
+	JSON_DSA_PORTSTATUS,
+	JSON_DSA_VLANTABLE,
+	JSON_SHOWFILE_STATUS,
+	JSON_SHOWFILE_DIRECTORY,
+	UNKNOWN
+};
+
+static constexpr uint32_t SEED = 0x00005d51;
+static constexpr uint32_t MASK = 0x3f;
+
+static constexpr HashEntry TABLE[64] = {
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "/json/storage/directory", 23, static_cast<uint8_t>(Id::JSON_STORAGE_DIRECTORY) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "/json/display", 13, static_cast<uint8_t>(Id::JSON_DISPLAY) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "/json/showfile/directory", 24, static_cast<uint8_t>(Id::JSON_SHOWFILE_DIRECTORY) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "/json/dmx/status", 16, static_cast<uint8_t>(Id::JSON_DMX_STATUS) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "/json/httpstats", 15, static_cast<uint8_t>(Id::JSON_HTTPSTATS) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "/json/polltable", 15, static_cast<uint8_t>(Id::JSON_POLLTABLE) },
+	{ "/json/rdm/portstatus", 20, static_cast<uint8_t>(Id::JSON_RDM_PORTSTATUS) },
+	{ "/json/rdm/queue", 15, static_cast<uint8_t>(Id::JSON_RDM_QUEUE) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "/", 1, static_cast<uint8_t>(Id::INDEX) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "/json/dsa/portstatus", 20, static_cast<uint8_t>(Id::JSON_DSA_PORTSTATUS) },
+	{ "/json/action", 12, static_cast<uint8_t>(Id::JSON_ACTION) },
+	{ "/json/rdm/tod", 13, static_cast<uint8_t>(Id::JSON_RDM_TOD) },
+	{ "/json/rtcalarm", 14, static_cast<uint8_t>(Id::JSON_RTCALARM) },
+	{ "/dmx", 4, static_cast<uint8_t>(Id::DMX) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "/json/version", 13, static_cast<uint8_t>(Id::JSON_VERSION) },
+	{ "/json/pixel/types", 17, static_cast<uint8_t>(Id::JSON_PIXEL_TYPES) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "/dsa", 4, static_cast<uint8_t>(Id::DSA) },
+	{ "/json/netstats", 14, static_cast<uint8_t>(Id::JSON_NETSTATS) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "/json/showfile/status", 21, static_cast<uint8_t>(Id::JSON_SHOWFILE_STATUS) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "/json/dsa/vlantable", 19, static_cast<uint8_t>(Id::JSON_DSA_VLANTABLE) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "/json/timedate", 14, static_cast<uint8_t>(Id::JSON_TIMEDATE) },
+	{ "/rtc", 4, static_cast<uint8_t>(Id::RTC) },
+	{ "/time", 5, static_cast<uint8_t>(Id::TIME) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "/json", 5, static_cast<uint8_t>(Id::JSON) },
+	{ "/json/rdm", 9, static_cast<uint8_t>(Id::JSON_RDM) },
+	{ "/json/dmx/portstatus", 20, static_cast<uint8_t>(Id::JSON_DMX_PORTSTATUS) },
+	{ "/rdm", 4, static_cast<uint8_t>(Id::RDM) },
+	{ "/json/uptime", 12, static_cast<uint8_t>(Id::JSON_UPTIME) },
+	{ "/json/directory", 15, static_cast<uint8_t>(Id::JSON_DIRECTORY) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "/json/pixel/status", 18, static_cast<uint8_t>(Id::JSON_PIXEL_STATUS) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "/json/phystatus", 15, static_cast<uint8_t>(Id::JSON_PHYSTATUS) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "/showfile", 9, static_cast<uint8_t>(Id::SHOWFILE) },
+	{ "/json/list", 10, static_cast<uint8_t>(Id::JSON_LIST) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+};
+}  // namespace uri
+
+namespace header {
+enum class Id : uint8_t {
+	CONTENT_TYPE,
+	CONTENT_LENGTH,
+	ACCEPT_ENCODING,
+	IF_NONE_MATCH,
+	CONNECTION,
+	UNKNOWN
+};
+
+static constexpr uint32_t SEED = 0x00001505;
+static constexpr uint32_t MASK = 0x0f;
+
+static constexpr HashEntry TABLE[16] = {
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "accept-encoding", 15, static_cast<uint8_t>(Id::ACCEPT_ENCODING) },
+	{ "if-none-match", 13, static_cast<uint8_t>(Id::IF_NONE_MATCH) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "content-type", 12, static_cast<uint8_t>(Id::CONTENT_TYPE) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "connection", 10, static_cast<uint8_t>(Id::CONNECTION) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+	{ "content-length", 14, static_cast<uint8_t>(Id::CONTENT_LENGTH) },
+	{ nullptr, 0, static_cast<uint8_t>(Id::UNKNOWN) },
+};
+}  // namespace header
+
+}  // namespace http
 
 namespace http {
-inline uint16_t get_uint(const char *pString) {					/* djb2 */
-	uint16_t hash = 5381;										/* djb2 */
-	uint16_t c;													/* djb2 */
-																/* djb2 */
-	while ((c = *pString++) != '\0') {							/* djb2 */
-		hash = static_cast<uint16_t>(((hash << 5) + hash) + c);	/* djb2 */
-	}															/* djb2 */
-																/* djb2 */
-	return hash;												/* djb2 */
-}																/* djb2 */
+inline uint32_t hash_step(const uint32_t nHash, const uint32_t c) {
+	return (nHash * 33U) ^ c;
+}
+
+inline uint32_t hash_index(const uint32_t nHash, const uint32_t nMask) {
+	return (nHash ^ (nHash >> 16)) & nMask;
+}
 }
 
 #endif /* JSON_SWITCH_H_ */
@@ -72,3 +72,43 @@ static constexpr char rdm_html[] = {
 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C,
 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x00
 };
+static constexpr char rdm_html_gz[] = {
+0x1F, '\x8B', 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, '\x95', 0x54, 0x61, 0x6B, '\xDB', 0x30,
+0x10, '\xFD', '\xEE', 0x5F, 0x71, 0x13, 0x0C, 0x3B, '\xD0', '\xDA', '\xED', 0x60, 0x30, 0x12, '\xDB', '\x83',
+'\xB5', '\xFD', '\xB0', '\xD1', '\xB5', 0x5D, 0x57, 0x3A, '\xF6', 0x51, '\x91', '\xCF', '\x89', 0x5A, 0x59, '\xF2',
+0x24, '\xD9', 0x6D, 0x56, '\xFA', '\xDF', 0x77, '\xB1', '\x95', '\xA4', 0x59, 0x61, 0x30, '\xB0', '\xD1', '\xF9',
+'\xF4', '\xDE', '\xBB', '\xA7', '\x93', '\xE4', '\xFC', '\xCD', '\xE9', '\xE5', '\xC9', '\xCD', '\xCF', '\xAB', 0x33, 0x58,
+'\xFA', 0x46, '\x95', 0x51, '\xBE', 0x19, '\x90', 0x57, 0x65, '\xAE', '\xA4', '\xBE', 0x07, '\x8B', '\xAA', 0x60,
+'\xCE', '\xAF', 0x14, '\xBA', 0x25, '\xA2', 0x67, '\xB0', '\xB4', 0x58, 0x6F, 0x32, '\xA9', 0x70, '\x8E', 0x41,
+0x56, '\xE6', 0x5E, 0x7A, '\x85', '\xE5', '\xF5', '\xE9', '\xD7', 0x3C, 0x1B, '\xC3', 0x3C, 0x1B, 0x34, '\xA2',
+0x7C, 0x6E, '\xAA', 0x55, 0x50, 0x44, 0x5B, '\xE6', '\x9D', 0x02, 0x59, 0x15, 0x4C, 0x56, '\xE7', '\xD2',
+0x79, 0x46, '\xB0', 0x4E, 0x05, 0x2C, '\xCD', 0x46, 0x79, 0x5B, '\xE6', '\xF3', '\xCE', 0x7B, '\xA3', '\xC1',
+0x68, '\xA1', '\xA4', '\xB8', 0x2F, 0x18, '\x95', '\xB3', 0x54, 0x3B, '\x99', '\xB0', '\xF2', 0x7A, 0x0C, '\xF3',
+0x6C, '\xC4', 0x6C, '\xB1', '\x83', '\x99', 0x22, 0x6E, '\xB8', 0x5D, 0x48, 0x7D, '\xA8', '\xB0', '\xF6', 0x53,
+0x78, '\xF7', '\xBE', 0x7D, '\x9C', '\xC5', 0x43, '\xB1', '\xB9', '\xD7', '\xAC', 0x3C, 0x37, '\xBC', '\x92', 0x7A,
+'\x91', '\xA6', '\xE9', '\x8E', '\x9E', '\xB5', 0x54, '\xB2', '\x92', 0x3D, 0x08, '\xC5', '\x9D', 0x2B, '\x98', '\xA8',
+0x17, 0x64, '\xC9', '\xF3', '\xB9', '\xC2', '\xE0', '\xF2', '\x84', 0x32, 0x30, 0x37, '\x96', '\xDC', 0x15, '\xF1',
+0x71, 0x4C, '\x94', 0x61, '\x96', 0x46, '\xA2', '\xED', '\x93', 0x7F, 0x75, '\xC8', '\xCA', 0x1F, '\xC6', '\xDE',
+0x53, 0x15, '\xF8', '\xD6', 0x61, '\x87', '\xF9', '\xDC', 0x52, 0x6F, '\xA2', 0x20, 0x18, 0x4C, '\xD6', 0x46,
+'\xFB', '\xC3', '\x9A', 0x37, 0x52, '\xAD', '\xA6', '\xEC', '\xC4', 0x74, 0x56, '\xA2', '\x85', 0x0B, 0x7C, 0x60,
+0x07, 0x10, '\xBE', 0x0E, '\xA0', 0x31, '\xDA', '\xB8', '\x96', 0x0B, '\x9C', '\xC1', 0x00, 0x77, '\xF2', 0x37,
+0x4E, 0x3F, 0x1C, '\xBD', '\x8D', '\x83', 0x2B, 0x52, '\xDF', '\xB9', 0x3A, '\xDA', '\xB9', '\x8A', 0x5E, '\xD8',
+0x2A, 0x4F, '\xA5', 0x13, '\xA6', 0x47, '\x8B', 0x15, 0x54, '\xD8', 0x4B, '\x81', 0x6E, '\xF4', '\xB3', '\xB7',
+0x3E, 0x02, '\xFD', 0x73, 0x7D, '\xB5', 0x31, 0x7E, 0x6F, '\xDB', 0x6E, '\xD1', 0x3A, 0x69, '\xF4', 0x76,
+'\xE7', 0x02, 0x20, '\xCA', '\x9D', '\xB0', '\xB2', '\xF5', '\xE0', '\xAC', 0x58, 0x1F, 0x0E, '\xEE', '\xA5', 0x48,
+'\xEF', 0x48, '\xDB', '\xAF', 0x5A, 0x2C, '\x98', '\xC7', 0x47, '\x9F', '\xDD', '\xF1', '\x9E', '\x8F', '\xA8', 0x35,
+0x7B, '\x8C', '\xFE', 0x22, '\xDA', '\xAA', '\xF9', 0x2F, 0x56, 0x19, 0x71, '\xB7', '\xD2', 0x02, '\xEA', 0x4E,
+0x0B, 0x4F, '\xB6', '\xA0', 0x6B, 0x2B, '\xEE', 0x31, '\x99', '\xC0', 0x53, 0x24, '\x8C', 0x76, 0x1E, 0x2C,
+0x14, '\xC0', 0x1F, '\xB8', '\xF4', '\xB0', 0x40, '\xFF', '\xE5', '\xFB', '\xE5', 0x45, 0x12, 0x53, '\x91', 0x78,
+0x32, 0x0B, '\xF3', 0x3D, 0x57, 0x1D, 0x12, '\xC6', '\xA6', '\x94', '\xDE', 0x24, '\xE9', '\xC0', 0x50, '\xAA',
+0x32, '\xA2', 0x6B, 0x50, '\xFB', '\x94', '\x98', 0x67, 0x0A, '\xD7', '\xE1', '\xA7', '\xD5', '\xE7', 0x2A, '\x89',
+0x69, 0x7A, 0x2D, 0x40, 0x43, 0x2A, '\xB5', 0x46, 0x7B, 0x43, 0x3E, 0x09, 0x1F, '\xA4', '\x8A', 0x02,
+0x68, 0x4F, '\xE0', 0x23, '\xC4', 0x67, 0x7A, '\xDD', '\xCB', 0x18, '\xA6', 0x10, 0x53, '\x9F', '\x87', 0x78,
+0x64, '\x85', '\xB3', '\xBD', '\xB6', '\xB6', 0x6F, '\xFF', '\x85', 0x71, '\x8D', 0x0F, '\xB7', '\xC1', '\xDB', 0x2B,
+'\xE1', '\xE3', 0x41, '\xF3', '\x88', '\xD4', '\xC6', '\xA5', 0x11, 0x16, '\xAE', '\xAC', 0x69, '\xA4', '\xC3', '\x84',
+0x2E, '\x88', 0x51, 0x3D, '\xC1', 0x4B, '\x92', 0x6A, '\x8D', '\xF3', '\xC9', 0x13, '\xD0', '\xD2', '\xA6', 0x3B,
+'\xC1', '\xE7', 0x49, '\xEA', '\x97', '\xA8', 0x13, 0x2A, 0x36, '\x80', 0x02, 0x23, '\xA1', 0x25, 0x3D, '\x87',
+0x77, '\xD3', 0x46, '\xFA', '\xA2', 0x27, 0x7A, '\xDD', 0x77, 0x45, '\xB7', '\x97', '\xA6', '\xFB', '\xF1', 0x34,
+0x50, '\xB4', '\xBD', '\xA5', '\xB3', 0x2D, '\xF7', 0x05, 0x2B, 0x0B, 0x7F, '\x81', 0x6C, '\xF8', '\xBF', '\xFC',
+0x01, '\xB8', 0x79, '\x87', '\x89', 0x76, 0x04, 0x00, 0x00, 
+};
@@ -62,3 +62,36 @@ static constexpr char rdm_js[] = {
 0x3D, 0x68, 0x64, 0x72, 0x73, 0x20, 0x2B, 0x20, 0x74, 0x64, 0x64, 0x0A, 0x7D, 0x20, 0x63, 0x61,
 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x7B, 0x7D, 0x0A, 0x7D, 0x00
 };
+static constexpr char rdm_js_gz[] = {
+0x1F, '\x8B', 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, '\x8D', '\x93', '\xDD', 0x6E, '\xDB', 0x30,
+0x0C, '\x85', '\xEF', '\xFD', 0x14, 0x44, 0x50, '\xC0', 0x12, '\xD2', 0x39, 0x17, '\xBB', 0x6B, 0x62, 0x0F,
+'\xD8', 0x5A, 0x60, 0x1D, '\xF6', '\xD3', '\xA1', 0x7B, '\x80', 0x28, '\x96', 0x52, 0x09, '\xB0', '\xE5', '\x84',
+'\x92', '\xB1', 0x05, '\x86', '\xDF', 0x7D, '\x94', '\xE4', '\xB8', '\xEB', '\xB2', 0x0D, '\xBB', 0x31, 0x24, '\x8A',
+0x47, '\xA4', '\xBE', 0x43, 0x0B, 0x77, '\xB2', 0x35, '\xEC', 0x7B, 0x5B, 0x7B, '\xD3', 0x59, 0x40, '\xB5',
+0x47, '\xE5', 0x34, '\xE3', 0x30, 0x64, 0x1E, 0x4F, '\xF4', 0x6D, '\x94', 0x07, 0x29, '\xBC', 0x28, '\xC5',
+0x77, 0x61, 0x3C, 0x3C, 0x29, '\xFF', '\xE1', '\xF1', '\xCB', 0x67, '\x96', '\xA3', 0x6C, 0x57, '\x87', 0x0E,
+'\xBD', '\xF3', '\xC2', '\xF7', 0x2E, '\xE7', 0x31, 0x51, '\x97', '\xF9', '\xC6', 0x63, '\xB5', '\xF1', '\xBA', 0x7A,
+'\xA0', '\xB3', '\xCD', '\x8A', 0x16, 0x61, 0x73, 0x6B, 0x50, '\xC5', 0x02, 0x73, '\xE4', 0x31, '\xCA', '\xD2',
+0x76, 0x45, '\x92', 0x3C, 0x0B, 0x45, '\x8A', 0x7D, '\x87', 0x77, '\xA2', '\xD6', '\xCC', 0x78, '\xD5', 0x42,
+0x59, 0x51, 0x7D, '\xBD', 0x2C, '\xB7', '\xE9', 0x4E, 0x59, 0x5D, 0x0D, 0x21, 0x5E, '\x84', '\xB2', 0x23,
+'\xA9', '\xE4', '\xAF', 0x41, 0x79, 0x2E, 0x71, 0x71, '\x92', 0x3A, '\x9C', '\xC2', '\xA1', '\xD6', 0x36, 0x1B,
+'\xF9', 0x3A, '\x93', 0x5D, '\xDD', '\xB7', '\xCA', '\xFA', '\x82', '\x9E', 0x74, '\xD7', '\xA8', '\xB0', 0x7C, 0x7B,
+'\xBA', '\x97', 0x6C, 0x61, '\xE4', '\xBB', '\xFD', '\xD3', '\x82', 0x17, '\xC6', 0x5A, '\x85', '\xEF', '\xBF', 0x7D,
+'\xFA', 0x58, '\xEA', '\xF8', 0x38, '\x8F', 0x13, '\x83', 0x07, '\xEC', 0x5A, '\xE3', 0x54, 0x21, '\x9A', '\x86',
+'\xA5', '\xB6', 0x5B, 0x71, '\x98', 0x5B, 0x7E, 0x41, '\xC8', 0x77, '\xF2', 0x4D, 0x0E, 0x4B, '\x98', '\xFB',
+'\xE6', '\x85', '\xD7', '\xCA', 0x32, '\x82', 0x7C, '\xE8', '\xAC', 0x53, 0x41, '\xC0', 0x06, 0x08, 0x27, 0x37,
+'\xCF', 0x49, '\xD7', 0x40, '\xBA', 0x1B, 0x38, 0x27, 0x15, '\xB4', '\x83', '\x91', 0x73, '\x9E', 0x51, '\xDB',
+'\xCF', '\xAE', 0x1C, '\xFF', 0x64, '\xC9', '\xB1', 0x57, '\xBD', 0x22, 0x37, '\xC8', '\x89', 0x7C, '\x9D', 0x1D,
+'\x8B', '\xDE', '\xC8', 0x19, 0x2A, '\xAD', 0x2F, '\x98', 0x42, '\xDD', 0x35, '\xEE', 0x20, 0x6C, '\xB9', 0x78,
+'\xBD', 0x20, 0x60, '\x94', 0x72, 0x01, 0x6A, '\x84', 0x5A, '\xF8', 0x5A, 0x03, 0x53, '\x88', 0x1D, '\xF2',
+0x21, 0x5C, 0x3D, '\xFE', 0x0B, '\xDF', '\xD7', 0x5E, '\xFD', '\x86', '\xCF', 0x63, '\xE1', '\xE8', 0x5D, '\x8C',
+'\x89', 0x6B, '\xD8', '\xF1', '\xD4', 0x04, 0x2A, '\xDF', '\xA3', '\x85', 0x64, '\xBB', '\xB1', '\xF2', '\xDE', 0x4A,
+'\xF5', 0x63, '\xA6', 0x38, '\xB3', '\x80', '\xB2', 0x2C, 0x41, 0x24, 0x76, '\xF0', '\xEA', '\xFF', '\xD2', 0x77,
+0x29, 0x7D, 0x1D, '\xDB', '\x8F', 0x73, 0x29, '\xD1', '\xA5', '\xD1', '\xCC', '\x93', '\x95', 0x52, '\x9E', '\xB7',
+'\xD4', '\xDA', '\x99', 0x0F, 0x4E, 0x74, 0x28, 0x39, 0x02, '\xD2', 0x04, 0x04, '\xE7', 0x69, '\xD3', '\xD5',
+'\x96', '\xE8', 0x4B, '\xB9', 0x0C, 0x4A, 0x59, 0x11, 0x5D, 0x0C, '\xC6', '\xCC', '\xEA', 0x60, 0x52, '\xD4',
+'\xC7', '\x9C', '\xED', '\xD5', 0x40, '\x81', 0x71, '\xB3', '\xC3', '\xD5', '\x84', 0x71, '\x92', 0x06, '\xB8', 0x79,
+0x0C, '\xA4', 0x3A, '\xF9', 0x34, '\xFE', '\xF3', 0x71, '\xFC', 0x17, '\xFE', 0x0E, '\xF7', '\xD6', '\xB8', '\x97',
+0x70, '\xE9', 0x16, 0x1A, 0x30, '\x92', 0x5F, 0x18, 0x35, 0x66, '\xE3', 0x4F, 0x62, 0x61, 0x45, '\xD2',
+'\xDF', 0x03, 0x00, 0x00, 
+};
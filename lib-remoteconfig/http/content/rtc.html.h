@@ -64,3 +64,34 @@ static constexpr char rtc_html[] = {
 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C, 0x2F,
 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x00
 };
+static constexpr char rtc_html_gz[] = {
+0x1F, '\x8B', 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, '\x9D', 0x53, 0x4B, 0x6F, '\xDB', 0x30,
+0x0C, '\xBE', '\xE7', 0x57, 0x68, 0x3A, '\xB5', '\x87', 0x56, '\xF7', 0x4D, 0x36, 0x30, 0x74, 0x05, 0x36,
+0x60, '\xE8', '\x8A', '\xD6', 0x18, '\xB0', '\xA3', 0x2C, 0x31, '\xB0', 0x1A, '\xDA', 0x72, 0x25, 0x3A, '\xAD',
+'\xFF', '\xFD', '\xF4', 0x70, 0x12, '\xA7', 0x1D, 0x30, 0x6C, '\xA7', 0x50, '\xF4', '\xF7', 0x12, 0x43, '\xC9',
+0x0F, 0x5F, 0x7E, '\xDC', 0x34, '\xBF', '\xEE', 0x6F, 0x59, 0x47, 0x3D, '\xD6', 0x1B, 0x79, '\xF8', 0x01,
+0x65, 0x6A, '\x89', 0x76, '\xD8', 0x31, 0x0F, 0x58, '\xF1', 0x40, 0x33, 0x42, '\xE8', 0x00, '\x88', '\xB3',
+'\xCE', '\xC3', '\xF6', '\xD0', '\xB9', '\xD6', 0x21, 0x70, 0x26, 0x6A, 0x49, '\x96', 0x10, '\xEA', 0x07, 0x50,
+0x78, 0x45, '\xB6', 0x07, '\xA6', '\xD1', '\xE9', '\x9D', 0x14, '\xA5', 0x2D, 0x45, '\xD6', '\xDB', '\xC8', '\xD6',
+'\x99', 0x79, 0x51, 0x07, 0x5F, '\xCB', 0x09, '\x99', 0x35, 0x15, '\xB7', '\xE6', '\xBB', 0x0D, '\xC4', 0x23,
+0x6C, '\xC2', 0x05, 0x1B, '\xBF', 0x6E, '\xE4', 0x58, '\xCB', 0x76, 0x22, 0x72, 0x03, 0x73, '\x83', 0x46,
+'\xAB', 0x77, 0x15, '\x8F', '\xD6', 0x3E, '\xE6', '\xB8', '\xB8', '\xE4', '\xD1', 0x2B, '\x97', 0x52, 0x14, 0x4C,
+0x24, '\x8E', '\x89', '\x93', 0x15, 0x07, 0x67, '\xA0', '\x89', 0x31, 0x78, 0x7D, 0x17, 0x2B, '\x96', 0x13,
+'\xBD', 0x58, 0x44, '\xD6', 0x02, 0x33, 0x36, '\x8C', '\xA8', 0x66, 0x30, '\xAC', 0x03, 0x0F, 0x6B, '\x96',
+0x27, 0x5D, 0x48, 0x0F, '\xCD', '\xCD', '\xDF', 0x39, '\xC6', '\xEE', '\xD3', '\x8D', '\xDE', 0x04, '\xEC', 0x74,
+'\xE3', 0x1E, '\xE7', '\x90', 0x02, 0x3E, 0x02, 0x31, '\xEA', '\x80', '\x9D', 0x22, 0x6C, '\xBD', '\xEB', 0x73,
+0x2B, 0x1A, 0x1C, 0x73, '\xBF', '\xD7', 0x08, 0x73, 0x68, '\xDC', 0x57, '\xBD', '\xD6', 0x48, '\x89', '\x8E',
+'\xEC', '\xA3', '\xE0', 0x4A, 0x43, '\x94', 0x38, 0x29, '\xD8', '\xD6', '\xF9', 0x3E, '\xDF', 0x27, 0x15, 0x3C,
+0x36, 0x50, '\xB5', '\x80', 0x2C, '\x9E', 0x2A, '\xAE', 0x50, '\xF9', '\xFE', '\xDB', 0x30, 0x4E, 0x54, 0x6E,
+'\xF9', 0x39, '\x9D', 0x3F, 0x4A, '\x91', 0x21, 0x11, 0x6A, '\xD3', 0x27, 0x46, '\xF3', 0x08, 0x15, 0x37,
+'\x8A', 0x20, '\xB9', 0x5C, '\xC5', '\xBF', 0x52, 0x21, '\xCF', '\x92', 0x2B, 0x3E, 0x1B, 0x54, 0x0F, '\xE7',
+0x1D, 0x0F, '\xCF', '\x93', '\xF5', 0x60, '\xCE', 0x3D, 0x75, '\xB7', 0x6B, '\xDD', 0x2B, '\xAF', 0x6F, 0x07,
+'\xD5', 0x22, '\xFC', '\xD9', 0x4B, 0x77, '\xA0', 0x33, 0x2A, '\xBB', 0x2C, '\x8C', '\xC5', '\xA1', '\xF0', '\xF8',
+0x69, 0x50, '\x85', 0x52, 0x0E, '\xFC', 0x34, '\xB6', '\x9C', 0x64, 0x19, '\xDA', 0x7A, 0x32, 0x69, 0x0C,
+0x79, 0x2C, '\x8E', '\xCE', '\x96', '\xEE', 0x27, '\xF8', 0x60, '\xA3', '\xC2', 0x61, '\xEF', 0x16, '\xC0', 0x46,
+0x06, '\xED', '\xED', 0x48, 0x2C, 0x78, '\x9D', '\xD6', 0x5C, '\x91', '\xD5', '\xD7', 0x4F, 0x71, '\xCB', '\x8B',
+0x2D, '\xC1', 0x2B, '\x89', 0x27, '\xB5', 0x57, 0x05, '\x95', '\xD8', '\xA5', 0x7A, 0x43, 0x4C, '\xD3', '\xFB',
+0x0F, 0x5A, '\xDC', '\xC1', 0x7F, 0x62, '\xD5', 0x18, '\x9F', '\xCE', '\xC5', '\xE5', '\xA7', 0x7D, '\xB9', 0x4C,
+'\xAC', '\x8E', 0x4F, 0x64, '\x85', 0x15, '\xCB', '\xC3', 0x13, '\xF9', 0x79, '\xFF', 0x06, 0x50, 0x7D, 0x44,
+0x0C, '\xF5', 0x03, 0x00, 0x00, 
+};
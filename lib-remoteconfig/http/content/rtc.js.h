@@ -53,3 +53,28 @@ static constexpr char rtc_js[] = {
 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x3A, 0x20, 0x62, 0x20, 0x7D, 0x29, 0x3B, 0x0A, 0x72, 0x65,
 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x00
 };
+static constexpr char rtc_js_gz[] = {
+0x1F, '\x8B', 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, '\x95', '\x92', '\xD1', 0x4A, '\xC3', 0x40,
+0x10, 0x45, '\xDF', '\xF3', 0x15, 0x43, 0x10, '\x92', 0x40, 0x09, '\xB6', '\x8F', 0x09, 0x41, '\xB0', 0x0A,
+'\xD6', '\x87', 0x0A, 0x36, 0x1F, '\xE0', 0x76, 0x77, 0x6A, 0x4A, '\x93', '\xDD', '\x92', '\x9D', '\xD8', '\x86',
+'\xD2', 0x7F, 0x77, 0x36, '\x91', '\x82', 0x46, '\xA3', '\xBE', '\xED', 0x66, '\xEE', '\x9C', '\xBD', 0x73, 0x27,
+'\xC2', '\xB6', 0x5A, '\xC2', '\xA6', '\xD1', '\x92', '\xB6', 0x46, 0x43, '\x8D', '\x9B', 0x1A, 0x6D, 0x11, 0x46,
+0x70, '\xF2', 0x4A, 0x24, 0x50, '\xD3', 0x4C, 0x1C, '\xC4', '\x96', '\xE0', 0x15, '\xE9', 0x71, '\xF5', '\xB4',
+0x0C, 0x03, '\xDA', 0x56, '\xA8', 0x04, 0x61, 0x10, 0x79, '\xD2', 0x68, 0x4B, '\xA0', '\x8D', 0x42, '\xC8',
+0x60, 0x63, '\xEA', 0x4A, '\xD0', 0x1D, 0x57, 0x72, 0x56, '\x84', 0x1A, 0x0F, '\xE0', 0x2E, '\xA1', '\x9A',
+'\xC6', 0x4E, 0x1E, 0x45, '\x9E', 0x32, '\xB2', '\xA9', 0x50, 0x53, '\xCC', '\xAC', '\xFB', 0x12, '\xDD', '\xF1',
+'\xB6', 0x5D, '\xA8', 0x30, 0x70, 0x04, '\xD7', 0x14, 0x44, 0x31, '\xE1', '\x91', '\xE6', 0x46, 0x13, '\xD7',
+'\x98', '\xF9', '\xB2', 0x74, 0x6C, 0x57, 0x4A, '\xE0', '\xEA', '\xE4', 0x64, '\xE7', '\x97', '\xDE', '\xD6', '\xEC',
+'\xAB', '\xAD', '\x9A', '\xA4', 0x28, 0x45, 0x5D, 0x5D, 0x6C, '\xF1', '\x87', 0x31, 0x57, '\xB3', '\x98', 0x05,
+0x63, '\xA6', '\xB8', '\xFC', '\xBD', '\xA7', '\xE7', 0x7C, 0x7E, '\xB1', '\xC4', 0x22, 0x76, '\xF4', 0x23, '\xA3',
+0x73, '\xB4', '\xD0', '\xFB', '\x86', 0x18, '\xF3', 0x26, '\xCA', 0x06, '\xC7', 0x2D, 0x75, '\xFA', 0x31, 0x53,
+'\xB2', '\xD8', '\xAD', '\xCD', '\x91', 0x61, '\xB2', 0x40, '\xB9', 0x43, '\xC5', 0x38, '\xD7', '\x87', 0x5A, '\xAC',
+0x4B, 0x77, '\xCB', 0x32, '\xF0', '\xA7', 0x7E, '\xE4', '\x9D', 0x3D, '\xF1', 0x79, '\xAF', '\x85', '\xCC', '\xCD',
+'\xAA', '\xB5', '\xDD', 0x5E, '\xFB', '\xE4', '\xF6', '\xC6', 0x52, 0x78, 0x72, 0x31, 0x25, '\xE0', '\xFB', 0x13,
+0x10, '\x9D', '\x90', '\xCF', '\x85', 0x24, 0x63, 0x5B, '\xEB', '\xC3', 0x39, 0x4A, '\xBD', '\xCB', '\xFF', '\x90',
+0x0E, '\x99', 0x2C, '\xCA', '\xCD', '\x83', '\xFC', 0x0B, '\x93', '\xA5', 0x64, 0x0A, '\xF9', 0x3B, '\xB3', 0x4B,
+'\xA0', 0x23, '\xF6', 0x5B, 0x14, 0x3C, '\xE1', 0x3F, '\xE2', 0x4D, 0x3F, '\xDA', '\xD6', 0x63, 0x6D, '\x83',
+0x10, 0x6F, 0x5C, 0x68, '\xC0', 0x36, '\xAF', '\xFD', 0x74, 0x38, 0x49, 0x37, '\x88', 0x7B, 0x29, 0x01,
+0x31, '\x81', 0x3E, '\xEA', '\x84', 0x5F, 0x18, '\x8C', '\xF2', 0x0E, '\x9B', '\x9A', '\xE6', 0x40, 0x4B, 0x03,
+0x00, 0x00, 
+};
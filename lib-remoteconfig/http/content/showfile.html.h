@@ -82,3 +82,40 @@ static constexpr char showfile_html[] = {
 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x62, 0x6F, 0x64, 0x79,
 0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x00
 };
+static constexpr char showfile_html_gz[] = {
+0x1F, '\x8B', 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, '\x95', 0x54, 0x5D, '\x8B', '\xDB', 0x30,
+0x10, 0x7C, '\xCF', '\xAF', '\xD8', '\x8A', 0x42, 0x1C, 0x28, 0x71, '\xD3', '\xF6', 0x29, '\xB1', 0x5D, 0x68,
+'\xEF', '\xA0', '\x85', '\x94', 0x1E, '\xCD', 0x51, '\xE8', '\xDB', 0x39, '\xB2', 0x72, '\xD1', '\x9D', 0x4E, 0x32,
+'\xD6', '\xDA', '\xA9', 0x09, '\xF9', '\xEF', '\xB7', '\xB2', '\x9C', 0x0F, '\xDB', 0x25, '\xD0', '\xA7', '\x95', '\xB4',
+'\xB3', '\xB3', '\xB3', '\xF2', 0x58, '\xD1', '\x9B', '\x9B', '\x9F', 0x5F, '\xEF', '\xFF', '\xDC', '\xDD', '\xC2', 0x16,
+0x5F, 0x54, 0x32, '\x8A', '\x8E', 0x41, '\xA4', 0x19, 0x05, 0x25, '\xF5', 0x33, 0x14, 0x42, '\xC5', '\xCC',
+0x62, '\xAD', '\x84', '\xDD', 0x0A, '\x81', 0x0C, '\xB6', '\x85', '\xD8', 0x1C, 0x4F, '\xA6', '\xDC', 0x5A, 0x06,
+0x21, 0x61, 0x51, '\xA2', 0x12, 0x49, 0x14, '\xFA', 0x38, '\x8A', '\xC2', '\x96', 0x63, 0x6D, '\xB2', '\xBA',
+0x65, 0x14, 0x45, 0x12, '\x95', 0x0A, 0x64, 0x16, 0x33, '\x99', 0x2D, '\xA5', 0x45, 0x46, '\xF8', 0x52,
+0x25, 0x1E, 0x4B, '\xD9', 0x51, '\x94', 0x27, '\xD1', '\xBA', 0x44, 0x34, 0x1A, '\x8C', '\xE6', 0x4A, '\xF2',
+'\xE7', '\x98', 0x51, '\xB7', '\x82', 0x5A, 0x07, 0x13, '\x96', '\xFC', '\xF2', '\xCB', 0x28, '\xF4', 0x18, 0x2A,
+'\xCC', 0x5D, '\xE7', 0x74, '\xAD', 0x44, '\xCB', '\xBA', '\xC2', 0x14, 0x4B, 0x52, '\xB4', 0x36, 0x05, 0x11,
+'\xC6', '\xE3', '\xD9', '\xD8', 0x49, 0x72, 0x00, 0x02, 0x66, '\xB2', 0x72, '\x82', 0x7A, '\xFC', '\xB9', 0x4A,
+0x6B, 0x47, 0x7E, 0x47, '\xF1', '\xC4', 0x3C, '\x84', 0x59, 0x34, '\xB9', '\x83', '\xAD', 0x28, 0x5E, '\x81',
+'\x91', '\xBE', '\xF2', 0x45, 0x78, '\xB1', 0x6E, 0x75, 0x15, '\xCA', 0x49, '\xA5', '\x87', '\xBA', '\xD5', 0x05,
+0x34, '\xF4', 0x52, 0x3B, '\x82', '\xFD', '\x80', '\x9F', '\xD8', '\x99', 0x40, 0x19, 0x2F, 0x69, 0x58, '\x98',
+0x37, '\xD3', '\x88', 0x02, 0x56, 0x5B, '\xB3', '\x83', '\xC8', 0x0A, 0x25, 0x38, '\xB6', 0x0C, 0x33, 0x57,
+'\xE0', 0x4F, '\x86', '\x97', 0x4D, '\xE7', '\xCD', '\x90', 0x4D, '\xBA', 0x77, '\xCF', 0x39, 0x1D, 0x23, 0x68,
+'\xB1', 0x03, '\xAF', '\x9C', '\xE8', 0x37, '\x92', 0x6E, '\xBE', 0x2B, '\xF0', 0x23, '\xEB', 0x4C, '\xD8', '\xD1',
+0x77, '\xE4', '\xB9', 0x21, 0x7A, 0x14, '\xFF', 0x12, '\xF7', '\xE1', '\x9A', '\xB8', '\xCC', '\x8B', '\xF3', '\xD5',
+0x3D, '\xD2', '\x8D', 0x31, '\xD8', '\xF1', '\xD7', 0x6F, 0x51, 0x58, 0x69, '\xF4', '\xC9', 0x62, 0x2D, 0x60,
+0x14, 0x59, 0x5E, '\xC8', 0x1C, '\xC1', 0x16, '\xDC', 0x7D, '\xD4', 0x14, 0x25, '\x9F', 0x3E, '\x91', 0x63,
+'\xB0', '\xCE', 0x45, '\xCC', 0x50, '\xFC', '\xC5', '\xF0', 0x29, '\xAD', 0x52, '\x8F', 0x6A, '\xD4', 0x34, '\xAB',
+0x7E, 0x21, 0x49, 0x77, '\xC3', '\xFF', 0x57, 0x69, '\xB2', 0x29, 0x35, 0x47, 0x12, 0x05, '\xDE', 0x73,
+0x7B, 0x2B, 0x74, 0x16, 0x34, 0x06, 0x64, '\x93', '\xC5', '\xE1', '\x94', '\xF5', 0x56, 0x6B, '\xB3', 0x6E,
+'\xD3', '\xC9', 0x1E, 0x1D, 0x06, 0x2D, '\xC0', '\xEF', 0x7B, 0x10, '\xEF', '\xAC', 0x33, '\xC4', '\xED', 0x1D,
+0x64, '\x94', '\xDA', 0x5A, 0x73, 0x38, '\xB7', 0x72, 0x79, '\xDB', '\xFC', 0x34, '\x84', 0x4E, 0x77, '\xA9',
+0x44, '\xC8', '\x8D', '\xC5', 0x60, 0x0F, 0x6E, '\xC4', 0x39, 0x30, '\xF6', 0x0E, 0x7C, 0x7E, '\xDE', 0x46,
+0x38, 0x4C, 0x16, '\xA7', 0x7F, 0x72, '\xC8', '\xE8', 0x4D, 0x09, 0x7B, 0x6E, '\xB4', 0x45, '\xA8', '\xE2',
+'\xCC', 0x70, '\x92', '\xA7', 0x71, '\xFA', 0x28, '\xF0', 0x56, 0x09, '\xB7', '\xFC', 0x52, 0x7F, '\xCF', '\x82',
+0x31, 0x79, 0x79, 0x3C, '\x99', 0x4A, '\xAD', 0x45, '\xF1', '\xED', '\xFE', '\xC7', 0x12, '\xE2', 0x18, '\xD8',
+'\x92', '\x8A', '\xA5', 0x7E, 0x64, '\xF0', 0x19, '\xD8', '\x8C', 0x01, '\xB5', 0x7F, '\xCF', 0x16, 0x43, 0x55,
+0x24, '\xCA', '\xB5', '\x99', 0x3F, '\xBC', '\xDD', 0x57, '\x87', '\x87', '\x9E', '\xA0', '\xE1', '\xB5', 0x2B, 0x7A,
+0x6A, 0x28, 0x53, 0x79, 0x47, 0x04, 0x17, '\xE8', 0x0B, 0x6C, '\xD8', 0x3E, 0x54, 0x61, '\xF3', 0x04,
+'\xBE', 0x02, 0x3B, 0x24, '\x91', 0x60, 0x19, 0x05, 0x00, 0x00, 
+};
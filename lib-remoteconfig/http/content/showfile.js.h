@@ -90,3 +90,42 @@ static constexpr char showfile_js[] = {
 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x7B, 0x7D, 0x0A,
 0x7D, 0x00
 };
+static constexpr char showfile_js_gz[] = {
+0x1F, '\x8B', 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, '\x8D', 0x54, '\xDF', 0x4F, '\xDB', 0x30,
+0x10, 0x7E, '\xF7', 0x5F, 0x71, '\xB3', 0x10, 0x71, '\x94', 0x29, '\x85', '\xB1', 0x17, 0x68, '\x9C', 0x49,
+'\x93', '\x90', '\xC6', 0x04, '\xE5', '\x81', '\xBD', 0x4C, 0x08, '\xA9', 0x69, 0x7C, 0x21, '\xD9', 0x52, '\xBB',
+'\xB2', '\xDD', '\xA2', '\xD2', '\xE5', 0x7F, '\x9F', '\xE3', '\x94', '\xFE', '\x80', '\xAA', '\xED', 0x4B, '\xE2', '\xB3',
+'\xBF', '\xBB', '\xEF', '\xBE', '\xF3', '\x9D', 0x33, 0x33, '\x97', 0x39, 0x14, 0x53, '\x99', '\xDB', 0x4A, 0x49,
+'\xD0', 0x58, 0x68, 0x34, 0x25, 0x0B, 0x61, 0x41, '\xAC', '\x9E', '\xBB', '\xAF', '\xA8', 0x34, '\xE6', 0x56,
+'\xE9', 0x39, 0x0B, 0x49, '\x8D', 0x16, 0x04, '\xCF', 0x5E, '\xB2', '\xCA', '\xC2', 0x33, '\xDA', '\x9F', 0x0F,
+'\xF7', 0x03, 0x16, '\x98', 0x52, '\xBD', 0x14, 0x55, '\x8D', 0x3D, 0x63, 0x33, 0x3B, 0x35, 0x41, 0x07,
+0x33, '\x9C', 0x4D, 0x32, 0x6D, '\xF0', 0x46, 0x5A, 0x26, '\xE2', 0x16, 0x13, 0x42, '\xCA', '\xE1', 0x0C,
+0x4E, 0x4F, '\xE1', '\xC3', 0x41, '\xC2', '\xE1', '\xF2', 0x32, '\x84', 0x6F, '\xD0', 0x6D, '\xC0', 0x15, 0x04,
+0x03, 0x25, 0x31, '\xF0', '\x91', 0x6A, '\xA5', 0x26, 0x5C, '\xC4', '\xED', 0x0F, 0x38, '\xE7', 0x40, '\xCF',
+'\xA9', 0x43, '\xD2', '\xDF', 0x68, '\xA8', 0x03, '\xD2', '\x81', '\xA2', '\xA4', '\xE4', '\xC3', '\xC4', '\xEA', 0x34,
+'\xB1', 0x22, '\xBD', 0x53, 0x02, '\x93', '\x9E', 0x5B, '\xB4', '\xC6', '\xC9', 0x42, '\xC4', 0x63, '\xB7', '\xD1',
+'\xF8', 0x1D, 0x70, 0x5F, '\x9D', 0x0E, 0x49, 0x19, '\xAD', '\xE1', 0x0F, '\x8E', 0x6E, 0x03, 0x6E, '\xF6',
+0x20, '\xBD', '\xBA', '\xAD', '\xD0', '\x9D', '\xE0', '\xCE', 0x65, '\x87', '\xC7', '\xAD', '\xCB', '\xB8', '\x92', '\xCF',
+0x1B, 0x2E, '\xAD', '\x86', 0x2D, '\xB8', 0x50, '\xF9', 0x74, '\x8C', '\xD2', '\xC6', '\xAE', '\x9A', '\xD7', 0x35,
+'\xB6', '\xCB', '\xEF', '\xF3', 0x1B, '\xC1', 0x68, 0x25, 0x3A, 0x3E, 0x1A, '\xC6', '\x95', '\x94', '\xA8', 0x7F,
+'\xFC', '\xBA', '\xBB', '\xE5', 0x41, 0x62, '\xB3', 0x51, '\x8D', 0x69, 0x10, '\x95', 0x51, '\xE0', 0x22, 0x74,
+'\x86', 0x2F, '\xD2', 0x68, 0x47, '\x85', 0x06, '\xCA', '\xD7', '\xCE', 0x57, 0x69, '\x99', 0x0B, '\xDD', '\xC7',
+'\xF8', 0x75, '\x8B', 0x6C, 0x44, 0x1A, '\xC8', 0x33, '\x9B', '\x97', '\xC0', 0x50, 0x6B, '\xA5', '\xC3', 0x45,
+0x43, 0x1A, '\x92', 0x6D, '\xB7', '\x8B', '\xC1', '\xDA', '\xB7', 0x4A, '\xAE', '\xA4', '\xB1', 0x30, '\xE3', 0x7B,
+'\xA2', '\x9F', '\xBB', '\xE8', '\xB3', '\xAC', '\x9E', 0x22, '\xE9', '\xFA', 0x67, '\xA2', '\x8C', 0x65, 0x0B, 0x68,
+'\xEF', '\xFB', 0x6A, 0x78, '\xB2', '\x98', 0x35, 0x43, 0x68, 0x42, '\xB2', '\xEA', '\xBF', '\x8F', 0x5C, '\xAE',
+0x0D, '\x8F', '\xE5', '\xBA', '\xD8', 0x54, '\xB2', '\x83', '\x8F', '\xD2', '\xCF', 0x2E, '\x9A', '\xD2', 0x02, '\xF5',
+0x71, '\xDC', '\xE2', 0x78, '\x9D', 0x5F, '\xDE', '\xE9', 0x74, '\xAE', 0x78, 0x40, '\xE8', '\x8A', '\xA6', 0x28,
+'\x98', 0x58, '\xD3', 0x18, '\xE0', '\xCB', '\x81', 0x30, '\xF1', 0x38, '\x9B', 0x30, 0x3F, 0x1A, 0x3C, '\xF5',
+'\x91', '\xBA', '\xC1', '\xF1', 0x57, '\x8F', 0x0E, 0x76, '\xD6', 0x27, '\x85', '\xD2', '\xC0', 0x5A, 0x5B, '\x82',
+0x2A, '\xC0', '\xB4', 0x61, '\xAA', 0x02, '\x98', '\x84', 0x4F, '\xAE', 0x23, '\xD0', '\x99', '\xAE', '\x80', 0x76,
+'\xAA', 0x25, 0x60, '\xBF', 0x21, 0x18, 0x45, 0x7D, 0x47, '\xFC', '\xB6', '\xB3', 0x43, '\xF0', 0x7A, '\xEA',
+0x57, 0x2F, '\xC1', '\xFE', '\xE9', 0x5F, 0x79, 0x2C, 0x1F, '\x80', '\x92', 0x53, '\xEA', 0x17, 0x05, '\xBF',
+0x1F, '\xFD', 0x71, 0x47, '\xF1', 0x5F, '\x9C', 0x1B, 0x26, 0x1E, '\xA9', 0x57, 0x44, '\x9F', 0x42, 0x52,
+'\xC4', 0x2E, '\xE9', '\xEB', 0x2C, 0x2F, '\xD9', 0x1B, 0x2F, 0x73, '\x98', '\x96', 0x70, '\x96', 0x69, '\x98',
+'\xB5', '\xF2', 0x57, '\xE8', 0x47, 0x77, '\xF2', 0x44, 0x4A, '\x88', 0x5C, 0x7B, 0x27, 0x6A, '\xE2', '\x93',
+'\xF4', 0x65, '\xE6', 0x34, '\x9A', '\xF9', 0x6A, 0x44, 0x34, 0x5D, 0x2F, '\xE1', 0x1F, 0x78, '\xA3', 0x7A,
+'\xC5', '\x88', 0x26, '\xBD', '\xCE', 0x21, '\xA5', '\xA4', 0x09, '\xFB', '\xE4', 0x40, '\x93', '\xAE', 0x1A, '\xC7',
+'\xF1', '\x97', '\xE4', '\xC0', 0x4D, 0x1F, 0x0D, '\xBE', 0x78, 0x07, '\xF6', 0x57, '\xBD', 0x6B, '\xC4', '\xFE',
+0x03, '\xCF', 0x5C, '\xFD', 0x1D, '\x91', 0x05, 0x00, 0x00, 
+};
@@ -77,3 +77,37 @@ static constexpr char static_js[] = {
 0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x66, 0x79, 0x3A, 0x20, 0x30, 0x20, 0x7D, 0x29, 0x0A,
 0x7D, 0x0A, 0x7D, 0x00
 };
+static constexpr char static_js_gz[] = {
+0x1F, '\x8B', 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, '\xB5', 0x53, '\xC1', '\x8E', '\xD3', 0x30,
+0x10, '\xBD', '\xE7', 0x2B, '\x86', 0x5C, '\x9C', '\xA8', '\xC5', '\x85', 0x6B, 0x77, '\xE1', '\xB0', 0x50, 0x09,
+0x50, '\xA1', 0x48, 0x5B, '\xED', '\xDD', '\x89', 0x27, 0x5B, '\x83', 0x6B, 0x47, '\xB6', '\x93', 0x2A, 0x5A,
+'\xF5', '\xDF', 0x19, '\xA7', '\xD9', 0x2A, 0x51, 0x5B, 0x24, 0x0E, 0x5C, '\x92', 0x68, '\xE6', '\xCD', '\xBC',
+'\xF7', 0x66, 0x26, '\xC2', 0x77, '\xA6', '\x84', '\xAA', 0x31, 0x65, 0x50, '\xD6', '\xC0', 0x33, '\x86', 0x6F,
+'\x8F', '\x9B', 0x1F, '\xD9', 0x2F, 0x6F, 0x4D, 0x0E, 0x2F, 0x49, 0x70, 0x1D, 0x3D, 0x4B, 0x6B, 0x7C,
+0x00, 0x07, 0x1F, 0x40, 0x1C, '\x84', 0x0A, 0x50, 0x61, 0x28, 0x77, 0x19, 0x5B, 0x44, '\xD4', '\x82',
+'\xCD', 0x7A, 0x70, '\xA2', 0x2A, '\xC8', '\xDE', 0x38, 0x6E, 0x7F, '\xF7', 0x75, 0x3B, 0x67, 0x0F, 0x60,
+'\xF0', 0x00, 0x2B, '\xE7', '\xAC', '\xCB', 0x58, '\xFF', 0x62, 0x79, 0x72, 0x4C, 0x1C, '\x86', '\xC6', 0x19,
+0x70, 0x3C, '\x96', 0x65, 0x14, '\x81', 0x52, 0x50, 0x3B, '\xC8', 0x30, 0x42, '\xA8', '\xF8', 0x48, 0x20,
+0x31, '\x95', '\xA5', '\x95', 0x0F, 0x59, 0x7E, 0x56, '\xA2', '\xCF', 0x4A, 0x5E, '\xF5', '\xB2', '\x88', '\xA0',
+'\xF6', '\xD2', '\x96', '\xCD', 0x1E, 0x4D, '\xE0', '\x94', 0x58, 0x69, '\x8C', '\x9F', 0x0F, '\xDD', 0x57, '\x99',
+'\xA5', 0x4A, '\xAE', 0x09, '\x91', '\xE6', 0x5C, 0x19, '\x83', '\xEE', '\xCB', '\xF6', '\xFB', '\x9A', 0x7A, '\xA4',
+'\xF7', 0x5A, 0x7D, 0x4C, 0x67, '\x9A', '\xC7', 0x6A, 0x6E, '\xC4', 0x1E, 0x67, '\xE9', '\xFD', '\x82', 0x62,
+'\xD3', '\xB8', '\x95', '\xC8', 0x43, 0x57, '\xDF', 0x4E, '\xD6', '\xD6', '\x85', 0x31, 0x22, '\xBD', 0x74, '\xD0',
+'\xA2', '\xF3', 0x2A, '\xFA', 0x3D, '\x9B', 0x68, 0x2F, 0x4D, 0x0C, '\xA0', '\xBF', '\xFB', 0x78, 0x3A, '\x81',
+'\xAE', 0x59, 0x79, 0x4A, 0x67, 0x2D, 0x1F, '\x9A', 0x4C, '\xC4', '\xB6', '\xBC', 0x68, '\x94', '\x96', 0x5C,
+'\x8A', '\x80', 0x57, 0x13, 0x41, '\xED', 0x2F, 0x12, 0x56, 0x38, 0x39, 0x32, 0x74, '\xB6', 0x52, 0x5B,
+0x5A, '\x86', '\x8F', 0x46, '\x86', 0x55, 0x4E, '\xCE', 0x41, '\xF4', 0x20, 0x36, '\xA7', '\xF4', 0x1E, '\xC3',
+'\xCE', '\xCA', 0x25, '\xB0', '\x9F', '\x9B', '\xC7', 0x2D, '\x9B', 0x27, 0x3B, 0x14, '\x92', '\xC4', 0x2D, 0x29,
+'\xC5', 0x3E, 0x59, 0x13, '\xC8', '\xD4', '\xDB', 0x2D, 0x4D, '\x8D', 0x11, 0x44, '\xD4', '\xB5', 0x56, 0x74,
+0x08, 0x54, '\xDB', '\xF7', 0x61, '\xC9', 0x71, '\x9E', 0x14, 0x56, 0x76, 0x4B, '\x88', '\xB3', '\xE1', 0x3E,
+0x38, 0x65, '\x9E', 0x55, '\xD5', 0x11, 0x73, 0x72, '\xCC', '\xC7', 0x7A, 0x24, 0x6A, '\xFC', 0x47, 0x41,
+'\x9F', 0x57, '\xEB', '\xD5', 0x76, '\xF5', '\xFF', 0x24, 0x39, 0x2C, '\xAC', 0x3D, 0x5D, 0x6C, 0x3F, '\xAD',
+'\x97', 0x21, '\xB2', '\x84', '\xF7', 0x30, 0x45, 0x6A, 0x4B, 0x0C, '\xD8', 0x23, 0x5B, '\xE1', '\xA0', '\xA0',
+0x55, '\xDE', '\xDA', 0x3D, 0x3B, 0x61, 0x1F, '\x9A', 0x10, '\xE2', '\x8D', '\xDC', '\xF5', 0x7F, 0x5C, '\xC1',
+0x4B, 0x2D, '\xBC', '\x8F', '\xC7', '\xCD', '\xE9', '\xAE', '\x82', 0x50, '\xC6', 0x67, 0x4C, '\x99', '\xE8', '\xBA',
+0x45, '\x96', '\xC7', '\xC6', 0x63, '\x8C', '\xC3', '\xBD', 0x6D, 0x71, '\x8C', '\x98', '\xA4', '\x85', 0x24, '\x9E',
+0x51, 0x66, 0x7C, 0x62, 0x6C, '\xDD', '\xF3', '\xC3', '\x86', 0x26, 0x31, '\xB8', 0x52, '\x92', '\xC4', '\xD1',
+0x04, 0x5E, 0x7D, 0x01, 0x6A, '\x8F', 0x37, 0x18, 0x6F, '\xF3', 0x4D, '\xB4', 0x5C, 0x65, '\xAC', '\xAA',
+0x2B, '\x94', '\xEF', 0x4E, '\xA3', 0x3C, '\xFE', 0x01, 0x14, 0x12, 0x4C, 0x69, '\xC3', 0x04, 0x00, 0x00,
+
+};
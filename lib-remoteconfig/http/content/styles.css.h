@@ -26,3 +26,20 @@ static constexpr char styles_css[] = {
 0x6E, 0x20, 0x7B, 0x0A, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x6C, 0x65, 0x66, 0x74, 0x3A,
 0x20, 0x35, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x00
 };
+static constexpr char styles_css_gz[] = {
+0x1F, '\x8B', 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, '\x95', '\x90', '\xCF', 0x6A, 0x03, 0x21,
+0x10, '\x87', '\xEF', '\xFB', 0x14, 0x03, '\xB9', '\xA4', '\x90', 0x0D, '\xB6', 0x74, 0x2F, '\xE6', 0x69, '\xFC',
+'\xBB', '\xB5', '\xB5', '\x8E', '\x8C', 0x63, '\x89', '\x94', '\xBC', 0x7B, 0x35, 0x4B, 0x42, '\xA1', '\xB9', 0x14,
+0x64, 0x0E, '\xDF', '\xE8', 0x37, '\xE3', 0x4F, '\xA3', 0x6D, '\xF0', 0x3D, 0x69, 0x65, 0x3E, 0x56, '\xC2',
+'\x9A', '\xEC', 0x6C, 0x30, 0x22, 0x49, '\xA0', 0x55, '\xEF', 0x5F, '\xC4', '\xE1', 0x7A, '\x9E', 0x4E, '\xD3',
+0x6F, '\xBA', 0x2C, 0x07, '\xB8', '\x95', '\xDE', '\xBA', 0x4C, 0x35, 0x76, '\x85', 0x0D, 0x25, 0x47, '\xD5',
+0x24, '\xF8', '\xE8', '\xCE', '\x83', '\xC6', '\xD0', 0x69, 0x0C, '\x85', '\xE7', '\xC2', 0x2D, 0x3A, 0x09, 0x09,
+'\x93', 0x3B, 0x4D, '\x9F', '\x8A', '\xD6', '\x90', 0x24, 0x3C, '\xE7', 0x33, 0x2C, '\xF9', 0x7A, '\xF3', '\xCD',
+0x29, '\xEB', '\xE8', '\xAF', 0x43, 0x23, 0x75, 0x3E, '\x93', '\xB2', '\xA1', 0x16, 0x09, '\xAF', '\xF9', '\xCE',
+0x24, 0x14, '\x8C', '\xC1', '\xC2', 0x4A, '\xAE', 0x0D, '\xD3', '\xB0', 0x78, 0x44, 0x7E, 0x64, 0x79, '\xAF',
+'\x85', '\x83', 0x6F, '\xFD', 0x63, '\x89', 0x5D, 0x62, 0x09, '\xA6', 0x57, 0x47, '\xFF', '\xD5', '\xEB', '\xCA',
+'\x8C', '\xA9', '\xEB', 0x4D, '\xA5', 0x32, '\xB2', '\xC8', 0x18, 0x36, '\xCF', '\xAD', 0x27, '\x95', '\xE1', '\xF0',
+'\xE5', 0x1E, '\xC6', '\xB9', 0x13, 0x42, '\xDC', 0x53, '\xDC', 0x79, '\xEF', '\xC7', '\xB3', '\xA3', '\xE6', 0x21,
+'\xDC', 0x12, '\x99', '\xA3', '\xF3', 0x7D, '\xB9', 0x45, 0x6C, '\xE3', 0x7E, 0x00, '\xF7', 0x11, 0x51, 0x2F,
+'\x99', 0x01, 0x00, 0x00, 
+};
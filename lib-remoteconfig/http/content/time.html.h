@@ -38,3 +38,25 @@ static constexpr char time_html[] = {
 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A,
 0x3C, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x00
 };
+static constexpr char time_html_gz[] = {
+0x1F, '\x8B', 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, '\x9D', 0x52, 0x31, 0x52, '\xC3', 0x30,
+0x10, '\xEC', '\xFD', '\x8A', 0x43, 0x55, '\xD2', 0x44, 0x0F, 0x40, 0x56, 0x03, 0x74, '\x99', '\xC0', 0x40,
+0x06, '\x86', 0x52, '\x96', 0x2E, 0x63, 0x25, '\x8A', '\xE5', '\x91', '\xCE', 0x01, '\xFF', 0x1E, '\xC9', 0x72,
+0x32, 0x04, 0x2A, '\xA8', '\xBC', 0x73, '\xDA', '\xDD', '\xDB', '\xBB', '\xB3', '\xB8', '\xB9', 0x7F, '\xBC', '\xDB',
+'\xBE', 0x3F, 0x3D, 0x40, 0x4B, 0x47, 0x27, 0x2B, 0x71, '\xFE', '\xA0', 0x32, 0x52, 0x38, '\xDB', 0x1D,
+0x20, '\xA0', '\xAB', 0x59, '\xA4', '\xD1', 0x61, 0x6C, 0x11, '\x89', 0x41, 0x1B, 0x70, 0x77, '\xAE', '\xAC',
+0x74, '\x8C', 0x0C, '\xB8', 0x14, 0x64, '\xC9', '\xA1', '\xDC', 0x78, '\x83', '\xB0', '\xB5', 0x47, 0x14, '\xBC',
+0x14, 0x04, '\x9F', '\x9C', 0x2A, '\xD1', 0x78, 0x33, '\xCE', '\xBE', 0x18, '\xA4', 0x18, 0x1C, 0x58, 0x53,
+0x33, 0x6B, '\xD6', 0x36, 0x12, 0x4B, '\xB4', '\xC1', '\xCD', '\xDC', '\xF4', 0x5A, '\x89', 0x5E, '\x8A', 0x66,
+0x20, '\xF2', 0x1D, '\xF8', 0x4E, 0x3B, '\xAB', 0x0F, 0x35, 0x4B, 0x4D, 0x43, 0x4A, '\xB0', 0x58, 0x32,
+'\xF9', 0x5C, '\xA0', '\xE0', '\x85', '\x93', '\x84', 0x7D, '\xD6', 0x4C, '\x8E', 0x5D, 0x4A, '\x90', 0x03, '\xB0',
+'\x92', '\x85', 0x12, '\x84', 0x0F, '\xEB', 0x1C, 0x34, 0x08, '\xC6', '\xC6', '\xDE', '\xA9', 0x11, 0x0D, '\xB4',
+0x18, 0x70, 0x56, '\xFD', '\xEE', 0x14, '\xC7', 0x4E, '\xBF', 0x59, 0x6A, '\xD7', 0x5E, 0x2B, '\x97', '\xBD',
+0x72, '\xCF', '\x97', 0x54, 0x4C, 0x46, '\xD4', '\xC2', 0x54, '\x9E', '\x87', '\xBC', 0x0A, '\xB0', '\xF3', '\x9E',
+'\xAE', 0x66, 0x7B, '\xC5', 0x10, '\xAD', '\xEF', 0x2E, '\xE3', '\xCD', '\x84', 0x4A, 0x44, 0x1D, 0x6C, 0x4F,
+0x10, '\x83', '\xCE', 0x7B, 0x54, 0x64, '\xF5', 0x6A, '\x9F', '\xD6', 0x48, 0x63, '\x8F', 0x35, 0x23, '\xFC',
+0x24, '\xBE', 0x57, 0x27, 0x55, 0x58, 0x59, 0x5D, '\xD0', 0x0F, '\xA1', 0x51, '\x84', '\xFF', '\x90', '\xE5',
+'\x8D', '\xFC', 0x49, 0x26, 0x5D, 0x3A, '\xD1', 0x62, 0x79, 0x7B, 0x2A, '\xD3', 0x24, 0x74, 0x39, '\xC5',
+0x37, 0x2E, '\x9F', 0x0F, '\xCC', '\xA7', 0x1F, '\xE8', 0x0B, 0x70, '\xDD', 0x1A, 0x0D, 0x57, 0x02, 0x00,
+0x00, 
+};
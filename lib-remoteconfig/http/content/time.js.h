@@ -25,3 +25,19 @@ static constexpr char time_js[] = {
 0x70, 0x6F, 0x73, 0x74, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x0A, 0x72, 0x65, 0x66, 0x72, 0x65,
 0x73, 0x68, 0x28, 0x29, 0x0A, 0x7D, 0x00
 };
+static constexpr char time_js_gz[] = {
+0x1F, '\x8B', 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, '\xAD', 0x50, '\xBB', 0x0A, '\xC2', 0x40,
+0x10, '\xEC', '\xEF', 0x2B, '\xB6', 0x10, 0x72, '\xD7', '\xE4', 0x03, 0x04, 0x1B, 0x1F, '\x85', 0x22, '\xB1',
+0x50, '\xB0', '\xCD', 0x71, '\xD9', '\x98', 0x40, 0x72, 0x27, '\xC9', '\x86', 0x18, 0x42, '\xFE', '\xDD', '\xDD',
+0x28, '\x82', '\x9D', '\x85', '\xDD', 0x2E, 0x33, 0x3B, 0x33, 0x3B, '\xB6', 0x1D, '\xBC', '\x83', '\xBC', '\xF3',
+'\x8E', '\xCA', '\xE0', '\xA1', '\xC1', '\xBC', '\xC1', '\xB6', '\xD0', 0x06, 0x46, 0x55, 0x21, 0x41, 0x66, '\xC9',
+'\xC2', 0x0A, 0x6C, 0x6F, 0x4B, '\x82', 0x1B, '\xD2', '\xE1', 0x7C, 0x4A, 0x74, 0x44, 0x65, '\x8D', '\x8C',
+0x60, 0x64, '\x94', 0x0B, '\xBE', 0x25, '\xF0', 0x21, 0x43, '\xA6', '\xE5', '\xA1', '\xA9', 0x2D, 0x6D, 0x19,
+'\xB9', 0x30, 0x43, 0x7B, '\xEC', 0x41, 0x16, 0x2D, 0x2A, '\xB1', 0x1C, 0x18, '\xA3', '\xB2', '\xE0', '\xBA',
+0x1A, 0x3D, '\xC5', '\xAC', '\xB6', '\xAB', 0x50, '\xC6', '\xF5', '\xB0', '\xCF', 0x74, 0x24, 0x1A, 0x72, 0x16,
+'\x99', '\x98', '\xF0', 0x41, '\x9B', '\xE0', '\x89', 0x31, 0x56, 0x4D, 0x13, 0x51, 0x17, 0x68, 0x09, '\x8B',
+0x51, 0x68, 0x53, '\xAA', 0x26, 0x65, '\xBF', '\x93', '\xCB', 0x76, 0x2D, '\xA9', 0x38, 0x06, 0x67, '\xAB',
+'\xD9', 0x5E, 0x7E, '\xF8', 0x29, '\xDE', '\xFF', 0x52, '\xBD', '\xEC', '\xDE', '\xA5', '\x8D', 0x32, 0x30, 0x3A,
+'\xBB', 0x73, '\xDE', '\xB9', '\xC3', 0x7B, 0x68, 0x69, '\xEE', '\xC3', '\xA8', 0x4F, '\xD7', 0x6A, 0x7A, 0x02,
+0x72, '\x97', 0x64, 0x6F, '\x86', 0x01, 0x00, 0x00, 
+};
@@ -28,8 +28,11 @@
 
 namespace http {
 static constexpr uint32_t BUFSIZE = 1440; //TODO We need the TCP max segment size here
+static constexpr uint32_t HEADER_BUFSIZE = 512;
+static constexpr uint32_t KEEP_ALIVE_TIMEOUT = 5;	///< Seconds, an idle persistent connection is closed by the server
 enum class Status {
 	OK = 200,
+	NOT_MODIFIED = 304,
 	BAD_REQUEST = 400,
 	NOT_FOUND = 404,
 	REQUEST_TIMEOUT = 408,
@@ -40,6 +43,10 @@ enum class Status {
 	VERSION_NOT_SUPPORTED = 505,
 	UNKNOWN_ERROR = 520
 };
+namespace uri {
+enum class Id : uint8_t;	///< Generated, see http/content/json_switch.h
+}  // namespace uri
+
 enum class RequestMethod {
 	GET, POST, DELETE, UNKNOWN
 };
@@ -47,6 +54,20 @@ enum class RequestMethod {
 enum class contentTypes {
 	TEXT_HTML, TEXT_CSS, TEXT_JS, APPLICATION_JSON, APPLICATION_OCTET_STREAM, NOT_DEFINED
 };
+
+/**
+ * Generates a response body in parts, sent with Transfer-Encoding: chunked.
+ * nCursor is 0 for the first part, the generator sets it to 0 after the last part.
+ * @return number of bytes written in pOutBuffer
+ */
+typedef uint32_t (*ContentGenerator)(uint32_t& nCursor, char *pOutBuffer, const uint32_t nOutBufferSize);
+
+struct Stats {
+	uint32_t nRequests;				///< Requests parsed
+	uint32_t nConnectionsReused;	///< Requests on a connection which already had a request
+	uint32_t nPipelined;			///< Requests found behind another request in the same segment
+	uint32_t nIdleClosed;			///< Persistent connections closed after KEEP_ALIVE_TIMEOUT
+};
 }  // namespace http
 
 #endif /* HTTPD_HTTP_H_ */
@@ -31,6 +31,7 @@
 #include "http.h"
 #include "httpdhandlerequest.h"
 
+#include "hardware.h"
 #include "network.h"
 
 #include "../../lib-network/config/net_config.h"
@@ -41,22 +42,46 @@ public:
 	~HttpDaemon();
 
 	void Run() {
+		/*
+		 * Back-pressure: no new request is read until the pending response is queued.
+		 * The shared response buffers are in use until then.
+		 */
+		if (__builtin_expect((m_pPending != nullptr), 0)) {
+			if (m_pPending->Resume()) {
+				m_pPending = nullptr;
+			}
+			return;
+		}
+
 		uint32_t nConnectionHandle;
 		const auto nBytesReceived = Network::Get()->TcpRead(m_nHandle, const_cast<const uint8_t **>(reinterpret_cast<uint8_t **>(&m_RequestHeaderResponse)), nConnectionHandle);
 
 		if (__builtin_expect((nBytesReceived == 0), 1)) {
+			const auto nMillis = Hardware::Get()->Millis();
+
+			if (__builtin_expect(((nMillis - m_nIdleCheckMillis) >= 1000), 0)) {
+				m_nIdleCheckMillis = nMillis;
+
+				for (uint32_t nIndex = 0; nIndex < TCP_MAX_TCBS_ALLOWED; nIndex++) {
+					pHandleRequest[nIndex]->CloseIdle(http::KEEP_ALIVE_TIMEOUT * 1000U);
+				}
+			}
 			return;
 		}
 
 		DEBUG_PRINTF("nConnectionHandle=%u", nConnectionHandle);
 
-		pHandleRequest[nConnectionHandle]->HandleRequest(nBytesReceived, m_RequestHeaderResponse);
+		if (!pHandleRequest[nConnectionHandle]->HandleRequest(nBytesReceived, m_RequestHeaderResponse)) {
+			m_pPending = pHandleRequest[nConnectionHandle];
+		}
 	}
 
 private:
 	HttpDeamonHandleRequest *pHandleRequest[TCP_MAX_TCBS_ALLOWED];
+	HttpDeamonHandleRequest *m_pPending { nullptr };
 	int32_t m_nHandle { -1 };
 	char *m_RequestHeaderResponse { nullptr };
+	uint32_t m_nIdleCheckMillis { 0 };
 };
 
 #endif /* HTTPD_HTTPD_H_ */
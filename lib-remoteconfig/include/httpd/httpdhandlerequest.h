@@ -40,16 +40,32 @@ public:
 		DEBUG_EXIT
 	}
 
-	void HandleRequest(const uint32_t nBytesReceived, char *pRequestHeaderResponse);
+	/**
+	 * @return false when the response did not fit in the TCP transmit queue, continue with Resume()
+	 */
+	bool HandleRequest(const uint32_t nBytesReceived, char *pRequestHeaderResponse);
+	bool Resume();
+	void CloseIdle(const uint32_t nTimeoutMillis);
+
+	static const http::Stats& GetStats() {
+		return m_Stats;
+	}
 
 private:
+	void HandleSingleRequest();
+	bool HandlePipelined();
+	void KeepPipelined();
+	bool Flush();
+	void Finish();
 	http::Status ParseRequest();
 	http::Status ParseMethod(char *pLine);
 	http::Status ParseHeaderField(char *pLine);
 	http::Status HandleGet();
 	http::Status HandleGetTxt();
+	bool IsNoneMatchFailed() const;
 	http::Status HandlePost(const bool hasDataOnly);
 	http::Status HandleDelete(const bool hasDataOnly);
+	bool WriteChunk();
 
 private:
 	uint32_t m_nConnectionHandle;
@@ -60,17 +76,44 @@ private:
 	uint32_t m_nBytesReceived { 0 };
 
 	char *m_pUri { nullptr };
+	const char *m_pQuery { nullptr };
 	char *m_pFileData { nullptr };
 	const char *m_pContent { nullptr };
+	http::ContentGenerator m_pContentGenerator { nullptr };
+	const char *m_pETag { nullptr };
+	const char *m_pIfNoneMatch { nullptr };
 	char *m_RequestHeaderResponse { nullptr };
-
+	char *m_pPipelined { nullptr };
+	uint32_t m_nPipelinedLength { 0 };
+	uint32_t m_nConnectionId { 0 };
+
+	/*
+	 * Response output, written as far as the TCP transmit queue takes it
+	 */
+	enum class Output : uint8_t {
+		IDLE, HEADER, BODY, CHUNKS, LAST_CHUNK
+	};
+	const uint8_t *m_pSend { nullptr };
+	uint32_t m_nSendLength { 0 };
+	uint32_t m_nChunkCursor { 0 };
+	Output m_Output { Output::IDLE };
+	bool m_IsLastChunk { false };
+
+	http::uri::Id m_UriId { };
 	http::Status m_Status { http::Status::UNKNOWN_ERROR };
 	http::RequestMethod m_RequestMethod { http::RequestMethod::UNKNOWN };
 	http::contentTypes m_ContentType { http::contentTypes::NOT_DEFINED };
 
 	bool m_IsAction { false };
+	bool m_IsAcceptGzip { false };
+	bool m_IsContentGzip { false };
+	bool m_IsConnectionClose { false };
+	bool m_IsHttp10 { false };
 
 	static char m_DynamicContent[http::BUFSIZE];
+	static char m_ResponseHeader[http::HEADER_BUFSIZE];
+	static char m_Pipelined[http::BUFSIZE];
+	static http::Stats m_Stats;
 };
 
 
@@ -51,6 +51,7 @@
 
 #if defined(ENABLE_TFTP_SERVER)
 # include "tftp/tftpfileserver.h"
+# include "flashcodeinstall.h"
 #endif
 
 #if defined (ENABLE_HTTPD)
@@ -214,6 +215,12 @@ public:
 		if (__builtin_expect((m_pTFTPFileServer != nullptr), 0)) {
 			m_pTFTPFileServer->Run();
 		}
+
+		if (__builtin_expect((m_pFlashCodeInstall != nullptr), 0)) {
+			if (m_pFlashCodeInstall->IsBusy()) {
+				m_pFlashCodeInstall->Run();
+			}
+		}
 #endif
 
 #if defined (ENABLE_HTTPD)
@@ -493,6 +500,9 @@ private:
 	static const Commands s_GET[];
 	static const Commands s_SET[];
 
+	static void CommandsHashInit(const Commands *pCommands, const uint32_t nCommands, int8_t *pSlots, const uint32_t nSeed, const uint32_t nMask);
+	const Commands *CommandsLookup(const Commands *pCommands, const int8_t *pSlots, const uint32_t nSeed, const uint32_t nMask, const uint32_t nMaxLength) const;
+
 	struct Txt {
 		void (RemoteConfig::*GetHandler)(uint32_t& nSize);
 		void (RemoteConfig::*SetHandler)();
@@ -501,6 +511,9 @@ private:
 	};
 
 	static const Txt s_TXT[];
+#if !defined (CONFIG_REMOTECONFIG_MINIMUM)
+	static void TxtHashInit();
+#endif
 
 	struct ListBin {
 		uint8_t aMacAddress[network::MAC_SIZE];
@@ -526,6 +539,7 @@ private:
 
 #if defined(ENABLE_TFTP_SERVER)
 	TFTPFileServer *m_pTFTPFileServer { nullptr };
+	FlashCodeInstall *m_pFlashCodeInstall { nullptr };	///< Set when the TFTP server is started
 #endif
 	bool m_bEnableTFTP { false };
 
@@ -36,6 +36,7 @@ uint32_t json_get_display(char *pOutBuffer, const uint32_t nOutBufferSize);
 uint32_t json_get_directory(char *pOutBuffer, const uint32_t nOutBufferSize);
 namespace net {
 uint32_t json_get_phystatus(char *pOutBuffer, const uint32_t nOutBufferSize);
+uint32_t json_get_netstats(char *pOutBuffer, const uint32_t nOutBufferSize);
 }  // namespace net
 namespace dmx {
 uint32_t json_get_ports(char *pOutBuffer, const uint32_t nOutBufferSize);
@@ -45,10 +46,10 @@ namespace rdm {
 uint32_t json_get_rdm(char *pOutBuffer, const uint32_t nOutBufferSize);
 uint32_t json_get_queue(char *pOutBuffer, const uint32_t nOutBufferSize);
 uint32_t json_get_portstatus(char *pOutBuffer, const uint32_t nOutBufferSize);
-uint32_t json_get_tod(const char cPort, char *pOutBuffer, const uint32_t nOutBufferSize);
+uint32_t json_get_tod(const char cPort, uint32_t& nCursor, char *pOutBuffer, const uint32_t nOutBufferSize);
 }  // namespace rdm
 namespace storage {
-uint32_t json_get_directory(char *pOutBuffer, const uint32_t nOutBufferSize);
+uint32_t json_get_directory(uint32_t& nCursor, char *pOutBuffer, const uint32_t nOutBufferSize);
 }  // namespace storage
 namespace dsa {
 uint32_t json_get_portstatus(char *pOutBuffer, const uint32_t nOutBufferSize);
@@ -70,7 +71,7 @@ void json_set_rtc(const char *pBuffer, const uint32_t nBufferSize);
 }  // namespace rtc
 namespace artnet {
 namespace controller {
-uint32_t json_get_polltable(char *pOutBuffer, const uint32_t nOutBufferSize);
+uint32_t json_get_polltable(uint32_t& nCursor, char *pOutBuffer, const uint32_t nOutBufferSize);
 }  // namespace controller
 }  // namespace artnet
 namespace pixel {
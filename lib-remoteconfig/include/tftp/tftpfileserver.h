@@ -63,7 +63,7 @@ namespace tftpfileserver {
 
 class TFTPFileServer final: public TFTPDaemon {
 public:
-	TFTPFileServer(uint8_t *pBuffer, uint32_t nSize);
+	TFTPFileServer();
 	~TFTPFileServer() override {}
 
 	bool FileOpen(const char *pFileName, tftp::Mode mode) override;
@@ -82,8 +82,6 @@ public:
 	}
 
 private:
-	uint8_t *m_pBuffer;
-	uint32_t m_nSize;
 	uint32_t m_nFileSize { 0 };
 	bool m_bDone { false };
 };
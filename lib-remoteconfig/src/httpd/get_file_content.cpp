@@ -59,81 +59,99 @@ static http::contentTypes getContentType(const char *pFileName) {
 	return http::contentTypes::NOT_DEFINED;
 }
 
-uint32_t get_file_content(const char *fileName, char *pDst, http::contentTypes& contentType) {
-	auto *pFile = fopen(fileName, "r");
+static FILE *s_pFile;
+static bool s_doRemoveWhiteSpaces;
 
-	if (pFile == nullptr) {
+bool get_file_content_open(const char *pFileName, http::contentTypes& contentType) {
+	DEBUG_ENTRY
+	DEBUG_PUTS(pFileName);
+
+	assert(s_pFile == nullptr);
+
+	contentType = getContentType(pFileName);
+
+	if (contentType == http::contentTypes::NOT_DEFINED) {
 		DEBUG_EXIT
-		return 0;
+		return false;
 	}
 
-	contentType = getContentType(fileName);
+	s_pFile = fopen(pFileName, "r");
 
-	if (contentType == http::contentTypes::NOT_DEFINED) {
+	if (s_pFile == nullptr) {
 		DEBUG_EXIT
-		fclose(pFile);
-		return 0;
+		return false;
 	}
 
-	auto doRemoveWhiteSpaces = true;
-	auto *p = pDst;
-	int c;
+	s_doRemoveWhiteSpaces = true;
+
+	DEBUG_EXIT
+	return true;
+}
+
+/**
+ * The file is read in parts, the leading white spaces of each line are removed.
+ * The file is closed after the last part, nCursor is then 0.
+ */
+uint32_t get_file_content_read(uint32_t& nCursor, char *pOutBuffer, const uint32_t nOutBufferSize) {
+	assert(s_pFile != nullptr);
+
+	auto *p = pOutBuffer;
+	int c = 0;
 
-	while ((c = fgetc(pFile)) != EOF) {
-		if (doRemoveWhiteSpaces) {
+	while ((static_cast<uint32_t>(p - pOutBuffer) < nOutBufferSize) && ((c = fgetc(s_pFile)) != EOF)) {
+		if (s_doRemoveWhiteSpaces) {
 			if (c <= ' ') {
 				continue;
 			} else {
-				doRemoveWhiteSpaces = false;
+				s_doRemoveWhiteSpaces = false;
 			}
 		} else {
 			if (c == '\n') {
-				doRemoveWhiteSpaces = true;
+				s_doRemoveWhiteSpaces = true;
 			}
 		}
-		*p++ = c;
-		if ((p - pDst) == http::BUFSIZE) {
-			DEBUG_PUTS("File too long");
-			break;
-		}
+		*p++ = static_cast<char>(c);
 	}
 
-	fclose(pFile);
-
-	DEBUG_PRINTF("%s -> %d", fileName, static_cast<int>(p - pDst));
-	return static_cast<uint32_t>(p - pDst);
-}
-
-static char s_StaticContent[http::BUFSIZE];
-
-const char *get_file_content(const char *pFileName, uint32_t& nSize, http::contentTypes& contentType) {
-	DEBUG_ENTRY
-	DEBUG_PUTS(pFileName);
-
-	nSize = get_file_content(pFileName, s_StaticContent, contentType);
-
-	if (nSize != 0) {
-		return s_StaticContent;
+	if (c == EOF) {
+		fclose(s_pFile);
+		s_pFile = nullptr;
+		nCursor = 0;
+	} else {
+		nCursor++;
 	}
 
-	DEBUG_EXIT
-	return nullptr;
+	DEBUG_PRINTF("%u", static_cast<unsigned int>(p - pOutBuffer));
+	return static_cast<uint32_t>(p - pOutBuffer);
 }
 #else
-const char *get_file_content(const char *pFileName, uint32_t& nSize, http::contentTypes& contentType) {
+/**
+ * @param isGzip in: the client accepts gzip, out: the content is gzip encoded
+ */
+const char *get_file_content(const char *pFileName, uint32_t& nSize, http::contentTypes& contentType, const char *&pETag, bool& isGzip) {
 	DEBUG_ENTRY
 	DEBUG_PUTS(pFileName);
 
 	for (auto& content : HttpContent) {
 		if (strcmp(pFileName, content.pFileName) == 0) {
-			nSize = content.nContentLength;
 			contentType = content.contentType;
+			pETag = content.pETag;
+
+			if (isGzip && (content.nContentGzipLength < content.nContentLength)) {
+				nSize = content.nContentGzipLength;
+				return content.pContentGzip;
+			}
+
+			isGzip = false;
+			nSize = content.nContentLength;
 			return content.pContent;
 		}
 	}
 
 	nSize = 0;
 	contentType = http::contentTypes::NOT_DEFINED;
+	pETag = nullptr;
+	isGzip = false;
 
 	DEBUG_EXIT
 	return nullptr;
@@ -69,11 +69,26 @@
 #include "debug.h"
 
 #if defined ENABLE_CONTENT
-//uint32_t get_file_content(const char *fileName, char *pDst, http::contentTypes& contentType);
-const char *get_file_content(const char *fileName, uint32_t& nSize, http::contentTypes& contentType);
+# if defined (CONFIG_HTTP_CONTENT_FS)
+bool get_file_content_open(const char *pFileName, http::contentTypes& contentType);
+uint32_t get_file_content_read(uint32_t& nCursor, char *pOutBuffer, const uint32_t nOutBufferSize);
+# else
+const char *get_file_content(const char *pFileName, uint32_t& nSize, http::contentTypes& contentType, const char *&pETag, bool& isGzip);
+# endif
+#endif
+
+#if defined (RDM_CONTROLLER) && !defined (CONFIG_HTTP_HTML_NO_RDM)
+static char s_cTodPort;
+
+static uint32_t get_tod(uint32_t& nCursor, char *pOutBuffer, const uint32_t nOutBufferSize) {
+	return remoteconfig::rdm::json_get_tod(s_cTodPort, nCursor, pOutBuffer, nOutBufferSize);
+}
 #endif
 
 char HttpDeamonHandleRequest::m_DynamicContent[http::BUFSIZE];
+char HttpDeamonHandleRequest::m_ResponseHeader[http::HEADER_BUFSIZE];
+char HttpDeamonHandleRequest::m_Pipelined[http::BUFSIZE];
+http::Stats HttpDeamonHandleRequest::m_Stats;
 
 #ifndef NDEBUG
 static constexpr char s_request_method[][8] = {"GET", "POST", "DELETE", "UNKNOWN" };
@@ -82,11 +97,112 @@ static constexpr char s_request_method[][8] = {"GET", "POST", "DELETE", "UNKNOWN
 static constexpr char s_contentType[static_cast<uint32_t>(http::contentTypes::NOT_DEFINED)][32] =
 { "text/html", "text/css", "text/javascript", "application/json", "application/octet-stream" };
 
-void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char *pRequestHeaderResponse) {
+static uint32_t json_get_httpstats(char *pOutBuffer, const uint32_t nOutBufferSize) {
+	const auto& stats = HttpDeamonHandleRequest::GetStats();
+
+	const auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nOutBufferSize,
+			"{\"keep_alive_timeout\":%u,\"requests\":%u,\"connections_reused\":%u,\"pipelined\":%u,\"idle_closed\":%u}",
+			static_cast<unsigned int>(http::KEEP_ALIVE_TIMEOUT),
+			static_cast<unsigned int>(stats.nRequests),
+			static_cast<unsigned int>(stats.nConnectionsReused),
+			static_cast<unsigned int>(stats.nPipelined),
+			static_cast<unsigned int>(stats.nIdleClosed)));
+
+	return nLength;
+}
+
+/**
+ * A segment can hold more than one GET request (pipelining),
+ * the responses are sent in the order of the requests.
+ */
+bool HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char *pRequestHeaderResponse) {
 	DEBUG_ENTRY
 
 	m_nBytesReceived = nBytesReceived;
 	m_RequestHeaderResponse = pRequestHeaderResponse;
+	m_nPipelinedLength = 0;
+
+	HandleSingleRequest();
+
+	const auto isDone = HandlePipelined();
+
+	DEBUG_EXIT
+	return isDone;
+}
+
+bool HttpDeamonHandleRequest::HandlePipelined() {
+	while ((m_nPipelinedLength != 0) && !m_IsConnectionClose) {
+		if (m_Output != Output::IDLE) {
+			KeepPipelined();
+			return false;
+		}
+
+		m_Stats.nPipelined++;
+
+		m_nBytesReceived = m_nPipelinedLength;
+		m_RequestHeaderResponse = m_pPipelined;
+		m_nPipelinedLength = 0;
+
+		HandleSingleRequest();
+	}
+
+	return (m_Output == Output::IDLE);
+}
+
+/**
+ * The segment returned by TcpRead() is only valid until the main loop runs again.
+ * The requests behind a pending response are copied, only one response
+ * is pending at a time (see HttpDaemon::Run), so one buffer is sufficient.
+ * One byte is kept free, ParseRequest() terminates a request body with a NUL.
+ */
+void HttpDeamonHandleRequest::KeepPipelined() {
+	if (m_pPipelined == m_Pipelined) {
+		return;
+	}
+
+	if (__builtin_expect((m_nPipelinedLength > (sizeof(m_Pipelined) - 1U)), 0)) {
+		DEBUG_PUTS("Pipelined requests too long");
+		m_nPipelinedLength = 0;
+		m_IsConnectionClose = true;
+		return;
+	}
+
+	memmove(m_Pipelined, m_pPipelined, m_nPipelinedLength);
+	m_pPipelined = m_Pipelined;
+}
+
+/**
+ * Continue the response which did not fit in the TCP transmit queue,
+ * then the pipelined requests behind it.
+ * @return true when done
+ */
+bool HttpDeamonHandleRequest::Resume() {
+	if (!Flush()) {
+		return false;
+	}
+
+	Finish();
+
+	return HandlePipelined();
+}
+
+void HttpDeamonHandleRequest::CloseIdle(const uint32_t nTimeoutMillis) {
+	net::tcp::Connection connection;
+	Network::Get()->TcpGetConnection(m_nHandle, m_nConnectionHandle, connection);
+
+	if (connection.isEstablished && (connection.nIdleMillis >= nTimeoutMillis)) {
+		DEBUG_PRINTF("%u: idle %u ms", m_nConnectionHandle, connection.nIdleMillis);
+		Network::Get()->TcpClose(m_nHandle, m_nConnectionHandle);
+
+		m_Status = http::Status::UNKNOWN_ERROR;
+		m_RequestMethod = http::RequestMethod::UNKNOWN;
+
+		m_Stats.nIdleClosed++;
+	}
+}
+
+void HttpDeamonHandleRequest::HandleSingleRequest() {
+	DEBUG_ENTRY
 
 	const char *pStatusMsg = "OK";
 
@@ -94,6 +210,17 @@ void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char
 
 	if (m_Status == http::Status::UNKNOWN_ERROR) {
 		// This is an initial incoming HTTP request
+		net::tcp::Connection connection;
+		Network::Get()->TcpGetConnection(m_nHandle, m_nConnectionHandle, connection);
+
+		if (connection.nId == m_nConnectionId) {
+			m_Stats.nConnectionsReused++;
+		} else {
+			m_nConnectionId = connection.nId;
+		}
+
+		m_Stats.nRequests++;
+
 		m_Status = ParseRequest();
 
 		DEBUG_PRINTF("%s %s", s_request_method[static_cast<uint32_t>(m_RequestMethod)], s_contentType[static_cast<uint32_t>(m_ContentType)]);
@@ -133,7 +260,9 @@ void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char
 	}
 #endif
 
-	if (m_Status != http::Status::OK) {
+	if (m_Status == http::Status::NOT_MODIFIED) {
+		pStatusMsg = "Not Modified";
+	} else if (m_Status != http::Status::OK) {
 		switch (m_Status) {
 		case http::Status::BAD_REQUEST:
 			pStatusMsg = "Bad Request";
@@ -161,8 +290,14 @@ void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char
 			break;
 		}
 
+		if (m_Status != http::Status::NOT_FOUND) {
+			m_IsConnectionClose = true;	// The rest of the segment cannot be trusted
+		}
+
 		m_ContentType = http::contentTypes::TEXT_HTML;
 		m_pContent = m_DynamicContent;
+		m_pContentGenerator = nullptr;
+		m_pETag = nullptr;
 		m_nContentSize = static_cast<uint32_t>(snprintf(m_DynamicContent, http::BUFSIZE - 1U,
 				"<!DOCTYPE html>\n"
 				"<html>\n"
@@ -171,22 +306,170 @@ void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char
 				"</html>\n", static_cast<unsigned int>(m_Status), pStatusMsg, pStatusMsg));
 	}
 
-	const auto nHeaderLength = snprintf(m_RequestHeaderResponse, http::BUFSIZE - 1U,
+	/*
+	 * The response header is not written in the request buffer, it can hold a pipelined request.
+	 */
+	auto nHeaderLength = static_cast<uint32_t>(snprintf(m_ResponseHeader, http::HEADER_BUFSIZE - 1U,
 			"HTTP/1.1 %u %s\r\n"
 			"Server: %s\r\n"
-			"Content-Type: %s\r\n"
-			"Content-Length: %u\r\n"
-			"Connection: close\r\n"
-			"\r\n", static_cast<unsigned int>(m_Status), pStatusMsg, Network::Get()->GetHostName(), s_contentType[static_cast<uint32_t>(m_ContentType)], static_cast<unsigned int>(m_nContentSize));
+			"Content-Type: %s\r\n", static_cast<unsigned int>(m_Status), pStatusMsg, Network::Get()->GetHostName(), s_contentType[static_cast<uint32_t>(m_ContentType)]));
+
+	if (m_IsConnectionClose) {
+		nHeaderLength += static_cast<uint32_t>(snprintf(&m_ResponseHeader[nHeaderLength], http::HEADER_BUFSIZE - 1U - nHeaderLength,
+				"Connection: close\r\n"));
+	} else {
+		nHeaderLength += static_cast<uint32_t>(snprintf(&m_ResponseHeader[nHeaderLength], http::HEADER_BUFSIZE - 1U - nHeaderLength,
+				"Connection: keep-alive\r\n"
+				"Keep-Alive: timeout=%u\r\n", static_cast<unsigned int>(http::KEEP_ALIVE_TIMEOUT)));
+	}
+
+	if (m_pContentGenerator != nullptr) {
+		nHeaderLength += static_cast<uint32_t>(snprintf(&m_ResponseHeader[nHeaderLength], http::HEADER_BUFSIZE - 1U - nHeaderLength,
+				"%s\r\n", m_IsHttp10 ? "" : "Transfer-Encoding: chunked\r\n"));
+	} else {
+		nHeaderLength += static_cast<uint32_t>(snprintf(&m_ResponseHeader[nHeaderLength], http::HEADER_BUFSIZE - 1U - nHeaderLength,
+				"Content-Length: %u\r\n", static_cast<unsigned int>(m_nContentSize)));
+
+		if (m_pETag != nullptr) {
+			nHeaderLength += static_cast<uint32_t>(snprintf(&m_ResponseHeader[nHeaderLength], http::HEADER_BUFSIZE - 1U - nHeaderLength,
+					"ETag: \"%s%s\"\r\n"
+					"Cache-Control: no-cache\r\n"
+					"Vary: Accept-Encoding\r\n"
+					"%s", m_pETag, m_IsContentGzip ? ".gz" : "", m_IsContentGzip ? "Content-Encoding: gzip\r\n" : ""));
+		}
+
+		nHeaderLength += static_cast<uint32_t>(snprintf(&m_ResponseHeader[nHeaderLength], http::HEADER_BUFSIZE - 1U - nHeaderLength,
+				"\r\n"));
+
+		DEBUG_PRINTF("m_nContentLength=%u", m_nContentSize);
+	}
+
+	m_pSend = reinterpret_cast<const uint8_t *>(m_ResponseHeader);
+	m_nSendLength = nHeaderLength;
+	m_Output = Output::HEADER;
+
+	if (Flush()) {
+		Finish();
+	}
+
+	DEBUG_EXIT
+}
+
+/**
+ * Writes the response as far as the TCP transmit queue takes it.
+ * A connection which can no longer send drops the rest of the response.
+ * @return true when the response is complete
+ */
+bool HttpDeamonHandleRequest::Flush() {
+	for (;;) {
+		if (m_nSendLength != 0) {
+			const auto nWritten = Network::Get()->TcpWrite(m_nHandle, m_pSend, m_nSendLength, m_nConnectionHandle);
+
+			m_pSend += nWritten;
+			m_nSendLength -= nWritten;
+
+			if (m_nSendLength != 0) {
+				net::tcp::Connection connection;
+				Network::Get()->TcpGetConnection(m_nHandle, m_nConnectionHandle, connection);
+
+				if (connection.isWritable) {
+					return false;
+				}
+
+				DEBUG_PUTS("Connection is closed, response dropped");
+				m_nSendLength = 0;
+				return true;
+			}
+		}
+
+		switch (m_Output) {
+		case Output::HEADER:
+			if (m_pContentGenerator != nullptr) {
+				m_nChunkCursor = 0;
+				m_IsLastChunk = false;
+				m_Output = Output::CHUNKS;
+			} else {
+				if (m_Status != http::Status::NOT_MODIFIED) {
+					m_pSend = reinterpret_cast<const uint8_t *>(m_pContent);
+					m_nSendLength = m_nContentSize;
+				}
+				m_Output = Output::BODY;
+			}
+			break;
+		case Output::CHUNKS:
+			if (!WriteChunk()) {
+				if (!m_IsHttp10) {
+					m_pSend = reinterpret_cast<const uint8_t *>("0\r\n\r\n");
+					m_nSendLength = 5;
+				}
+				m_Output = Output::LAST_CHUNK;
+			}
+			break;
+		default:
+			return true;
+		}
+	}
+}
+
+/**
+ * The response is complete, ready for the next request
+ */
+void HttpDeamonHandleRequest::Finish() {
+	if (m_IsConnectionClose) {
+		Network::Get()->TcpClose(m_nHandle, m_nConnectionHandle);
+	}
 
-	Network::Get()->TcpWrite(m_nHandle, reinterpret_cast<uint8_t *>(m_RequestHeaderResponse), nHeaderLength, m_nConnectionHandle);
-	Network::Get()->TcpWrite(m_nHandle, reinterpret_cast<const uint8_t *>(m_pContent), m_nContentSize, m_nConnectionHandle);
-	DEBUG_PRINTF("m_nContentLength=%u", m_nContentSize);
+	m_Output = Output::IDLE;
+	m_pContentGenerator = nullptr;
+	m_pETag = nullptr;
+	m_IsContentGzip = false;
 
 	m_Status = http::Status::UNKNOWN_ERROR;
 	m_RequestMethod = http::RequestMethod::UNKNOWN;
+}
 
-	DEBUG_EXIT
+/**
+ * Generates the next chunk in m_DynamicContent, the body is never in memory as a whole.
+ * The chunk size has a fixed width of 3 hex digits, leading zeros are allowed.
+ * For HTTP/1.0 the parts are sent without chunk framing.
+ * @return false after the last chunk
+ */
+bool HttpDeamonHandleRequest::WriteChunk() {
+	static constexpr uint32_t CHUNK_HEADER_SIZE = 5;	// "xxx\r\n"
+	static constexpr uint32_t CHUNK_TRAILER_SIZE = 2;	// "\r\n"
+	static_assert(http::BUFSIZE <= 0xFFF, "chunk size must fit in 3 hex digits");
+	static constexpr char HEX[] = "0123456789abcdef";
+
+	while (!m_IsLastChunk) {
+		const auto nLength = m_pContentGenerator(m_nChunkCursor, &m_DynamicContent[CHUNK_HEADER_SIZE], http::BUFSIZE - CHUNK_HEADER_SIZE - CHUNK_TRAILER_SIZE);
+
+		m_IsLastChunk = (m_nChunkCursor == 0);
+
+		if (nLength == 0) {
+			continue;	// A zero length chunk is the last chunk
+		}
+
+		if (m_IsHttp10) {
+			m_pSend = reinterpret_cast<const uint8_t *>(&m_DynamicContent[CHUNK_HEADER_SIZE]);
+			m_nSendLength = nLength;
+			return true;
+		}
+
+		m_DynamicContent[0] = HEX[(nLength >> 8) & 0xF];
+		m_DynamicContent[1] = HEX[(nLength >> 4) & 0xF];
+		m_DynamicContent[2] = HEX[nLength & 0xF];
+		m_DynamicContent[3] = '\r';
+		m_DynamicContent[4] = '\n';
+		m_DynamicContent[CHUNK_HEADER_SIZE + nLength] = '\r';
+		m_DynamicContent[CHUNK_HEADER_SIZE + nLength + 1] = '\n';
+
+		m_pSend = reinterpret_cast<const uint8_t *>(m_DynamicContent);
+		m_nSendLength = CHUNK_HEADER_SIZE + nLength + CHUNK_TRAILER_SIZE;
+
+		return true;
+	}
+
+	return false;
 }
 
 http::Status HttpDeamonHandleRequest::ParseRequest() {
@@ -196,6 +479,10 @@ http::Status HttpDeamonHandleRequest::ParseRequest() {
 	m_ContentType = http::contentTypes::NOT_DEFINED;
 	m_nRequestContentSize = 0;
 	m_nFileDataLength = 0;
+	m_pIfNoneMatch = nullptr;
+	m_IsAcceptGzip = false;
+	m_IsConnectionClose = false;
+	m_IsHttp10 = false;
 
 	for (uint32_t i = 0; i < m_nBytesReceived; i++) {
 		if (m_RequestHeaderResponse[i] == '\n') {
@@ -208,7 +495,12 @@ http::Status HttpDeamonHandleRequest::ParseRequest() {
 				if (pLine[0] == '\0') {
 					assert((i + 1) <= m_nBytesReceived);
 					m_nFileDataLength = static_cast<uint16_t>(m_nBytesReceived - 1 - i);
-					if (m_nFileDataLength > 0) {
+					if ((m_nFileDataLength > 0) && (m_RequestMethod == http::RequestMethod::GET)) {
+						// A GET request has no body, this is the next request
+						m_pPipelined = &m_RequestHeaderResponse[i + 1];
+						m_nPipelinedLength = m_nFileDataLength;
+						m_nFileDataLength = 0;
+					} else if (m_nFileDataLength > 0) {
 						m_pFileData = &m_RequestHeaderResponse[i + 1];
 						m_pFileData[m_nFileDataLength] = '\0';
 					}
@@ -228,93 +520,164 @@ http::Status HttpDeamonHandleRequest::ParseRequest() {
 	return http::Status::OK;
 }
 
+static http::uri::Id uri_lookup(const char *pUri, const uint32_t nLength, const uint32_t nHash) {
+	const auto& entry = http::uri::TABLE[http::hash_index(nHash, http::uri::MASK)];
+
+	if ((entry.nLength == nLength) && (nLength != 0) && (memcmp(entry.pName, pUri, nLength) == 0)) {
+		return static_cast<http::uri::Id>(entry.nId);
+	}
+
+	return http::uri::Id::UNKNOWN;
+}
+
+static http::header::Id header_lookup(const char *pName, const uint32_t nLength, const uint32_t nHash) {
+	const auto& entry = http::header::TABLE[http::hash_index(nHash, http::header::MASK)];
+
+	if ((entry.nLength == nLength) && (nLength != 0) && (strncasecmp(entry.pName, pName, nLength) == 0)) {
+		return static_cast<http::header::Id>(entry.nId);
+	}
+
+	return http::header::Id::UNKNOWN;
+}
+
+/**
+ * The value is followed by the end of the line, a parameter or white space
+ */
+static bool is_value(const char *pValue, const char *pExpected, const uint32_t nLength) {
+	if (strncmp(pValue, pExpected, nLength) != 0) {
+		return false;
+	}
+
+	return (pValue[nLength] == '\0') || (pValue[nLength] == ';') || (pValue[nLength] == ' ');
+}
+
 /**
- * Supported: "METHOD uri HTTP/1.1"
+ * Supported: "METHOD uri[?query] HTTP/1.1"
  * Where METHOD is "GET", "POST" or "DELETE"
+ * The uri is hashed while it is scanned, the route is found with a single table lookup.
  */
 
 http::Status HttpDeamonHandleRequest::ParseMethod(char *pLine) {
 	assert(pLine != nullptr);
-	char *pToken;
-
-	if ((pToken = strtok(pLine, " ")) == nullptr) {
-		return http::Status::METHOD_NOT_IMPLEMENTED;
-	}
+	auto *p = pLine;
 
-	if (strcmp(pToken, "GET") == 0) {
+	if (strncmp(p, "GET ", 4) == 0) {
 		m_RequestMethod = http::RequestMethod::GET;
-	} else if (strcmp(pToken, "POST") == 0) {
+		p += 4;
+	} else if (strncmp(p, "POST ", 5) == 0) {
 		m_RequestMethod = http::RequestMethod::POST;
+		p += 5;
 	}
 #if defined (ENABLE_METHOD_DELETE)
-	else if (strcmp(pToken, "DELETE") == 0) {
+	else if (strncmp(p, "DELETE ", 7) == 0) {
 		m_RequestMethod = http::RequestMethod::DELETE;
+		p += 7;
 	}
 #endif
 	else {
 		return http::Status::METHOD_NOT_IMPLEMENTED;
 	}
 
-	if ((pToken = strtok(nullptr, " ")) == nullptr) {
-		return http::Status::BAD_REQUEST;
+	m_pUri = p;
+	m_pQuery = nullptr;
+
+	auto nHash = http::uri::SEED;
+
+	while ((*p != ' ') && (*p != '?') && (*p != '\0')) {
+		nHash = http::hash_step(nHash, static_cast<uint8_t>(*p++));
 	}
 
-	m_pUri = pToken;
+	const auto nUriLength = static_cast<uint32_t>(p - m_pUri);
 
-	if ((pToken = strtok(nullptr, "/")) == nullptr || strcmp(pToken, "HTTP") != 0) {
+	if (*p == '?') {
+		*p++ = '\0';
+		m_pQuery = p;
+
+		while ((*p != ' ') && (*p != '\0')) {
+			p++;
+		}
+	}
+
+	if ((nUriLength == 0) || (*p != ' ')) {
 		return http::Status::BAD_REQUEST;
 	}
 
-	if ((pToken = strtok(nullptr, " \n")) == nullptr) {
+	*p++ = '\0';
+
+	m_UriId = uri_lookup(m_pUri, nUriLength, nHash);
+
+	if (strncmp(p, "HTTP/", 5) != 0) {
 		return http::Status::BAD_REQUEST;
 	}
 
-	if (strcmp(pToken, "1.1") != 0) {
-		return http::Status::VERSION_NOT_SUPPORTED;
+	if (strcmp(&p[5], "1.1") == 0) {
+		return http::Status::OK;
 	}
 
-	return http::Status::OK;
+	/*
+	 * An HTTP/1.0 client does not know chunked encoding, a generated body
+	 * is delimited by closing the connection.
+	 */
+	if (strcmp(&p[5], "1.0") == 0) {
+		m_IsHttp10 = true;
+		m_IsConnectionClose = true;
+		return http::Status::OK;
+	}
+
+	return http::Status::VERSION_NOT_SUPPORTED;
 }
 
 /**
- * Only interested in "Content-Type" and "Content-Length"
+ * Only interested in "Content-Type", "Content-Length", "Accept-Encoding", "If-None-Match" and "Connection"
  * Where we check for "Content-Type: application/json" and "Content-Type: application/octet-stream"
+ * The field name is hashed while it is scanned, other fields are skipped after a single table lookup.
  */
 
 http::Status HttpDeamonHandleRequest::ParseHeaderField(char *pLine) {
 	DEBUG_ENTRY
-	char *pToken;
-
 	assert(pLine != nullptr);
 
-	if ((pToken = strtok(pLine, ":")) == nullptr) {
-		return http::Status::BAD_REQUEST;
+	auto *p = pLine;
+	auto nHash = http::header::SEED;
+
+	while ((*p != ':') && (*p != '\0')) {
+		nHash = http::hash_step(nHash, static_cast<uint8_t>(*p++ | 0x20));
 	}
 
-	if (strcasecmp(pToken, "Content-Type") == 0) {
-		if ((pToken = strtok(nullptr, " ;")) == nullptr) {
+	if (*p != ':') {
+		DEBUG_EXIT
+		return http::Status::OK;
+	}
+
+	const auto nNameLength = static_cast<uint32_t>(p - pLine);
+
+	p++;
+
+	while (*p == ' ') {
+		p++;
+	}
+
+	switch (header_lookup(pLine, nNameLength, nHash)) {
+	case http::header::Id::CONTENT_TYPE:
+		if (*p == '\0') {
 			return http::Status::BAD_REQUEST;
 		}
-		if (memcmp(pToken, "application/", 12) == 0) {
-			if (strcmp(&pToken[12], "json") == 0) {
+		if (strncmp(p, "application/", 12) == 0) {
+			if (is_value(&p[12], "json", 4)) {
 				m_ContentType = http::contentTypes::APPLICATION_JSON;
-				DEBUG_ENTRY
-				return http::Status::OK;
-			}
-			if (strcmp(&pToken[12], "octet-stream") == 0) {
+			} else if (is_value(&p[12], "octet-stream", 12)) {
 				m_ContentType = http::contentTypes::APPLICATION_OCTET_STREAM;
-				DEBUG_ENTRY
-				return http::Status::OK;
 			}
 		}
-	} else if (strcasecmp(pToken, "Content-Length") == 0) {
-		if ((pToken = strtok(nullptr, " ")) == nullptr) {
+		break;
+	case http::header::Id::CONTENT_LENGTH: {
+		if (*p == '\0') {
 			return http::Status::BAD_REQUEST;
 		}
 
 		uint32_t nTmp = 0;
-		while (*pToken != '\0') {
-			auto nDigit = static_cast<uint32_t>(*pToken++ - '0');
+		while ((*p != '\0') && (*p != ' ')) {
+			auto nDigit = static_cast<uint32_t>(*p++ - '0');
 			if (nDigit > 9) {
 				return http::Status::BAD_REQUEST;
 			}
@@ -325,6 +688,33 @@ http::Status HttpDeamonHandleRequest::ParseHeaderField(char *pLine) {
 
 		m_nRequestContentSize = nTmp;
 	}
+		break;
+	case http::header::Id::ACCEPT_ENCODING:
+		m_IsAcceptGzip = (strstr(p, "gzip") != nullptr);
+		break;
+	case http::header::Id::IF_NONE_MATCH:
+		m_pIfNoneMatch = p;
+		break;
+	case http::header::Id::CONNECTION:
+		while (*p != '\0') {
+			while ((*p == ' ') || (*p == ',')) {
+				p++;
+			}
+
+			const auto *pToken = p;
+
+			while ((*p != '\0') && (*p != ' ') && (*p != ',')) {
+				p++;
+			}
+
+			if (((p - pToken) == 5) && (strncasecmp(pToken, "close", 5) == 0)) {
+				m_IsConnectionClose = true;
+			}
+		}
+		break;
+	default:
+		break;
+	}
 
 	DEBUG_EXIT
 	return http::Status::OK;
@@ -339,209 +729,178 @@ http::Status HttpDeamonHandleRequest::HandleGet() {
 
 	uint32_t nLength = 0;
 	m_pContent = &m_DynamicContent[0];
+	m_ContentType = http::contentTypes::APPLICATION_JSON;
+#if defined (ENABLE_CONTENT)
+	const char *pFileName = nullptr;
+#endif
 
-	if (memcmp(m_pUri, "/json/", 6) == 0) {
-		m_ContentType = http::contentTypes::APPLICATION_JSON;
-		const auto *pGet = &m_pUri[6];
-		switch (http::get_uint(pGet)) {
-		case http::json::get::LIST:
-			nLength = remoteconfig::json_get_list(m_DynamicContent, sizeof(m_DynamicContent));
-			break;
-		case http::json::get::VERSION:
-			nLength = remoteconfig::json_get_version(m_DynamicContent, sizeof(m_DynamicContent));
-			break;
-		case http::json::get::UPTIME:
-			if (!RemoteConfig::Get()->IsEnableUptime()) {
-				DEBUG_PUTS("Status::BAD_REQUEST");
-				return http::Status::BAD_REQUEST;
-			}
-			nLength = remoteconfig::json_get_uptime(m_DynamicContent, sizeof(m_DynamicContent));
-			break;
-		case http::json::get::DISPLAY:
-			nLength = remoteconfig::json_get_display(m_DynamicContent, sizeof(m_DynamicContent));
-			break;
-		case http::json::get::DIRECTORY:
-			nLength = remoteconfig::json_get_directory(m_DynamicContent, sizeof(m_DynamicContent));
-			break;
-		case http::json::get::TIMEDATE:
-			nLength = remoteconfig::timedate::json_get_timeofday(m_DynamicContent, sizeof(m_DynamicContent));
-			break;
+	switch (m_UriId) {
+	case http::uri::Id::JSON_LIST:
+		nLength = remoteconfig::json_get_list(m_DynamicContent, sizeof(m_DynamicContent));
+		break;
+	case http::uri::Id::JSON_VERSION:
+		nLength = remoteconfig::json_get_version(m_DynamicContent, sizeof(m_DynamicContent));
+		break;
+	case http::uri::Id::JSON_UPTIME:
+		if (!RemoteConfig::Get()->IsEnableUptime()) {
+			DEBUG_PUTS("Status::BAD_REQUEST");
+			return http::Status::BAD_REQUEST;
+		}
+		nLength = remoteconfig::json_get_uptime(m_DynamicContent, sizeof(m_DynamicContent));
+		break;
+	case http::uri::Id::JSON_DISPLAY:
+		nLength = remoteconfig::json_get_display(m_DynamicContent, sizeof(m_DynamicContent));
+		break;
+	case http::uri::Id::JSON_DIRECTORY:
+		nLength = remoteconfig::json_get_directory(m_DynamicContent, sizeof(m_DynamicContent));
+		break;
+	case http::uri::Id::JSON_TIMEDATE:
+		nLength = remoteconfig::timedate::json_get_timeofday(m_DynamicContent, sizeof(m_DynamicContent));
+		break;
 #if !defined (DISABLE_RTC)
-		case http::json::get::RTCALARM:
-			nLength = remoteconfig::rtc::json_get_rtc(m_DynamicContent, sizeof(m_DynamicContent));
-			break;
-#endif
-#if defined (RDM_CONTROLLER) && !defined (CONFIG_HTTP_HTML_NO_RDM)
-		case http::json::get::RDM:
-			nLength = remoteconfig::rdm::json_get_rdm(m_DynamicContent, sizeof(m_DynamicContent));
-			break;
+	case http::uri::Id::JSON_RTCALARM:
+		nLength = remoteconfig::rtc::json_get_rtc(m_DynamicContent, sizeof(m_DynamicContent));
+		break;
 #endif
+	case http::uri::Id::JSON_HTTPSTATS:
+		nLength = json_get_httpstats(m_DynamicContent, sizeof(m_DynamicContent));
+		break;
 #if defined (ARTNET_CONTROLLER)
-		case http::json::get::POLLTABLE:
-			nLength = remoteconfig::artnet::controller::json_get_polltable(m_DynamicContent, sizeof(m_DynamicContent));
-			break;
+	case http::uri::Id::JSON_POLLTABLE:
+		m_pContentGenerator = remoteconfig::artnet::controller::json_get_polltable;
+		break;
 #endif
 #if defined (ENABLE_NET_PHYSTATUS)
-		case http::json::get::PHYSTATUS:
-			nLength = remoteconfig::net::json_get_phystatus(m_DynamicContent, sizeof(m_DynamicContent));
-			break;
+	case http::uri::Id::JSON_PHYSTATUS:
+		nLength = remoteconfig::net::json_get_phystatus(m_DynamicContent, sizeof(m_DynamicContent));
+		break;
+	case http::uri::Id::JSON_NETSTATS:
+		nLength = remoteconfig::net::json_get_netstats(m_DynamicContent, sizeof(m_DynamicContent));
+		break;
 #endif
-		default:
 #if defined (HAVE_DMX)
-			if (memcmp(pGet, "dmx/", 4) == 0) {
-				const auto *pDmx = &pGet[4];
-				const bool isQuestionMark = (pDmx[6] == '?'); // Handle /dmx/status?X
-				if (isQuestionMark) {
-					auto *p = const_cast<char *>(pDmx);
-					p[6] = '\0';
-				}
-				DEBUG_PRINTF("pDmx=[%s]", pDmx);
-				switch (http::get_uint(pDmx)) {
-				case http::json::get::PORTSTATUS:
-					nLength = remoteconfig::dmx::json_get_ports(m_DynamicContent, sizeof(m_DynamicContent));
-					break;
-				case http::json::get::STATUS: {
-					const auto *pStatus = &pDmx[7];
-					if (isQuestionMark && isalpha(static_cast<int>(pStatus[0])))  {
-						nLength = remoteconfig::dmx::json_get_portstatus(pStatus[0], m_DynamicContent, sizeof(m_DynamicContent));
-					}
-				}
-				default:
-					break;
-				}
-			} else
+	case http::uri::Id::JSON_DMX_PORTSTATUS:
+		nLength = remoteconfig::dmx::json_get_ports(m_DynamicContent, sizeof(m_DynamicContent));
+		break;
+	case http::uri::Id::JSON_DMX_STATUS:	// Handle /json/dmx/status?X
+		if ((m_pQuery != nullptr) && isalpha(static_cast<int>(m_pQuery[0]))) {
+			nLength = remoteconfig::dmx::json_get_portstatus(m_pQuery[0], m_DynamicContent, sizeof(m_DynamicContent));
+		}
+		break;
 #endif
 #if defined (HAVE_PIXEL)
-				if (memcmp(pGet, "pixel/", 6) == 0) {
-					const auto *pPixel = &pGet[6];
-					switch (http::get_uint(pPixel)) {
-					case http::json::get::TYPES:
-						nLength = remoteconfig::pixel::json_get_types(m_DynamicContent, sizeof(m_DynamicContent));
-						break;
-					case http::json::get::STATUS:
-						nLength = remoteconfig::pixel::json_get_status(m_DynamicContent, sizeof(m_DynamicContent));
-						break;
-					default:
-						break;
-					}
-				} else
+	case http::uri::Id::JSON_PIXEL_TYPES:
+		nLength = remoteconfig::pixel::json_get_types(m_DynamicContent, sizeof(m_DynamicContent));
+		break;
+	case http::uri::Id::JSON_PIXEL_STATUS:
+		nLength = remoteconfig::pixel::json_get_status(m_DynamicContent, sizeof(m_DynamicContent));
+		break;
 #endif
 #if defined (RDM_CONTROLLER) && !defined (CONFIG_HTTP_HTML_NO_RDM)
-					if (memcmp(pGet, "rdm/", 4) == 0) {
-						const auto *pRdm = &pGet[4];
-						const bool isQuestionMark = (pRdm[3] == '?'); // Handle /rdm/tod?X
-						if (isQuestionMark) {
-							auto *p = const_cast<char *>(pRdm);
-							p[3] = '\0';
-						}
-						switch (http::get_uint(pRdm)) {
-						case http::json::get::QUEUE:
-							nLength = remoteconfig::rdm::json_get_queue(m_DynamicContent, sizeof(m_DynamicContent));
-							break;
-						case http::json::get::PORTSTATUS:
-							nLength = remoteconfig::rdm::json_get_portstatus(m_DynamicContent, sizeof(m_DynamicContent));
-							break;
-						case http::json::get::TOD: {
-							const auto *pTod = &pRdm[4];
-							if (isQuestionMark && isalpha(static_cast<int>(pTod[0])))  {
-								nLength = remoteconfig::rdm::json_get_tod(pTod[0], m_DynamicContent, sizeof(m_DynamicContent));
-							}
-						}
-						break;
-						default:
-							break;
-						}
-					} else
+	case http::uri::Id::JSON_RDM:
+		nLength = remoteconfig::rdm::json_get_rdm(m_DynamicContent, sizeof(m_DynamicContent));
+		break;
+	case http::uri::Id::JSON_RDM_QUEUE:
+		nLength = remoteconfig::rdm::json_get_queue(m_DynamicContent, sizeof(m_DynamicContent));
+		break;
+	case http::uri::Id::JSON_RDM_PORTSTATUS:
+		nLength = remoteconfig::rdm::json_get_portstatus(m_DynamicContent, sizeof(m_DynamicContent));
+		break;
+	case http::uri::Id::JSON_RDM_TOD:	// Handle /json/rdm/tod?X
+		if ((m_pQuery != nullptr) && isalpha(static_cast<int>(m_pQuery[0])) && (static_cast<uint32_t>((m_pQuery[0] | 0x20) - 'a') < artnetnode::MAX_PORTS))  {
+			s_cTodPort = m_pQuery[0];
+			m_pContentGenerator = get_tod;
+		}
+		break;
 #endif
 #if !defined(DISABLE_FS) || defined (CONFIG_USB_HOST_MSC)
-						if (memcmp(pGet, "storage/", 8) == 0) {
-							const auto *pStorage = &pGet[8];
-							switch (http::get_uint(pStorage)) {
-							case http::json::get::DIRECTORY:
-								nLength = remoteconfig::storage::json_get_directory(m_DynamicContent, sizeof(m_DynamicContent));
-								break;
-							default:
-								break;
-							}
-						} else
+	case http::uri::Id::JSON_STORAGE_DIRECTORY:
+		m_pContentGenerator = remoteconfig::storage::json_get_directory;
+		break;
 #endif
 #if defined (ENABLE_PHY_SWITCH)
-							if (memcmp(pGet, "dsa/", 4) == 0) {
-								const auto *pDsa = &pGet[4];
-								switch (http::get_uint(pDsa)) {
-								case http::json::get::PORTSTATUS:
-									nLength = remoteconfig::dsa::json_get_portstatus(m_DynamicContent, sizeof(m_DynamicContent));
-									break;
-								case http::json::get::VLANTABLE:
-									nLength = remoteconfig::dsa::json_get_vlantable(m_DynamicContent, sizeof(m_DynamicContent));
-									break;
-								default:
-									break;
-								}
-							} else
+	case http::uri::Id::JSON_DSA_PORTSTATUS:
+		nLength = remoteconfig::dsa::json_get_portstatus(m_DynamicContent, sizeof(m_DynamicContent));
+		break;
+	case http::uri::Id::JSON_DSA_VLANTABLE:
+		nLength = remoteconfig::dsa::json_get_vlantable(m_DynamicContent, sizeof(m_DynamicContent));
+		break;
 #endif
 #if defined (NODE_SHOWFILE)
-								if (memcmp(pGet, "showfile/", 9) == 0) {
-									const auto *pShowfile = &pGet[9];
-									switch (http::get_uint(pShowfile)) {
-									case http::json::get::STATUS:
-										nLength = remoteconfig::showfile::json_get_status(m_DynamicContent, sizeof(m_DynamicContent));
-										break;
-									case http::json::get::DIRECTORY:
-										nLength = remoteconfig::showfile::json_get_directory(m_DynamicContent, sizeof(m_DynamicContent));
-										break;
-									default:
-										break;
-									}
-								} else
+	case http::uri::Id::JSON_SHOWFILE_STATUS:
+		nLength = remoteconfig::showfile::json_get_status(m_DynamicContent, sizeof(m_DynamicContent));
+		break;
+	case http::uri::Id::JSON_SHOWFILE_DIRECTORY:
+		nLength = remoteconfig::showfile::json_get_directory(m_DynamicContent, sizeof(m_DynamicContent));
+		break;
 #endif
-								{
-									return HandleGetTxt();
-
-								}
-			break;
-		}
-	}
 #if defined (ENABLE_CONTENT)
-	else if (strcmp(m_pUri, "/") == 0) {
-		m_pContent = get_file_content("index.html", nLength, m_ContentType);
-	}
-#if defined (HAVE_DMX)
-	else if (strcmp(m_pUri, "/dmx") == 0) {
-		m_pContent = get_file_content("dmx.html", nLength, m_ContentType);
-	}
-#endif
-#if defined (RDM_CONTROLLER) && !defined (CONFIG_HTTP_HTML_NO_RDM)
-	else if (strcmp(m_pUri, "/rdm") == 0) {
-		m_pContent = get_file_content("rdm.html", nLength, m_ContentType);
-	}
-#endif
-#if defined (NODE_SHOWFILE)
-	else if (strcmp(m_pUri, "/showfile") == 0) {
-		m_pContent = get_file_content("showfile.html", nLength, m_ContentType);
-	}
-#endif
-#if defined (ENABLE_PHY_SWITCH)
-	else if (strcmp(m_pUri, "/dsa") == 0) {
-		m_pContent = get_file_content("dsa.html", nLength, m_ContentType);
-	}
+	case http::uri::Id::INDEX:
+		pFileName = "index.html";
+		break;
+# if defined (HAVE_DMX)
+	case http::uri::Id::DMX:
+		pFileName = "dmx.html";
+		break;
+# endif
+# if defined (RDM_CONTROLLER) && !defined (CONFIG_HTTP_HTML_NO_RDM)
+	case http::uri::Id::RDM:
+		pFileName = "rdm.html";
+		break;
+# endif
+# if defined (NODE_SHOWFILE)
+	case http::uri::Id::SHOWFILE:
+		pFileName = "showfile.html";
+		break;
+# endif
+# if defined (ENABLE_PHY_SWITCH)
+	case http::uri::Id::DSA:
+		pFileName = "dsa.html";
+		break;
+# endif
+# if !defined (CONFIG_HTTP_HTML_NO_TIME)
+	case http::uri::Id::TIME:
+		pFileName = "time.html";
+		break;
+# endif
+# if !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC)
+	case http::uri::Id::RTC:
+		pFileName = "rtc.html";
+		break;
+# endif
 #endif
-#if !defined (CONFIG_HTTP_HTML_NO_TIME)
-	else if (strcmp(m_pUri, "/time") == 0) {
-		m_pContent = get_file_content("time.html", nLength, m_ContentType);
-	}
+	default:
+		if (memcmp(m_pUri, "/json/", 6) == 0) {
+			return HandleGetTxt();
+		}
+#if defined (ENABLE_CONTENT)
+		pFileName = &m_pUri[1];
 #endif
-#if !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC)
-	else if (strcmp(m_pUri, "/rtc") == 0) {
-		m_pContent = get_file_content("rtc.html", nLength, m_ContentType);
+		break;
 	}
-#endif
-	else {
-		m_pContent = get_file_content(&m_pUri[1], nLength, m_ContentType);
+
+#if defined (ENABLE_CONTENT)
+	if (pFileName != nullptr) {
+# if defined (CONFIG_HTTP_CONTENT_FS)
+		if (get_file_content_open(pFileName, m_ContentType)) {
+			m_pContentGenerator = get_file_content_read;
+		}
+# else
+		auto isGzip = m_IsAcceptGzip;
+		m_pContent = get_file_content(pFileName, nLength, m_ContentType, m_pETag, isGzip);
+		m_IsContentGzip = isGzip;
+
+		if ((nLength != 0) && IsNoneMatchFailed()) {
+			DEBUG_PUTS("Not Modified");
+			m_nContentSize = nLength;
+			DEBUG_EXIT
+			return http::Status::NOT_MODIFIED;
+		}
+# endif
 	}
 #endif
 
-	if (nLength == 0) {
+	if ((nLength == 0) && (m_pContentGenerator == nullptr)) {
 		DEBUG_EXIT
 		return http::Status::NOT_FOUND;
 	}
@@ -552,6 +911,60 @@ http::Status HttpDeamonHandleRequest::HandleGet() {
 	return http::Status::OK;
 }
 
+/**
+ * If-None-Match: "*" or a comma separated list of entity-tags.
+ * Weak comparison, a W/ prefix is ignored. The tag served is "<etag>" or "<etag>.gz".
+ * @return true when a listed tag matches the representation served
+ */
+bool HttpDeamonHandleRequest::IsNoneMatchFailed() const {
+	if ((m_pIfNoneMatch == nullptr) || (m_pETag == nullptr)) {
+		return false;
+	}
+
+	const auto nETagLength = strlen(m_pETag);
+	const auto *p = m_pIfNoneMatch;
+
+	while (*p != '\0') {
+		while ((*p == ' ') || (*p == '\t') || (*p == ',')) {
+			p++;
+		}
+
+		if (*p == '*') {
+			return true;
+		}
+
+		if ((p[0] == 'W') && (p[1] == '/')) {
+			p += 2;
+		}
+
+		if (*p != '"') {
+			return false;	// Malformed, the precondition is ignored
+		}
+
+		const auto *pTag = ++p;
+
+		while ((*p != '\0') && (*p != '"')) {
+			p++;
+		}
+
+		if (*p != '"') {
+			return false;
+		}
+
+		const auto nTagLength = static_cast<size_t>(p - pTag);
+
+		if ((nTagLength == nETagLength + (m_IsContentGzip ? 3 : 0))
+				&& (strncmp(pTag, m_pETag, nETagLength) == 0)
+				&& (!m_IsContentGzip || (strncmp(&pTag[nETagLength], ".gz", 3) == 0))) {
+			return true;
+		}
+
+		p++;
+	}
+
+	return false;
+}
+
 http::Status HttpDeamonHandleRequest::HandleGetTxt() {
 	auto *pFileName = &m_pUri[6];
 	const auto nLength = strlen(pFileName);
@@ -589,9 +1002,9 @@ http::Status HttpDeamonHandleRequest::HandlePost(const bool hasDataOnly) {
 			return http::Status::BAD_REQUEST;
 		}
 
-		m_IsAction = (strcmp(m_pUri, "/json/action") == 0);
+		m_IsAction = (m_UriId == http::uri::Id::JSON_ACTION);
 
-		if (!m_IsAction && (strcmp(m_pUri, "/json") != 0)) {
+		if (!m_IsAction && (m_UriId != http::uri::Id::JSON)) {
 			DEBUG_EXIT
 			return http::Status::NOT_FOUND;
 		}
@@ -700,7 +1113,7 @@ http::Status HttpDeamonHandleRequest::HandleDelete(const bool hasDataOnly) {
 			return http::Status::BAD_REQUEST;
 		}
 
-		m_IsAction = (strcmp(m_pUri, "/json/action") == 0);
+		m_IsAction = (m_UriId == http::uri::Id::JSON_ACTION);
 
 		if (!m_IsAction) {
 			DEBUG_EXIT
@@ -31,7 +31,7 @@
 
 #include "debug.h"
 
-TFTPFileServer::TFTPFileServer(uint8_t *pBuffer, uint32_t nSize): m_pBuffer(pBuffer), m_nSize(nSize) {
+TFTPFileServer::TFTPFileServer() {
 	DEBUG_ENTRY
 	DEBUG_EXIT
 }
@@ -52,6 +52,8 @@
 
 #include "configstore.h"
 
+#include "../udp/udp_switch.h"
+
 /* rconfig.txt */
 #include "remoteconfigparams.h"
 /* env.txt */
@@ -244,6 +246,12 @@ RemoteConfig *RemoteConfig::s_pThis;
 RemoteConfig::ListBin RemoteConfig::s_RemoteConfigListBin;
 char *RemoteConfig::s_pUdpBuffer;
 
+/*
+ * Slot -> index in s_GET[] / s_SET[], -1 is an empty slot.
+ */
+static int8_t s_GetSlot[remoteconfig::udp::get::MASK + 1];
+static int8_t s_SetSlot[remoteconfig::udp::set::MASK + 1];
+
 RemoteConfig::RemoteConfig(const remoteconfig::Node node, const remoteconfig::Output output, const uint32_t nActiveOutputs):
 	m_tNode(node),
 	m_tOutput(output),
@@ -263,6 +271,12 @@ RemoteConfig::RemoteConfig(const remoteconfig::Node node, const remoteconfig::Ou
 	s_RemoteConfigListBin.nActiveOutputs = static_cast<uint8_t>(nActiveOutputs);
 	s_RemoteConfigListBin.aDisplayName[0] = '\0';
 
+	CommandsHashInit(s_GET, sizeof(s_GET) / sizeof(s_GET[0]), s_GetSlot, remoteconfig::udp::get::SEED, remoteconfig::udp::get::MASK);
+	CommandsHashInit(s_SET, sizeof(s_SET) / sizeof(s_SET[0]), s_SetSlot, remoteconfig::udp::set::SEED, remoteconfig::udp::set::MASK);
+#if !defined (CONFIG_REMOTECONFIG_MINIMUM)
+	TxtHashInit();
+#endif
+
 	m_nHandle = Network::Get()->Begin(remoteconfig::udp::PORT);
 	assert(m_nHandle != -1);
 
@@ -346,6 +360,44 @@ void RemoteConfig::SetDisplayName(const char *pDisplayName) {
 	DEBUG_EXIT
 }
 
+/*
+ * The command word, up to the first '#', is hashed with the seed generated for the full set
+ * of commands (udp/udp_switch.h). The slots are filled with the commands of this build.
+ */
+void RemoteConfig::CommandsHashInit(const Commands *pCommands, const uint32_t nCommands, int8_t *pSlots, const uint32_t nSeed, const uint32_t nMask) {
+	memset(pSlots, -1, nMask + 1);
+
+	for (uint32_t i = 0; i < nCommands; i++) {
+		auto nHash = nSeed;
+		const auto isKey = remoteconfig::udp::hash_key(pCommands[i].pCmd, pCommands[i].nLength, '#', nHash);
+		assert(isKey);
+		const auto nSlot = remoteconfig::udp::hash_index(nHash, nMask);
+		assert(pSlots[nSlot] < 0);	// udp_switch.h is out of date
+		if (isKey && (pSlots[nSlot] < 0)) {
+			pSlots[nSlot] = static_cast<int8_t>(i);
+		}
+	}
+}
+
+/*
+ * Returns the only candidate, the caller checks the length and the full command.
+ */
+const RemoteConfig::Commands *RemoteConfig::CommandsLookup(const Commands *pCommands, const int8_t *pSlots, const uint32_t nSeed, const uint32_t nMask, const uint32_t nMaxLength) const {
+	auto nHash = nSeed;
+
+	if (!remoteconfig::udp::hash_key(&s_pUdpBuffer[1], std::min(m_nBytesReceived, nMaxLength + 1), '#', nHash)) {
+		return nullptr;
+	}
+
+	const auto nIndex = pSlots[remoteconfig::udp::hash_index(nHash, nMask)];
+
+	if (nIndex < 0) {
+		return nullptr;
+	}
+
+	return &pCommands[nIndex];
+}
+
 void RemoteConfig::HandleRequest() {
 #ifndef NDEBUG
 	debug_dump(s_pUdpBuffer, static_cast<uint16_t>(m_nBytesReceived));
@@ -355,24 +407,13 @@ void RemoteConfig::HandleRequest() {
 		m_nBytesReceived--;
 	}
 
-	const Commands *pHandler = nullptr;
-
 	if (s_pUdpBuffer[0] == '?') {
 		m_nBytesReceived--;
-		for (uint32_t i = 0; i < (sizeof(s_GET) / sizeof(s_GET[0])); i++) {
-			if ((s_GET[i].bGreaterThan) && (m_nBytesReceived <= s_GET[i].nLength)) {
-				continue;
-			}
-			if ((!s_GET[i].bGreaterThan) && (m_nBytesReceived != s_GET[i].nLength)) {
-				continue;
-			}
-			if (memcmp(&s_pUdpBuffer[1], s_GET[i].pCmd, s_GET[i].nLength) == 0) {
-				pHandler = &s_GET[i];
-				break;
-			}
-		}
+		const auto *pHandler = CommandsLookup(s_GET, s_GetSlot, remoteconfig::udp::get::SEED, remoteconfig::udp::get::MASK, remoteconfig::udp::get::MAX_LENGTH);
 
-		if (pHandler != nullptr) {
+		if ((pHandler != nullptr)
+				&& (pHandler->bGreaterThan ? (m_nBytesReceived > pHandler->nLength) : (m_nBytesReceived == pHandler->nLength))
+				&& (memcmp(&s_pUdpBuffer[1], pHandler->pCmd, pHandler->nLength) == 0)) {
 			(this->*(pHandler->pHandler))();
 			return;
 		}
@@ -389,20 +430,11 @@ void RemoteConfig::HandleRequest() {
 			return;
 		} else if (s_pUdpBuffer[0] == '!') {
 			m_nBytesReceived--;
-			for (uint32_t i = 0; i < (sizeof(s_SET) / sizeof(s_SET[0])); i++) {
-				if ((s_SET[i].bGreaterThan) && (m_nBytesReceived <= s_SET[i].nLength)) {
-					continue;
-				}
-				if ((!s_SET[i].bGreaterThan) && ((m_nBytesReceived - 1U) != s_SET[i].nLength)) {
-					continue;
-				}
-				if (memcmp(&s_pUdpBuffer[1], s_SET[i].pCmd, s_SET[i].nLength) == 0) {
-					pHandler = &s_SET[i];
-					break;
-				}
-			}
+			const auto *pHandler = CommandsLookup(s_SET, s_SetSlot, remoteconfig::udp::set::SEED, remoteconfig::udp::set::MASK, remoteconfig::udp::set::MAX_LENGTH);
 
-			if (pHandler != nullptr) {
+			if ((pHandler != nullptr)
+					&& (pHandler->bGreaterThan ? (m_nBytesReceived > pHandler->nLength) : ((m_nBytesReceived - 1U) == pHandler->nLength))
+					&& (memcmp(&s_pUdpBuffer[1], pHandler->pCmd, pHandler->nLength) == 0)) {
 				(this->*(pHandler->pHandler))();
 				return;
 			}
@@ -48,6 +48,12 @@ void RemoteConfig::HandleReboot() {
 
 	Display::Get()->SetSleep(false);
 
+#if defined (ENABLE_TFTP_SERVER)
+	if (FlashCodeInstall::Get() != nullptr) {
+		FlashCodeInstall::Get()->FirmwareDrain();
+	}
+#endif
+
 	while (ConfigStore::Get()->Flash())
 		;
 
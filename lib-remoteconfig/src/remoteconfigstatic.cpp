@@ -31,6 +31,8 @@
 #include "remoteconfig.h"
 #include "configstore.h"
 
+#include "../udp/udp_switch.h"
+
 #include "debug.h"
 
 using namespace configstore;
@@ -110,6 +112,30 @@ constexpr RemoteConfig::Txt RemoteConfig::s_TXT[] = {
 #endif
 };
 
+/*
+ * Slot -> index in s_TXT[], -1 is an empty slot.
+ * The file name, up to the '.', is hashed with the seed generated for the full set of file names.
+ */
+static int8_t s_TxtSlot[remoteconfig::udp::txt::MASK + 1];
+
+void RemoteConfig::TxtHashInit() {
+	memset(s_TxtSlot, -1, sizeof(s_TxtSlot));
+
+	for (uint32_t i = 0; i < (sizeof(s_TXT) / sizeof(s_TXT[0])); i++) {
+		const auto *t = &s_TXT[i];
+		assert(t->nFileNameLength == strlen(t->pFileName));
+		auto nHash = remoteconfig::udp::txt::SEED;
+		const auto isKey = remoteconfig::udp::hash_key(t->pFileName, t->nFileNameLength, '.', nHash);
+		assert(isKey);
+		const auto nSlot = remoteconfig::udp::hash_index(nHash, remoteconfig::udp::txt::MASK);
+		// The same file name can be listed twice, the first one is used
+		assert((s_TxtSlot[nSlot] < 0) || (strcmp(s_TXT[s_TxtSlot[nSlot]].pFileName, t->pFileName) == 0));
+		if (isKey && (s_TxtSlot[nSlot] < 0)) {
+			s_TxtSlot[nSlot] = static_cast<int8_t>(i);
+		}
+	}
+}
+
 int32_t RemoteConfig::GetIndex(const void *p, uint32_t& nLength) {
 	DEBUG_ENTRY
 	DEBUG_PRINTF("nLength=%d", nLength);
@@ -118,14 +144,18 @@ int32_t RemoteConfig::GetIndex(const void *p, uint32_t& nLength) {
 	debug_dump(const_cast<void*>(p), 16);
 #endif
 
-	int32_t i;
-	for (i = 0; i < static_cast<int32_t>(sizeof(s_TXT) / sizeof(s_TXT[0])); i++) {
-		const auto *t = &s_TXT[i];
-		assert(t->nFileNameLength == strlen(t->pFileName));
-		if (memcmp(p, t->pFileName, std::min(static_cast<uint32_t>(t->nFileNameLength), nLength)) == 0) {
-			nLength = t->nFileNameLength;
-			DEBUG_EXIT;
-			return i;
+	auto nHash = remoteconfig::udp::txt::SEED;
+
+	if (remoteconfig::udp::hash_key(reinterpret_cast<const char *>(p), std::min(nLength, remoteconfig::udp::txt::MAX_LENGTH + 1), '.', nHash)) {
+		const auto nIndex = s_TxtSlot[remoteconfig::udp::hash_index(nHash, remoteconfig::udp::txt::MASK)];
+
+		if (nIndex >= 0) {
+			const auto *t = &s_TXT[nIndex];
+			if (memcmp(p, t->pFileName, std::min(static_cast<uint32_t>(t->nFileNameLength), nLength)) == 0) {
+				nLength = t->nFileNameLength;
+				DEBUG_EXIT
+				return nIndex;
+			}
 		}
 	}
 
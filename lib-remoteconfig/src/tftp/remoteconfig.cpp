@@ -44,35 +44,31 @@
 
 #include "debug.h"
 
-static uint8_t s_TFTPBuffer[FIRMWARE_MAX_SIZE];
-
 void RemoteConfig::PlatformHandleTftpSet() {
 	DEBUG_ENTRY
 
 	if (m_bEnableTFTP && (m_pTFTPFileServer == nullptr)) {
-		m_pTFTPFileServer = new TFTPFileServer(s_TFTPBuffer, FIRMWARE_MAX_SIZE);
+		m_pFlashCodeInstall = FlashCodeInstall::Get();
+		assert(m_pFlashCodeInstall != nullptr);
+
+		m_pTFTPFileServer = new TFTPFileServer;
 		assert(m_pTFTPFileServer != nullptr);
 		Display::Get()->TextStatus("TFTP On", CONSOLE_GREEN);
 	} else if (!m_bEnableTFTP && (m_pTFTPFileServer != nullptr)) {
-		const uint32_t nFileSize = m_pTFTPFileServer->GetFileSize();
-		DEBUG_PRINTF("nFileSize=%d, %d", nFileSize, m_pTFTPFileServer->isDone());
-
-		bool bSucces = true;
-
-		if (m_pTFTPFileServer->isDone()) {
-			bSucces = FlashCodeInstall::Get()->WriteFirmware(s_TFTPBuffer, nFileSize);
-
-			if (!bSucces) {
-				Display::Get()->TextStatus("Error: TFTP", CONSOLE_RED);
-			}
+		DEBUG_PRINTF("nFileSize=%d, %d", m_pTFTPFileServer->GetFileSize(), m_pTFTPFileServer->isDone());
+
+		/*
+		 * A completed transfer is being installed in the background.
+		 * The header sector is not written for an incomplete transfer.
+		 */
+		if (!m_pTFTPFileServer->isDone()) {
+			m_pFlashCodeInstall->FirmwareAbort();
 		}
 
 		delete m_pTFTPFileServer;
 		m_pTFTPFileServer = nullptr;
 
-		if (bSucces) { // Keep error message
-			Display::Get()->TextStatus("TFTP Off", CONSOLE_GREEN);
-		}
+		Display::Get()->TextStatus("TFTP Off", CONSOLE_GREEN);
 	}
 
 	DEBUG_EXIT
@@ -30,6 +30,7 @@
 
 #include "tftp/tftpfileserver.h"
 #include "remoteconfig.h"
+#include "flashcodeinstall.h"
 #include "display.h"
 
 #include "debug.h"
@@ -38,11 +39,10 @@ using namespace tftpfileserver;
 
 static constexpr auto FILE_NAME_LENGTH = sizeof(FILE_NAME) - 1;
 
-TFTPFileServer::TFTPFileServer(uint8_t *pBuffer, uint32_t nSize): m_pBuffer(pBuffer), m_nSize(nSize) {
+TFTPFileServer::TFTPFileServer() {
 	DEBUG_ENTRY
 
-	assert(m_pBuffer != nullptr);
-	assert(nSize != 0);
+	assert(FlashCodeInstall::Get() != nullptr);
 
 	DEBUG_EXIT
 }
@@ -78,9 +78,15 @@ bool TFTPFileServer::FileCreate(const char* pFileName, tftp::Mode mode) {
 		return false;
 	}
 
+	if (!FlashCodeInstall::Get()->FirmwareBegin()) {
+		DEBUG_EXIT
+		return false;
+	}
+
 	Display::Get()->TextStatus("TFTP Started", CONSOLE_GREEN);
 
 	m_nFileSize = 0;
+	m_bDone = false;
 
 	DEBUG_EXIT
 	return (true);
@@ -93,6 +99,9 @@ bool TFTPFileServer::FileClose() {
 
 	Display::Get()->TextStatus("TFTP Ended", CONSOLE_GREEN);
 
+	// The sectors still buffered, and then the header sector, are installed in the background
+	FlashCodeInstall::Get()->FirmwareEnd();
+
 	DEBUG_EXIT
 	return true;
 }
@@ -105,12 +114,7 @@ size_t TFTPFileServer::FileRead([[maybe_unused]] void* pBuffer, [[maybe_unused]]
 }
 
 size_t TFTPFileServer::FileWrite(const void *pBuffer, size_t nCount, unsigned nBlockNumber) {
-	DEBUG_PRINTF("pBuffer=%p, nCount=%d, nBlockNumber=%d (%d)", pBuffer, nCount, nBlockNumber, m_nSize / 512);
-
-	if (nBlockNumber > (m_nSize / 512)) {
-		m_nFileSize = 0;
-		return 0;
-	}
+	DEBUG_PRINTF("pBuffer=%p, nCount=%d, nBlockNumber=%d", pBuffer, nCount, nBlockNumber);
 
 	assert(nBlockNumber != 0);
 
@@ -120,13 +124,20 @@ size_t TFTPFileServer::FileWrite(const void *pBuffer, size_t nCount, unsigned nB
 		}
 	}
 
-	const auto nOffset = (nBlockNumber - 1) * 512U;
+	const auto nOffset = (nBlockNumber - 1) * GetBlockSize();
 
-	assert((nOffset + nCount) <= m_nSize);
-
-	memcpy(&m_pBuffer[nOffset], pBuffer, nCount);
+	/*
+	 * Each completed sector is compared with the flash, and only erased and programmed when it differs.
+	 * A retransmitted block is ignored.
+	 */
+	if (!FlashCodeInstall::Get()->FirmwareWrite(reinterpret_cast<const uint8_t *>(pBuffer), static_cast<uint32_t>(nCount), nOffset)) {
+		m_nFileSize = 0;
+		return 0;
+	}
 
-	m_nFileSize += nCount; //FIXME BUG When in retry ?
+	if ((nOffset + nCount) > m_nFileSize) {
+		m_nFileSize = static_cast<uint32_t>(nOffset + nCount);
+	}
 
 	Display::Get()->Progress();
 
@@ -0,0 +1,278 @@
+/**
+ * @file benchmark_udp_switch.cpp
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdlib>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <chrono>
+
+#include "udp_switch.h"
+
+/*
+ * Compares the linear scan with the perfect hash dispatch over the full set of
+ * UDP commands and *.txt file names. The tables and the dispatch follow
+ * RemoteConfig::HandleRequest() and RemoteConfig::GetIndex().
+ */
+
+struct Commands {
+	const char *pCmd;
+	const uint16_t nLength;
+	const bool bGreaterThan;
+};
+
+static constexpr Commands s_GET[] = {
+		{ "reboot##",  8, false },
+		{ "list#",     5, false },
+		{ "version#",  8, false },
+		{ "display#",  8, false },
+		{ "uptime#",   7, false },
+		{ "rdm#",      4, false },
+		{ "get#",      4, true },
+		{ "tftp#",     5, false },
+		{ "factory##", 9, false }
+};
+
+static constexpr uint32_t GET_GET = 6;
+
+static constexpr Commands s_SET[] = {
+		{ "rdm#",     4, true },
+		{ "tftp#",    5, true },
+		{ "display#", 8, true }
+};
+
+static constexpr const char *s_TXT[] = {
+		"rconfig.txt", "env.txt", "network.txt", "display.txt", "artnet.txt", "e131.txt", "ltc.txt", "ldisplay.txt",
+		"tcnet.txt", "gps.txt", "etc.txt", "osc.txt", "oscclnt.txt", "show.txt", "node.txt", "rdm_device.txt",
+		"sensors.txt", "subdev.txt", "params.txt", "devices.txt", "mon.txt", "serial.txt", "rgbpanel.txt", "pca9685.txt",
+		"sparkfun.txt", "motor0.txt", "motor1.txt", "motor2.txt", "motor3.txt", "motor4.txt", "motor5.txt", "motor6.txt",
+		"motor7.txt"
+};
+
+static constexpr uint32_t BUFFER_SIZE = 1440;
+static constexpr uint32_t ROUNDS = 200000;
+
+static int8_t s_GetSlot[remoteconfig::udp::get::MASK + 1];
+static int8_t s_SetSlot[remoteconfig::udp::set::MASK + 1];
+static int8_t s_TxtSlot[remoteconfig::udp::txt::MASK + 1];
+static uint8_t s_TxtLength[sizeof(s_TXT) / sizeof(s_TXT[0])];
+
+/*
+ * Linear scan
+ */
+
+static int32_t linear_txt(const char *p, uint32_t nLength) {
+	for (uint32_t i = 0; i < (sizeof(s_TXT) / sizeof(s_TXT[0])); i++) {
+		if (memcmp(p, s_TXT[i], std::min(static_cast<uint32_t>(s_TxtLength[i]), nLength)) == 0) {
+			return static_cast<int32_t>(i);
+		}
+	}
+	return -1;
+}
+
+static int32_t linear_commands(const Commands *pCommands, const uint32_t nCommands, const char *pBuffer, const uint32_t nBytesReceived, const uint32_t nExtra) {
+	for (uint32_t i = 0; i < nCommands; i++) {
+		if ((pCommands[i].bGreaterThan) && (nBytesReceived <= pCommands[i].nLength)) {
+			continue;
+		}
+		if ((!pCommands[i].bGreaterThan) && ((nBytesReceived - nExtra) != pCommands[i].nLength)) {
+			continue;
+		}
+		if (memcmp(&pBuffer[1], pCommands[i].pCmd, pCommands[i].nLength) == 0) {
+			return static_cast<int32_t>(i);
+		}
+	}
+	return -1;
+}
+
+/*
+ * Perfect hash
+ */
+
+static void hash_init(const char *pKey, const uint32_t nLength, const char cDelimiter, const uint32_t i, int8_t *pSlots, const uint32_t nSeed, const uint32_t nMask) {
+	auto nHash = nSeed;
+	if (!remoteconfig::udp::hash_key(pKey, nLength, cDelimiter, nHash)) {
+		fprintf(stderr, "No delimiter in %s\n", pKey);
+		exit(EXIT_FAILURE);
+	}
+	const auto nSlot = remoteconfig::udp::hash_index(nHash, nMask);
+	if (pSlots[nSlot] >= 0) {
+		fprintf(stderr, "udp_switch.h is out of date: %s\n", pKey);
+		exit(EXIT_FAILURE);
+	}
+	pSlots[nSlot] = static_cast<int8_t>(i);
+}
+
+static int32_t hash_txt(const char *p, uint32_t nLength) {
+	auto nHash = remoteconfig::udp::txt::SEED;
+	if (!remoteconfig::udp::hash_key(p, std::min(nLength, remoteconfig::udp::txt::MAX_LENGTH + 1), '.', nHash)) {
+		return -1;
+	}
+	const auto nIndex = s_TxtSlot[remoteconfig::udp::hash_index(nHash, remoteconfig::udp::txt::MASK)];
+	if (nIndex < 0) {
+		return -1;
+	}
+	if (memcmp(p, s_TXT[nIndex], std::min(static_cast<uint32_t>(s_TxtLength[nIndex]), nLength)) == 0) {
+		return nIndex;
+	}
+	return -1;
+}
+
+static int32_t hash_commands(const Commands *pCommands, const int8_t *pSlots, const uint32_t nSeed, const uint32_t nMask, const uint32_t nMaxLength, const char *pBuffer, const uint32_t nBytesReceived, const uint32_t nExtra) {
+	auto nHash = nSeed;
+	if (!remoteconfig::udp::hash_key(&pBuffer[1], std::min(nBytesReceived, nMaxLength + 1), '#', nHash)) {
+		return -1;
+	}
+	const auto nIndex = pSlots[remoteconfig::udp::hash_index(nHash, nMask)];
+	if (nIndex < 0) {
+		return -1;
+	}
+	const auto *pHandler = &pCommands[nIndex];
+	if ((pHandler->bGreaterThan ? (nBytesReceived > pHandler->nLength) : ((nBytesReceived - nExtra) == pHandler->nLength))
+			&& (memcmp(&pBuffer[1], pHandler->pCmd, pHandler->nLength) == 0)) {
+		return nIndex;
+	}
+	return -1;
+}
+
+/*
+ * Returns the command index, and for a get or a set of a *.txt file also the file index
+ */
+
+template<bool isHash>
+static int32_t dispatch(const char *pBuffer, uint32_t nBytesReceived) {
+	if (pBuffer[nBytesReceived - 1] == '\n') {
+		nBytesReceived--;
+	}
+
+	if (pBuffer[0] == '?') {
+		nBytesReceived--;
+		const auto nIndex = isHash
+				? hash_commands(s_GET, s_GetSlot, remoteconfig::udp::get::SEED, remoteconfig::udp::get::MASK, remoteconfig::udp::get::MAX_LENGTH, pBuffer, nBytesReceived, 0)
+				: linear_commands(s_GET, sizeof(s_GET) / sizeof(s_GET[0]), pBuffer, nBytesReceived, 0);
+		if (nIndex == GET_GET) {
+			const auto nLength = BUFFER_SIZE - s_GET[GET_GET].nLength;
+			const auto *p = &pBuffer[s_GET[GET_GET].nLength + 1];
+			return (nIndex << 8) | ((isHash ? hash_txt(p, nLength) : linear_txt(p, nLength)) & 0xFF);
+		}
+		return nIndex;
+	}
+
+	if (pBuffer[0] == '#') {
+		return 0x10000 | ((isHash ? hash_txt(&pBuffer[1], BUFFER_SIZE - 1) : linear_txt(&pBuffer[1], BUFFER_SIZE - 1)) & 0xFF);
+	}
+
+	if (pBuffer[0] == '!') {
+		nBytesReceived--;
+		const auto nIndex = isHash
+				? hash_commands(s_SET, s_SetSlot, remoteconfig::udp::set::SEED, remoteconfig::udp::set::MASK, remoteconfig::udp::set::MAX_LENGTH, pBuffer, nBytesReceived, 1)
+				: linear_commands(s_SET, sizeof(s_SET) / sizeof(s_SET[0]), pBuffer, nBytesReceived, 1);
+		return 0x20000 | (nIndex & 0xFF);
+	}
+
+	return -1;
+}
+
+struct Request {
+	char aBuffer[BUFFER_SIZE];
+	uint32_t nLength;
+};
+
+static Request s_Requests[128];
+static uint32_t s_nRequests;
+
+static void add_request(const char *pFormat, const char *pString) {
+	auto& request = s_Requests[s_nRequests++];
+	memset(request.aBuffer, 0, BUFFER_SIZE);
+	request.nLength = static_cast<uint32_t>(snprintf(request.aBuffer, BUFFER_SIZE, pFormat, pString));
+}
+
+template<bool isHash>
+static double benchmark(uint32_t& nCheck) {
+	const auto start = std::chrono::steady_clock::now();
+
+	for (uint32_t nRound = 0; nRound < ROUNDS; nRound++) {
+		for (uint32_t i = 0; i < s_nRequests; i++) {
+			nCheck += static_cast<uint32_t>(dispatch<isHash>(s_Requests[i].aBuffer, s_Requests[i].nLength));
+		}
+	}
+
+	const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+	return elapsed.count() / (static_cast<double>(ROUNDS) * s_nRequests);
+}
+
+int main() {
+	memset(s_GetSlot, -1, sizeof(s_GetSlot));
+	memset(s_SetSlot, -1, sizeof(s_SetSlot));
+	memset(s_TxtSlot, -1, sizeof(s_TxtSlot));
+
+	for (uint32_t i = 0; i < (sizeof(s_GET) / sizeof(s_GET[0])); i++) {
+		hash_init(s_GET[i].pCmd, s_GET[i].nLength, '#', i, s_GetSlot, remoteconfig::udp::get::SEED, remoteconfig::udp::get::MASK);
+	}
+	for (uint32_t i = 0; i < (sizeof(s_SET) / sizeof(s_SET[0])); i++) {
+		hash_init(s_SET[i].pCmd, s_SET[i].nLength, '#', i, s_SetSlot, remoteconfig::udp::set::SEED, remoteconfig::udp::set::MASK);
+	}
+	for (uint32_t i = 0; i < (sizeof(s_TXT) / sizeof(s_TXT[0])); i++) {
+		s_TxtLength[i] = static_cast<uint8_t>(strlen(s_TXT[i]));
+		hash_init(s_TXT[i], s_TxtLength[i], '.', i, s_TxtSlot, remoteconfig::udp::txt::SEED, remoteconfig::udp::txt::MASK);
+	}
+
+	for (const auto& get : s_GET) {
+		if (!get.bGreaterThan) {
+			add_request("?%s\n", get.pCmd);
+		}
+	}
+	for (const auto *pFileName : s_TXT) {
+		add_request("?get#%s\n", pFileName);
+		add_request("#%s\nkey=value\n", pFileName);
+	}
+	add_request("!%s1\n", "rdm#");
+	add_request("!%s1\n", "tftp#");
+	add_request("!%sName\n", "display#");
+	add_request("?%s\n", "unknown#");
+	add_request("?get#%s\n", "unknown.txt");
+
+	for (uint32_t i = 0; i < s_nRequests; i++) {
+		const auto nLinear = dispatch<false>(s_Requests[i].aBuffer, s_Requests[i].nLength);
+		const auto nHash = dispatch<true>(s_Requests[i].aBuffer, s_Requests[i].nLength);
+		if (nLinear != nHash) {
+			fprintf(stderr, "Mismatch %.*s: %d != %d\n", static_cast<int>(s_Requests[i].nLength), s_Requests[i].aBuffer, nLinear, nHash);
+			return EXIT_FAILURE;
+		}
+	}
+
+	uint32_t nCheckLinear = 0;
+	uint32_t nCheckHash = 0;
+
+	const auto nLinear = benchmark<false>(nCheckLinear);
+	const auto nHash = benchmark<true>(nCheckHash);
+
+	printf("%u requests, %u rounds\n", s_nRequests, ROUNDS);
+	printf("linear scan : %6.1f ns/request\n", nLinear);
+	printf("perfect hash: %6.1f ns/request\n", nHash);
+
+	return (nCheckLinear == nCheckHash) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
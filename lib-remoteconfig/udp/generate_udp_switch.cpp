@@ -0,0 +1,168 @@
+/**
+ * @file generate_udp_switch.cpp
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdlib>
+#include <cstdint>
+#include <cstdio>
+#include <string.h>
+#include <cassert>
+
+/*
+ * Generates udp_switch.h with the perfect hash seeds for the UDP commands
+ * and for the *.txt file names. A key is hashed up to its delimiter, '#' for
+ * a command and '.' for a file name.
+ *
+ * The lists are the full set over all builds, a build uses a subset and
+ * fills its slots at run time. Keep the lists in sync with s_GET[], s_SET[]
+ * and s_TXT[].
+ */
+
+static constexpr const char *GET[] = {
+		"reboot", "list", "version", "display", "uptime", "rdm", "get", "tftp", "factory"
+};
+
+static constexpr const char *SET[] = {
+		"rdm", "tftp", "display"
+};
+
+static constexpr const char *TXT[] = {
+		"rconfig", "env", "network", "display", "artnet", "e131", "ltc", "ldisplay",
+		"tcnet", "gps", "etc", "osc", "oscclnt", "show", "node", "rdm_device",
+		"sensors", "subdev", "params", "devices", "mon", "serial", "rgbpanel", "pca9685",
+		"sparkfun", "motor0", "motor1", "motor2", "motor3", "motor4", "motor5", "motor6",
+		"motor7"
+};
+
+// begin udp_switch.h
+inline uint32_t hash_step(const uint32_t nHash, const uint32_t c) {
+	return (nHash * 33U) ^ c;
+}
+
+inline uint32_t hash_index(const uint32_t nHash, const uint32_t nMask) {
+	return (nHash ^ (nHash >> 16)) & nMask;
+}
+
+// nHash is the seed on entry, false when there is no cDelimiter within nLength
+inline bool hash_key(const char *pKey, const uint32_t nLength, const char cDelimiter, uint32_t& nHash) {
+	for (uint32_t i = 0; i < nLength; i++) {
+		if (pKey[i] == cDelimiter) {
+			return true;
+		}
+		nHash = hash_step(nHash, static_cast<uint8_t>(pKey[i]));
+	}
+	return false;
+}
+// end udp_switch.h
+
+static uint32_t hash(const uint32_t nSeed, const char *pString) {
+	auto nHash = nSeed;
+	const auto isKey = hash_key(pString, static_cast<uint32_t>(strlen(pString)) + 1, '\0', nHash);
+	assert(isKey);
+	return isKey ? nHash : 0;
+}
+
+/*
+ * Search for the seed which gives each key its own slot.
+ */
+static uint32_t find_seed(const char * const *pKeys, const uint32_t nKeys, const uint32_t nTableSize) {
+	assert(nKeys <= nTableSize);
+
+	for (uint32_t nSeed = 5381; nSeed != 0; nSeed++) {
+		bool isUsed[256] = {};
+		uint32_t i;
+
+		for (i = 0; i < nKeys; i++) {
+			const auto nIndex = hash_index(hash(nSeed, pKeys[i]), nTableSize - 1);
+			if (isUsed[nIndex]) {
+				break;
+			}
+			isUsed[nIndex] = true;
+		}
+
+		if (i == nKeys) {
+			return nSeed;
+		}
+	}
+
+	assert(0);
+	return 0;
+}
+
+static void write_table(FILE *pFile, const char *pNamespace, const char * const *pKeys, const uint32_t nKeys, const uint32_t nTableSize) {
+	assert(nTableSize <= 128);
+	const auto nSeed = find_seed(pKeys, nKeys, nTableSize);
+
+	uint32_t nMaxLength = 0;
+
+	for (uint32_t i = 0; i < nKeys; i++) {
+		const auto nLength = static_cast<uint32_t>(strlen(pKeys[i]));
+		if (nLength > nMaxLength) {
+			nMaxLength = nLength;
+		}
+	}
+
+	fprintf(pFile, "namespace %s {\n", pNamespace);
+	fprintf(pFile, "static constexpr uint32_t SEED = 0x%.8x;\n", nSeed);
+	fprintf(pFile, "static constexpr uint32_t MASK = 0x%.2x;\n", nTableSize - 1);
+	fprintf(pFile, "static constexpr uint32_t MAX_LENGTH = %u;\n", nMaxLength);
+	fprintf(pFile, "}  // namespace %s\n\n", pNamespace);
+
+	for (uint32_t nIndex = 0; nIndex < nTableSize; nIndex++) {
+		uint32_t i;
+		for (i = 0; i < nKeys; i++) {
+			if (hash_index(hash(nSeed, pKeys[i]), nTableSize - 1) == nIndex) {
+				break;
+			}
+		}
+
+		printf("%s %3u %s\n", pNamespace, nIndex, i == nKeys ? "" : pKeys[i]);
+	}
+}
+
+int main() {
+	const auto pFile = fopen("udp_switch.h", "w");
+	assert(pFile != nullptr);
+
+	fprintf(pFile, "#ifndef UDP_SWITCH_H_\n");
+	fprintf(pFile, "#define UDP_SWITCH_H_\n\n");
+	fprintf(pFile, "#include <cstdint>\n\n");
+	fprintf(pFile, "namespace remoteconfig {\n");
+	fprintf(pFile, "namespace udp {\n");
+
+	write_table(pFile, "get", GET, sizeof(GET) / sizeof(GET[0]), 16);
+	write_table(pFile, "set", SET, sizeof(SET) / sizeof(SET[0]), 4);
+	write_table(pFile, "txt", TXT, sizeof(TXT) / sizeof(TXT[0]), 64);
+
+	fprintf(pFile, "}  // namespace udp\n");
+	fprintf(pFile, "}  // namespace remoteconfig\n\n");
+	fclose(pFile);
+
+	system("printf \'namespace remoteconfig {\\nnamespace udp {\\n\' >> udp_switch.h");
+	system("sed -n '/^\\/\\/ begin udp_switch.h$/,/^\\/\\/ end udp_switch.h$/{//!p}' generate_udp_switch.cpp >> udp_switch.h");
+	system("printf \'}  // namespace udp\\n}  // namespace remoteconfig\\n\\n\' >> udp_switch.h");
+	system("echo \'#endif /* UDP_SWITCH_H_ */' >> udp_switch.h");
+
+	return EXIT_SUCCESS;
+}
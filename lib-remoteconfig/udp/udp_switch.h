@@ -0,0 +1,52 @@
+#ifndef UDP_SWITCH_H_
+#define UDP_SWITCH_H_
+
+#include <cstdint>
+
+namespace remoteconfig {
+namespace udp {
+namespace get {
+static constexpr uint32_t SEED = 0x00001507;
+static constexpr uint32_t MASK = 0x0f;
+static constexpr uint32_t MAX_LENGTH = 7;
+}  // namespace get
+
+namespace set {
+static constexpr uint32_t SEED = 0x00001506;
+static constexpr uint32_t MASK = 0x03;
+static constexpr uint32_t MAX_LENGTH = 7;
+}  // namespace set
+
+namespace txt {
+static constexpr uint32_t SEED = 0x000029c9;
+static constexpr uint32_t MASK = 0x3f;
+static constexpr uint32_t MAX_LENGTH = 10;
+}  // namespace txt
+
+}  // namespace udp
+}  // namespace remoteconfig
+
+namespace remoteconfig {
+namespace udp {
+inline uint32_t hash_step(const uint32_t nHash, const uint32_t c) {
+	return (nHash * 33U) ^ c;
+}
+
+inline uint32_t hash_index(const uint32_t nHash, const uint32_t nMask) {
+	return (nHash ^ (nHash >> 16)) & nMask;
+}
+
+// nHash is the seed on entry, false when there is no cDelimiter within nLength
+inline bool hash_key(const char *pKey, const uint32_t nLength, const char cDelimiter, uint32_t& nHash) {
+	for (uint32_t i = 0; i < nLength; i++) {
+		if (pKey[i] == cDelimiter) {
+			return true;
+		}
+		nHash = hash_step(nHash, static_cast<uint8_t>(pKey[i]));
+	}
+	return false;
+}
+}  // namespace udp
+}  // namespace remoteconfig
+
+#endif /* UDP_SWITCH_H_ */
@@ -58,6 +58,21 @@ public:
 	void Blackout();
 	void FullOn();
 
+	/**
+	 * Sends a deferred frame, as soon as the DMA transfer has completed.
+	 */
+	void Run() {
+		if (__builtin_expect((m_bUpdatePending), 0)) {
+			if (!IsUpdating()) {
+				Update();
+			}
+		}
+	}
+
+	const pixel::FrameStats& GetFrameStats() const {
+		return m_FrameStats;
+	}
+
 	void SetJamSTAPLDisplay(JamSTAPLDisplay *pJamSTAPLDisplay) {
 		m_pJamSTAPLDisplay = pJamSTAPLDisplay;
 	}
@@ -73,14 +88,17 @@ private:
 	bool SetupCPLD();
 	void SetupBuffers();
 	void SetColour(const uint32_t nPortIndex, const uint32_t nPixelIndex, uint8_t nRed, uint8_t nGreen, uint8_t nBlue);
+	void Transpose(uint8_t *pDmaBuffer);
 
 private:
 	bool m_hasCPLD { false };
 	uint32_t m_nBufSize { 0 };
 
-	uint8_t *const m_pBuffer { reinterpret_cast<uint8_t *>(H3_SRAM_A1_BASE + 4096) };
+	uint8_t *const m_pBuffer { reinterpret_cast<uint8_t *>(H3_SRAM_A1_BASE + 4096) };	///< Colour bytes, ports interleaved
 	uint8_t *m_pDmaBuffer { nullptr };
 	uint8_t *m_pDmaBufferBlackout { nullptr };
+	bool m_bUpdatePending { false };
+	pixel::FrameStats m_FrameStats {};
 
 	JamSTAPLDisplay *m_pJamSTAPLDisplay { nullptr };
 
@@ -79,6 +79,12 @@ static constexpr auto COUNT = 170;
 static constexpr auto OUTPUT_PORTS = 1;
 }  // namespace defaults
 
+struct FrameStats {
+	uint32_t nFramesOutput;		///< Frames handed to the DMA
+	uint32_t nFramesDeferred;	///< Update() while the DMA was active, sent when the transfer completed
+	uint32_t nFramesCoalesced;	///< Update() while a deferred frame was still pending, merged into that frame
+};
+
 inline Map pixel_get_map(const pixel::Type type) {
 	if ((type == pixel::Type::WS2811) || (type == pixel::Type::UCS2903)) {
 		return pixel::Map::RGB;
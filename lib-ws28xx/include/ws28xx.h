@@ -54,18 +54,44 @@ public:
 	void Blackout();
 	void FullOn();
 
+	/**
+	 * Sends a deferred frame, as soon as the DMA transfer has completed.
+	 */
+	void Run() {
+		if (__builtin_expect((m_bUpdatePending), 0)) {
+			if (!IsUpdating()) {
+				Update();
+			}
+		}
+	}
+
+	const pixel::FrameStats& GetFrameStats() const {
+		return m_FrameStats;
+	}
+
 	static WS28xx *Get() {
 		return s_pThis;
 	}
 
 private:
+	void SetupCodes();
 	void SetupBuffers();
 	void SetColorWS28xx(uint32_t nOffset, uint8_t nValue);
 
 private:
+	uint64_t m_Codes[256];	///< SPI bytes for a colour byte, first byte sent in the LSB
+	pixel::Type m_type;
+	bool m_bIsRTZProtocol;
+	uint8_t m_nGlobalBrightness;
+#if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
+	const uint8_t *m_pGammaTable;
+#endif
 	uint32_t m_nBufSize;
-	uint8_t *m_pBuffer { nullptr };
+	uint8_t *m_pBuffer { nullptr };			///< Back buffer, SetPixel encodes here
+	uint8_t *m_pDmaBuffer { nullptr };		///< Front buffer, read by the DMA
 	uint8_t *m_pBlackoutBuffer { nullptr };
+	bool m_bUpdatePending { false };
+	pixel::FrameStats m_FrameStats {};
 
 	static WS28xx *s_pThis;
 };
@@ -56,6 +56,7 @@ WS28xx::WS28xx()  {
 	auto& pixelConfiguration = PixelConfiguration::Get();
 
 	pixelConfiguration.Validate();
+	SetupCodes();
 
 	const auto nCount = pixelConfiguration.GetCount();
 
@@ -84,7 +85,12 @@ WS28xx::WS28xx()  {
 WS28xx::~WS28xx() {
 #if defined( USE_SPI_DMA )
 	m_pBlackoutBuffer = nullptr;
-	m_pBuffer = nullptr;
+	m_pDmaBuffer = nullptr;
+
+	if (m_pBuffer != nullptr) {
+		delete [] m_pBuffer;
+		m_pBuffer = nullptr;
+	}
 #else
 	if (m_pBlackoutBuffer != nullptr) {
 		delete [] m_pBlackoutBuffer;
@@ -106,13 +112,17 @@ void WS28xx::SetupBuffers() {
 #if defined( USE_SPI_DMA )
 	uint32_t nSize;
 
-	m_pBuffer = const_cast<uint8_t*>(FUNC_PREFIX (spi_dma_tx_prepare(&nSize)));
-	assert(m_pBuffer != nullptr);
+	m_pDmaBuffer = const_cast<uint8_t*>(FUNC_PREFIX (spi_dma_tx_prepare(&nSize)));
+	assert(m_pDmaBuffer != nullptr);
 
 	const auto nSizeHalf = nSize / 2;
 	assert(m_nBufSize <= nSizeHalf);
 
-	m_pBlackoutBuffer = m_pBuffer + (nSizeHalf & static_cast<uint32_t>(~3));
+	m_pBlackoutBuffer = m_pDmaBuffer + (nSizeHalf & static_cast<uint32_t>(~3));
+
+	assert(m_pBuffer == nullptr);
+	m_pBuffer = new uint8_t[m_nBufSize];
+	assert(m_pBuffer != nullptr);
 #else
 	assert(m_pBuffer == nullptr);
 	m_pBuffer = new uint8_t[m_nBufSize];
@@ -144,7 +154,7 @@ void WS28xx::SetupBuffers() {
 		}
 	} else {
 		m_pBuffer[0] = 0x00;
-		memset(&m_pBuffer[1], type == pixel::Type::WS2801 ? 0 : pixelConfiguration.GetLowCode(), m_nBufSize);
+		memset(&m_pBuffer[1], type == pixel::Type::WS2801 ? 0 : pixelConfiguration.GetLowCode(), m_nBufSize - 1);
 	}
 
 	memcpy(m_pBlackoutBuffer, m_pBuffer, m_nBufSize);
@@ -152,10 +162,47 @@ void WS28xx::SetupBuffers() {
 	DEBUG_EXIT
 }
 
+#if defined( USE_SPI_DMA )
+inline void memcpy64(void *dest, void const *src, size_t n) {
+	auto *plDst = reinterpret_cast<uint64_t *>(dest);
+	const auto *plSrc = reinterpret_cast<const uint64_t *>(src);
+
+	while (n >= 8) {
+		*plDst++ = *plSrc++;
+		n -= 8;
+	}
+
+	auto *pcDst = reinterpret_cast<uint8_t *>(plDst);
+	const auto *pcSrc = reinterpret_cast<const uint8_t *>(plSrc);
+
+	while (n--) {
+		*pcDst++ = *pcSrc++;
+	}
+}
+#endif
+
+/**
+ * The frame is encoded in the back buffer (m_pBuffer) and copied into the DMA buffer
+ * when the transfer is started. When the DMA is still active, the frame is deferred
+ * and sent by Run(). Later updates are coalesced into that frame.
+ */
 void WS28xx::Update() {
 #if defined( USE_SPI_DMA )
-	assert(!IsUpdating());
-	FUNC_PREFIX(spi_dma_tx_start(m_pBuffer, m_nBufSize));
+	if (FUNC_PREFIX(spi_dma_tx_is_active())) {
+		if (m_bUpdatePending) {
+			m_FrameStats.nFramesCoalesced++;
+		} else {
+			m_FrameStats.nFramesDeferred++;
+			m_bUpdatePending = true;
+		}
+		return;
+	}
+
+	m_bUpdatePending = false;
+	m_FrameStats.nFramesOutput++;
+
+	memcpy64(m_pDmaBuffer, m_pBuffer, m_nBufSize);
+	FUNC_PREFIX(spi_dma_tx_start(m_pDmaBuffer, m_nBufSize));
 #else
 	FUNC_PREFIX(spi_writenb(reinterpret_cast<char *>(m_pBuffer), m_nBufSize));
 #endif
@@ -193,7 +240,7 @@ void WS28xx::Blackout() {
 		}
 	} else {
 		m_pBuffer[0] = 0x00;
-		memset(&m_pBuffer[1], type == pixel::Type::WS2801 ? 0 : pixelConfiguration.GetLowCode(), m_nBufSize);
+		memset(&m_pBuffer[1], type == pixel::Type::WS2801 ? 0 : pixelConfiguration.GetLowCode(), m_nBufSize - 1);
 	}
 
 	Update();
@@ -239,7 +286,7 @@ void WS28xx::FullOn() {
 		}
 	} else {
 		m_pBuffer[0] = 0x00;
-		memset(&m_pBuffer[1], type == pixel::Type::WS2801 ? 0xFF : pixelConfiguration.GetHighCode(), m_nBufSize);
+		memset(&m_pBuffer[1], type == pixel::Type::WS2801 ? 0xFF : pixelConfiguration.GetHighCode(), m_nBufSize - 1);
 	}
 
 	Update();
@@ -38,6 +38,9 @@
 #include <cstring>
 #include <cstdio>
 #include <cassert>
+#if defined (__ARM_NEON)
+# include <arm_neon.h>
+#endif
 
 #include "ws28xxmulti.h"
 #include "pixelconfiguration.h"
@@ -144,7 +147,7 @@ void WS28xxMulti::SetupBuffers() {
 			}
 		}
 
-		memcpy(m_pDmaBufferBlackout, m_pBuffer, m_nBufSize);
+		Transpose(m_pDmaBufferBlackout);
 	} else {
 		memset(m_pDmaBufferBlackout, 0, m_nBufSize);
 	}
@@ -225,71 +228,32 @@ uint8_t WS28xxMulti::ReverseBits(uint8_t nBits) {
 	return static_cast<uint8_t>((output >> 24));
 }
 
-#define BIT_SET(a,b) 	((a) |= static_cast<uint8_t>((1<<(b))))
-#define BIT_CLEAR(a,b) 	((a) &= static_cast<uint8_t>(~(1<<(b))))
+/*
+ * m_pBuffer holds the colour bytes of the 8 ports interleaved, byte [i * 8 + nPortIndex].
+ * Update() converts each group of 8 bytes into the 8 bit times sent to the HC595/CPLD,
+ * bit nPortIndex of output byte j being bit (7 - j) of the colour byte of that port.
+ */
 
 void WS28xxMulti::SetColour(uint32_t nPortIndex, uint32_t nPixelIndex, uint8_t nColour1, uint8_t nColour2, uint8_t nColour3) {
-	uint32_t j = 0;
-	const uint32_t k = nPixelIndex * pixel::single::RGB;
+	const auto k = nPixelIndex * pixel::single::RGB + nPortIndex;
 
-	for (uint8_t mask = 0x80; mask != 0; mask = static_cast<uint8_t>(mask >> 1)) {
-		if (mask & nColour1) {
-			BIT_SET(m_pBuffer[k + j], nPortIndex);
-		} else {
-			BIT_CLEAR(m_pBuffer[k + j], nPortIndex);
-		}
-		if (mask & nColour2) {
-			BIT_SET(m_pBuffer[8 + k + j], nPortIndex);
-		} else {
-			BIT_CLEAR(m_pBuffer[8 + k + j], nPortIndex);
-		}
-		if (mask & nColour3) {
-			BIT_SET(m_pBuffer[16 + k + j], nPortIndex);
-		} else {
-			BIT_CLEAR(m_pBuffer[16 + k + j], nPortIndex);
-		}
-
-		j++;
-	}
+	m_pBuffer[k] = nColour1;
+	m_pBuffer[k + 8] = nColour2;
+	m_pBuffer[k + 16] = nColour3;
 }
 
 void WS28xxMulti::SetPixel4Bytes(uint32_t nPortIndex, uint32_t nPixelIndex, uint8_t nRed, uint8_t nGreen, uint8_t nBlue, uint8_t nWhite) {
-	const auto k = nPixelIndex * pixel::single::RGBW;
-	uint32_t j = 0;
-
-	for (uint8_t mask = 0x80; mask != 0; mask = static_cast<uint8_t>(mask >> 1)) {
-		// GRBW
-		if (mask & nGreen) {
-			BIT_SET(m_pBuffer[k + j], nPortIndex);
-		} else {
-			BIT_CLEAR(m_pBuffer[k + j], nPortIndex);
-		}
-
-		if (mask & nRed) {
-			BIT_SET(m_pBuffer[8 + k + j], nPortIndex);
-		} else {
-			BIT_CLEAR(m_pBuffer[8 + k + j], nPortIndex);
-		}
-
-		if (mask & nBlue) {
-			BIT_SET(m_pBuffer[16 + k + j], nPortIndex);
-		} else {
-			BIT_CLEAR(m_pBuffer[16 + k + j], nPortIndex);
-		}
-
-		if (mask & nWhite) {
-			BIT_SET(m_pBuffer[24 + k + j], nPortIndex);
-		} else {
-			BIT_CLEAR(m_pBuffer[24 + k + j], nPortIndex);
-		}
-
-		j++;
-	}
+	const auto k = nPixelIndex * pixel::single::RGBW + nPortIndex;
+	// GRBW
+	m_pBuffer[k] = nGreen;
+	m_pBuffer[k + 8] = nRed;
+	m_pBuffer[k + 16] = nBlue;
+	m_pBuffer[k + 24] = nWhite;
 }
 
 void WS28xxMulti::SetColourRTZ(uint32_t nPortIndex, uint32_t nPixelIndex, uint8_t nRed, uint8_t nGreen, uint8_t nBlue, uint8_t nWhite) {
 #if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
-	const auto pGammaTable = m_PixelConfiguration.GetGammaTable();
+	const auto pGammaTable = PixelConfiguration::Get().GetGammaTable();
 
 	nRed = pGammaTable[nRed];
 	nGreen = pGammaTable[nGreen];
@@ -297,64 +261,79 @@ void WS28xxMulti::SetColourRTZ(uint32_t nPortIndex, uint32_t nPixelIndex, uint8_
 	nWhite = pGammaTable[nWhite];
 #endif
 
-	const auto k = nPixelIndex * pixel::single::RGBW;
-	uint32_t j = 0;
-
-	for (uint8_t mask = 0x80; mask != 0; mask = static_cast<uint8_t>(mask >> 1)) {
-		// GRBW
-		if (mask & nGreen) {
-			BIT_SET(m_pBuffer[k + j], nPortIndex);
-		} else {
-			BIT_CLEAR(m_pBuffer[k + j], nPortIndex);
-		}
-
-		if (mask & nRed) {
-			BIT_SET(m_pBuffer[8 + k + j], nPortIndex);
-		} else {
-			BIT_CLEAR(m_pBuffer[8 + k + j], nPortIndex);
-		}
+	SetPixel4Bytes(nPortIndex, nPixelIndex, nRed, nGreen, nBlue, nWhite);
+}
 
-		if (mask & nBlue) {
-			BIT_SET(m_pBuffer[16 + k + j], nPortIndex);
-		} else {
-			BIT_CLEAR(m_pBuffer[16 + k + j], nPortIndex);
-		}
+/**
+ * 8x8 bit matrix transpose, followed by a byte swap so that the MSB is sent first.
+ */
+static inline uint64_t transpose8x8(uint64_t x) {
+	uint64_t t;
 
-		if (mask & nWhite) {
-			BIT_SET(m_pBuffer[24 + k + j], nPortIndex);
-		} else {
-			BIT_CLEAR(m_pBuffer[24 + k + j], nPortIndex);
-		}
+	t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+	x = x ^ t ^ (t << 7);
+	t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+	x = x ^ t ^ (t << 14);
+	t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+	x = x ^ t ^ (t << 28);
 
-		j++;
-	}
+	return __builtin_bswap64(x);
 }
 
-inline void memcpy64(void *dest, void const *src, size_t n) {
-	auto *plDst = reinterpret_cast<uint64_t *>(dest);
-	const auto *plSrc = reinterpret_cast<const uint64_t *>(src);
-
-	while (n >= 8) {
-		*plDst++ = *plSrc++;
-		n -= 8;
+void WS28xxMulti::Transpose(uint8_t *pDmaBuffer) {
+	const auto *pSource = reinterpret_cast<const uint64_t *>(m_pBuffer);
+	auto *pDestination = reinterpret_cast<uint64_t *>(pDmaBuffer);
+	const auto nWords = m_nBufSize / 8;
+	uint32_t i = 0;
+
+#if defined (__ARM_NEON)
+	const auto mask7 = vdupq_n_u64(0x00AA00AA00AA00AAULL);
+	const auto mask14 = vdupq_n_u64(0x0000CCCC0000CCCCULL);
+	const auto mask28 = vdupq_n_u64(0x00000000F0F0F0F0ULL);
+
+	for (; (i + 2) <= nWords; i += 2) {
+		auto x = vld1q_u64(&pSource[i]);
+		auto t = vandq_u64(veorq_u64(x, vshrq_n_u64(x, 7)), mask7);
+		x = veorq_u64(veorq_u64(x, t), vshlq_n_u64(t, 7));
+		t = vandq_u64(veorq_u64(x, vshrq_n_u64(x, 14)), mask14);
+		x = veorq_u64(veorq_u64(x, t), vshlq_n_u64(t, 14));
+		t = vandq_u64(veorq_u64(x, vshrq_n_u64(x, 28)), mask28);
+		x = veorq_u64(veorq_u64(x, t), vshlq_n_u64(t, 28));
+		// Byte stores: the blackout buffer is only 4 bytes aligned
+		vst1q_u8(reinterpret_cast<uint8_t *>(&pDestination[i]), vrev64q_u8(vreinterpretq_u8_u64(x)));
 	}
+#endif
 
-	auto *pcDst = reinterpret_cast<uint8_t *>(plDst);
-	const auto *pcSrc = reinterpret_cast<const uint8_t *>(plSrc);
+	for (; i < nWords; i++) {
+		pDestination[i] = transpose8x8(pSource[i]);
+	}
 
-	while (n--) {
-		*pcDst++ = *pcSrc++;
+	for (i = nWords * 8; i < m_nBufSize; i++) {
+		pDmaBuffer[i] = m_pBuffer[i];
 	}
 }
 
+/**
+ * When the DMA is still active, the frame is deferred and sent by Run().
+ * Later updates are coalesced into that frame.
+ */
 void WS28xxMulti::Update() {
-	assert(!FUNC_PREFIX(spi_dma_tx_is_active()));
+	asm volatile ("isb" ::: "memory"); // https://github.com/vanvught/rpidmx512/issues/281
 
-	do { // https://github.com/vanvught/rpidmx512/issues/281
-		asm volatile ("isb" ::: "memory");
-	} while (FUNC_PREFIX(spi_dma_tx_is_active()));
+	if (FUNC_PREFIX(spi_dma_tx_is_active())) {
+		if (m_bUpdatePending) {
+			m_FrameStats.nFramesCoalesced++;
+		} else {
+			m_FrameStats.nFramesDeferred++;
+			m_bUpdatePending = true;
+		}
+		return;
+	}
+
+	m_bUpdatePending = false;
+	m_FrameStats.nFramesOutput++;
 
-	memcpy64(m_pDmaBuffer, reinterpret_cast<void *>(H3_SRAM_A1_BASE + 4096), m_nBufSize);
+	Transpose(m_pDmaBuffer);
 
 	FUNC_PREFIX(spi_dma_tx_start(m_pDmaBuffer, m_nBufSize));
 }
@@ -367,6 +346,7 @@ void WS28xxMulti::Blackout() {
 		asm volatile ("isb" ::: "memory");
 	} while (FUNC_PREFIX(spi_dma_tx_is_active()));
 
+	m_bUpdatePending = false;
 	FUNC_PREFIX(spi_dma_tx_start(m_pDmaBufferBlackout, m_nBufSize));
 
 	// A blackout may not be interrupted.
@@ -43,40 +43,68 @@
 
 #include "gamma/gamma_tables.h"
 
-void WS28xx::SetColorWS28xx(uint32_t nOffset, uint8_t nValue) {
+void WS28xx::SetupCodes() {
 	auto& pixelConfiguration = PixelConfiguration::Get();
-	assert(pixelConfiguration.GetType() != pixel::Type::WS2801);
-	assert(m_pBuffer != nullptr);
-	assert(nOffset + 7 < m_nBufSize);
 
-	nOffset += 1;
+	m_type = pixelConfiguration.GetType();
+	m_bIsRTZProtocol = pixelConfiguration.IsRTZProtocol();
+	m_nGlobalBrightness = pixelConfiguration.GetGlobalBrightness();
+#if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
+	m_pGammaTable = pixelConfiguration.GetGammaTable();
+#endif
+
+	if (!m_bIsRTZProtocol) {
+		return;
+	}
 
 	const auto nLowCode = pixelConfiguration.GetLowCode();
 	const auto nHighCode = pixelConfiguration.GetHighCode();
 
-	for (uint8_t mask = 0x80; mask != 0; mask = static_cast<uint8_t>(mask >> 1)) {
-		if (nValue & mask) {
-			m_pBuffer[nOffset] = nHighCode;
-		} else {
-			m_pBuffer[nOffset] = nLowCode;
+	for (uint32_t nValue = 0; nValue < 256; nValue++) {
+		uint64_t nCode = 0;
+
+		for (uint32_t nBit = 0; nBit < 8; nBit++) {
+			const auto nSpiByte = (nValue & (0x80U >> nBit)) ? nHighCode : nLowCode;
+			nCode |= static_cast<uint64_t>(nSpiByte) << (nBit * 8);
 		}
-		nOffset++;
+
+		m_Codes[nValue] = nCode;
 	}
 }
 
+/**
+ * Each colour byte is sent as 8 SPI bytes, MSB first.
+ * The buffer starts with a 0x00, so a code always starts at an offset 1 (mod 8).
+ * This gives aligned byte, halfword, word, byte stores, also valid for the DMA
+ * buffer which is mapped as strongly-ordered memory.
+ */
+void WS28xx::SetColorWS28xx(uint32_t nOffset, uint8_t nValue) {
+	assert(m_bIsRTZProtocol);
+	assert(m_pBuffer != nullptr);
+	assert(nOffset + 7 < m_nBufSize);
+
+	auto *pBuffer = &m_pBuffer[nOffset + 1];
+	assert((reinterpret_cast<uintptr_t>(pBuffer) & 0x3) == 1);
+
+	const auto nCode = m_Codes[nValue];
+
+	pBuffer[0] = static_cast<uint8_t>(nCode);
+	*reinterpret_cast<uint16_t *>(&pBuffer[1]) = static_cast<uint16_t>(nCode >> 8);
+	*reinterpret_cast<uint32_t *>(&pBuffer[3]) = static_cast<uint32_t>(nCode >> 24);
+	pBuffer[7] = static_cast<uint8_t>(nCode >> 56);
+}
+
 void WS28xx::SetPixel(uint32_t nPixelIndex, uint8_t nRed, uint8_t nGreen, uint8_t nBlue) {
-	auto& pixelConfiguration = PixelConfiguration::Get();
-	assert(nPixelIndex < pixelConfiguration.GetCount());
+	assert(nPixelIndex < PixelConfiguration::Get().GetCount());
+	assert(m_pBuffer != nullptr);
 
 #if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
-	const auto pGammaTable = pixelConfiguration.GetGammaTable();
-
-	nRed = pGammaTable[nRed];
-	nGreen = pGammaTable[nGreen];
-	nBlue = pGammaTable[nBlue];
+	nRed = m_pGammaTable[nRed];
+	nGreen = m_pGammaTable[nGreen];
+	nBlue = m_pGammaTable[nBlue];
 #endif
 
-	if (pixelConfiguration.IsRTZProtocol()) {
+	if (__builtin_expect(m_bIsRTZProtocol, 1)) {
 		const auto nOffset = nPixelIndex * 24U;
 
 		SetColorWS28xx(nOffset, nRed);
@@ -85,34 +113,28 @@ void WS28xx::SetPixel(uint32_t nPixelIndex, uint8_t nRed, uint8_t nGreen, uint8_
 		return;
 	}
 
-	assert(m_pBuffer != nullptr);
-
-	const auto type = pixelConfiguration.GetType();
-
-	if (type == pixel::Type::WS2801) {
+	switch (m_type) {
+	case pixel::Type::WS2801: {
 		const auto nOffset = nPixelIndex * 3U;
 		assert(nOffset + 2U < m_nBufSize);
 
 		m_pBuffer[nOffset] = nRed;
 		m_pBuffer[nOffset + 1] = nGreen;
 		m_pBuffer[nOffset + 2] = nBlue;
-
 		return;
 	}
-
-	if ((type == pixel::Type::APA102) || (type == pixel::Type::SK9822)) {
+	case pixel::Type::APA102:
+	case pixel::Type::SK9822: {
 		const auto nOffset = 4U + (nPixelIndex * 4U);
 		assert(nOffset + 3U < m_nBufSize);
 
-		m_pBuffer[nOffset] = pixelConfiguration.GetGlobalBrightness();
+		m_pBuffer[nOffset] = m_nGlobalBrightness;
 		m_pBuffer[nOffset + 1] = nRed;
 		m_pBuffer[nOffset + 2] = nGreen;
 		m_pBuffer[nOffset + 3] = nBlue;
-
 		return;
 	}
-
-	if (type == pixel::Type::P9813) {
+	case pixel::Type::P9813: {
 		const auto nOffset = 4U + (nPixelIndex * 4U);
 		assert(nOffset + 3 < m_nBufSize);
 
@@ -122,9 +144,11 @@ void WS28xx::SetPixel(uint32_t nPixelIndex, uint8_t nRed, uint8_t nGreen, uint8_
 		m_pBuffer[nOffset + 1] = nBlue;
 		m_pBuffer[nOffset + 2] = nGreen;
 		m_pBuffer[nOffset + 3] = nRed;
-
 		return;
 	}
+	default:
+		break;
+	}
 
 	assert(0);
 	__builtin_unreachable();
@@ -132,15 +156,13 @@ void WS28xx::SetPixel(uint32_t nPixelIndex, uint8_t nRed, uint8_t nGreen, uint8_
 
 void WS28xx::SetPixel(uint32_t nPixelIndex, uint8_t nRed, uint8_t nGreen, uint8_t nBlue, uint8_t nWhite) {
 	assert(nPixelIndex < PixelConfiguration::Get().GetCount());
-	assert(PixelConfiguration::Get().GetType() == pixel::Type::SK6812W);
+	assert(m_type == pixel::Type::SK6812W);
 
 #if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
-	const auto pGammaTable = pixelConfiguration.GetGammaTable();
-
-	nRed = pGammaTable[nRed];
-	nGreen = pGammaTable[nGreen];
-	nBlue = pGammaTable[nBlue];
-	nWhite = pGammaTable[nWhite];
+	nRed = m_pGammaTable[nRed];
+	nGreen = m_pGammaTable[nGreen];
+	nBlue = m_pGammaTable[nBlue];
+	nWhite = m_pGammaTable[nWhite];
 #endif
 
 	const auto nOffset = nPixelIndex * 32U;
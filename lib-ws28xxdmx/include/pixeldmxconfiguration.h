@@ -34,6 +34,7 @@
 
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <algorithm>
 #include <cassert>
 
@@ -46,6 +47,34 @@ struct PortInfo {
 	uint16_t nBeginIndexPort[4];
 	uint16_t nProtocolPortIndexLast;
 };
+enum class Layout {
+	LINEAR,		///< Pixel 0 is the first pixel on the strip
+	REVERSED,	///< Pixel 0 is the last pixel on the strip
+	SERPENTINE,	///< Matrix, every other row of GetSegmentLength() pixels runs backwards
+	UNDEFINED
+};
+
+inline constexpr char LAYOUTS[static_cast<uint32_t>(Layout::UNDEFINED)][11] = { "linear", "reversed", "serpentine" };
+
+inline const char *get_layout(const Layout layout) {
+	if (layout < Layout::UNDEFINED) {
+		return LAYOUTS[static_cast<uint32_t>(layout)];
+	}
+
+	return "Undefined";
+}
+
+inline Layout get_layout(const char *pString) {
+	assert(pString != nullptr);
+
+	for (uint32_t i = 0; i < static_cast<uint32_t>(Layout::UNDEFINED); i++) {
+		if (strcasecmp(pString, LAYOUTS[i]) == 0) {
+			return static_cast<Layout>(i);
+		}
+	}
+
+	return Layout::UNDEFINED;
+}
 }  // namespace pixeldmxconfiguration
 
 class PixelDmxConfiguration: public PixelConfiguration {
@@ -87,6 +116,10 @@ public:
 		return m_portInfo;
 	}
 
+	const pixeldmxconfiguration::PortInfo& GetPortInfo() const {
+		return m_portInfo;
+	}
+
 	void SetDmxStartAddress(const uint16_t nDmxStartAddress) {
 		m_nDmxStartAddress = nDmxStartAddress;
 	}
@@ -99,6 +132,22 @@ public:
 		return m_nDmxFootprint;
 	}
 
+	void SetLayout(const pixeldmxconfiguration::Layout layout) {
+		m_layout = layout;
+	}
+
+	pixeldmxconfiguration::Layout GetLayout() const {
+		return m_layout;
+	}
+
+	void SetSegmentLength(const uint16_t nSegmentLength) {
+		m_nSegmentLength = nSegmentLength;
+	}
+
+	uint32_t GetSegmentLength() const {
+		return m_nSegmentLength;
+	}
+
 	void Validate(const uint32_t nPortsMax) {
 		DEBUG_ENTRY
 
@@ -129,6 +178,10 @@ public:
 		}
 
 		m_nGroups = PixelConfiguration::GetCount() / m_nGroupingCount;
+
+		if ((m_nSegmentLength == 0) || (m_nSegmentLength > PixelConfiguration::GetCount())) {
+			m_nSegmentLength = PixelConfiguration::GetCount();
+		}
 		m_nOutputPorts = std::min(nPortsMax, m_nOutputPorts);
 		m_nUniverses = (1U + (m_nGroups  / (1U + m_portInfo.nBeginIndexPort[1])));
 		m_nDmxFootprint = PixelConfiguration::GetLedsPerPixel() * m_nGroups;
@@ -151,6 +204,7 @@ public:
 		puts("Pixel DMX configuration");
 		printf(" Outputs        : %u\n", m_nOutputPorts);
 		printf(" Grouping count : %u [Groups : %u]\n", m_nGroupingCount, m_nGroups);
+		printf(" Layout         : %s [%u]\n", pixeldmxconfiguration::get_layout(m_layout), m_nSegmentLength);
 		printf(" Universes      : %u\n", m_nUniverses);
 		printf(" DmxFootprint   : %u\n", m_nDmxFootprint);
 
@@ -172,6 +226,8 @@ private:
 	uint32_t m_nUniverses { 0 };
 	uint32_t m_nDmxStartAddress { 1 };
 	uint32_t m_nDmxFootprint { 0 };
+	uint32_t m_nSegmentLength { 0 };
+	pixeldmxconfiguration::Layout m_layout { pixeldmxconfiguration::Layout::LINEAR };
 	pixeldmxconfiguration::PortInfo m_portInfo;
 
 	static inline PixelDmxConfiguration *s_pThis { nullptr };
@@ -0,0 +1,183 @@
+/**
+ * @file pixeldmxmapping.h
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PIXELDMXMAPPING_H_
+#define PIXELDMXMAPPING_H_
+
+#include <cstdint>
+#include <cassert>
+
+#include "pixeldmxconfiguration.h"
+#include "pixeltype.h"
+#include "lightset.h"
+
+/**
+ * Compiles the pixel DMX configuration (colour map, grouping count and strip layout)
+ * into lookup tables, so that SetData needs a single loop without any
+ * per pixel calculations:
+ * - the slot offset of each colour within a pixel;
+ * - for each group, the physical pixel indexes on the strip;
+ * - for each universe (port switch), the first slot and the group range.
+ */
+class PixelDmxMapping {
+public:
+	void Compile(const PixelDmxConfiguration& pixelDmxConfiguration) {
+		const auto nCount = pixelDmxConfiguration.GetCount();
+		assert(nCount <= MAX_PIXELS);
+
+		m_nGroupingCount = pixelDmxConfiguration.GetGroupingCount();
+		m_nChannelsPerPixel = pixelDmxConfiguration.GetLedsPerPixel();
+
+		SetColourOffsets(pixelDmxConfiguration.GetMap());
+
+		CompileUniverses(pixelDmxConfiguration);
+
+		const auto layout = pixelDmxConfiguration.GetLayout();
+		const auto nSegmentLength = pixelDmxConfiguration.GetSegmentLength();
+
+		for (uint32_t nIndex = 0; nIndex < nCount; nIndex++) {
+			uint32_t nPixel;
+
+			switch (layout) {
+			case pixeldmxconfiguration::Layout::REVERSED:
+				nPixel = nCount - 1 - nIndex;
+				break;
+			case pixeldmxconfiguration::Layout::SERPENTINE: {
+				const auto nRow = nIndex / nSegmentLength;
+				const auto nColumn = nIndex - (nRow * nSegmentLength);
+				nPixel = (nRow & 0x1) ? (nRow * nSegmentLength) + (nSegmentLength - 1 - nColumn) : nIndex;
+				if (nPixel >= nCount) {	// Incomplete last row
+					nPixel = nIndex;
+				}
+				break;
+			}
+			default:
+				nPixel = nIndex;
+				break;
+			}
+
+			m_Pixel[nIndex] = static_cast<uint16_t>(nPixel);
+		}
+	}
+
+	/**
+	 * The DMX start address only applies to the first universe,
+	 * and only when all groups fit in it.
+	 */
+	void CompileUniverses(const PixelDmxConfiguration& pixelDmxConfiguration) {
+		const auto& portInfo = pixelDmxConfiguration.GetPortInfo();
+		const auto nGroups = pixelDmxConfiguration.GetGroups();
+
+		for (uint32_t nSwitch = 0; nSwitch < 4; nSwitch++) {
+			auto& universe = m_Universe[nSwitch];
+#if !defined(LIGHTSET_PORTS)
+			universe.nGroupBegin = 0;
+#else
+			universe.nGroupBegin = portInfo.nBeginIndexPort[nSwitch];
+#endif
+			universe.nSlotBegin = 0;
+
+			if ((nSwitch == 0) && (nGroups < portInfo.nBeginIndexPort[1])) {
+				universe.nSlotBegin = static_cast<uint16_t>(pixelDmxConfiguration.GetDmxStartAddress() - 1U);
+			}
+
+			const auto nGroupEnd = universe.nGroupBegin + ((lightset::dmx::UNIVERSE_SIZE - universe.nSlotBegin) / m_nChannelsPerPixel);
+			universe.nGroupEnd = static_cast<uint16_t>(nGroupEnd < nGroups ? nGroupEnd : nGroups);
+		}
+	}
+
+	struct Universe {
+		uint16_t nSlotBegin;	///< First DMX slot of the first group
+		uint16_t nGroupBegin;	///< First group
+		uint16_t nGroupEnd;		///< One past the last group
+	};
+
+	const Universe& GetUniverse(const uint32_t nSwitch) const {
+		assert(nSwitch < 4);
+		return m_Universe[nSwitch];
+	}
+
+	/**
+	 * @return the physical pixel indexes for the group, GetGroupingCount() entries
+	 */
+	const uint16_t *GetPixels(const uint32_t nGroup) const {
+		return &m_Pixel[nGroup * m_nGroupingCount];
+	}
+
+	uint32_t GetGroupingCount() const {
+		return m_nGroupingCount;
+	}
+
+	uint32_t GetChannelsPerPixel() const {
+		return m_nChannelsPerPixel;
+	}
+
+	/**
+	 * @return the slot offsets for Red, Green, Blue and White
+	 */
+	const uint8_t *GetColourOffsets() const {
+		return m_nColourOffset;
+	}
+
+private:
+	void SetColourOffsets(const pixel::Map map) {
+		static constexpr uint8_t s_Offsets[][3] = {
+			{ 0, 1, 2 },	// RGB
+			{ 0, 2, 1 },	// RBG
+			{ 1, 0, 2 },	// GRB
+			{ 2, 0, 1 },	// GBR
+			{ 1, 2, 0 },	// BRG
+			{ 2, 1, 0 }		// BGR
+		};
+
+		if (m_nChannelsPerPixel == 4) {
+			// RGBW, the map is not used
+			for (uint32_t i = 0; i < 4; i++) {
+				m_nColourOffset[i] = static_cast<uint8_t>(i);
+			}
+			return;
+		}
+
+		const auto nMap = static_cast<uint32_t>(map);
+		assert(nMap < (sizeof(s_Offsets) / sizeof(s_Offsets[0])));
+
+		for (uint32_t i = 0; i < 3; i++) {
+			m_nColourOffset[i] = s_Offsets[nMap][i];
+		}
+
+		m_nColourOffset[3] = 0;
+	}
+
+private:
+	static constexpr uint32_t MAX_PIXELS = pixel::max::ledcount::RGB;
+
+	uint32_t m_nGroupingCount { 1 };
+	uint32_t m_nChannelsPerPixel { 3 };
+	uint8_t m_nColourOffset[4];
+	Universe m_Universe[4];
+	uint16_t m_Pixel[MAX_PIXELS];
+};
+
+#endif /* PIXELDMXMAPPING_H_ */
@@ -53,6 +53,8 @@ struct Params {
 	uint8_t nLowCode;										///< 1	  21
 	uint8_t nHighCode;										///< 1	  22
 	uint16_t nStartUniverse[pixeldmxparams::MAX_PORTS];		///< 16   38
+	uint8_t nLayout;										///< 1	  39
+	uint16_t nSegmentLength;								///< 2	  41
 }__attribute__((packed));
 
 static_assert(sizeof(struct Params) <= 64, "struct Params is too large");
@@ -71,7 +73,11 @@ struct Mask {
 	static constexpr auto LOW_CODE = (1U << 10);
 	static constexpr auto HIGH_CODE = (1U << 11);
 	static constexpr auto START_UNI_PORT_1 = (1U << 12);
+	static constexpr auto LAYOUT = (1U << 20);
+	static constexpr auto SEGMENT_LENGTH = (1U << 21);
 };
+
+static_assert((Mask::START_UNI_PORT_1 << (MAX_PORTS - 1)) < Mask::LAYOUT, "Mask bits overlap");
 }  // pixeldmxparams
 
 class PixelDmxParamsStore {
@@ -34,6 +34,7 @@
 #include "ws28xx.h"
 
 #include "pixeldmxconfiguration.h"
+#include "pixeldmxmapping.h"
 #include "pixelpatterns.h"
 
 class WS28xxDmx final: public LightSet {
@@ -61,6 +62,12 @@ public:
 	void Blackout(bool bBlackout) override;
 	void FullOn() override;
 
+	void Run() {
+		if (__builtin_expect((!m_bBlackout), 1)) {
+			m_pWS28xx->Run();
+		}
+	}
+
 	void Print() override {
 		PixelDmxConfiguration::Get().Print();
 	}
@@ -83,6 +90,28 @@ public:
 	}
 
 private:
+	void Update(const uint32_t nPortIndex, const bool doUpdate);
+	bool GetChangedSlots(const uint32_t nPortIndex, const uint32_t nSwitch, const uint8_t *pData, const uint32_t nLength, uint32_t& nStart, uint32_t& nEnd);
+
+	void Invalidate() {
+		for (auto& universe : m_Universe) {
+			universe.bValid = false;
+		}
+	}
+
+private:
+	static constexpr uint32_t UNIVERSES = 4;
+
+	struct Universe {
+		uint8_t data[lightset::dmx::UNIVERSE_SIZE];
+		uint32_t nLength;
+		bool bValid;
+	};
+
+	Universe m_Universe[UNIVERSES] {};	///< Last payload encoded, per universe of the port
+	PixelDmxMapping m_Mapping;
+	bool m_bFrameChanged { false };
+
 	WS28xx *m_pWS28xx { nullptr };
 
 	bool m_bIsStarted { false };
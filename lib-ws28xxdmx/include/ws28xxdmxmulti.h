@@ -74,16 +74,6 @@ public:
 				logic_analyzer::ch2_clear();
 			}
 
-#if defined (H3)
-			logic_analyzer::ch3_set();
-
-			while (m_pWS28xxMulti->IsUpdating()) {
-				// wait for completion
-			}
-
-			logic_analyzer::ch3_clear();
-#endif
-
 			m_pWS28xxMulti->Update();
 
 			logic_analyzer::ch1_clear();
@@ -102,13 +92,6 @@ public:
 
 	void Sync() override {
 		logic_analyzer::ch1_set();
-		logic_analyzer::ch3_set();
-
-		while (m_pWS28xxMulti->IsUpdating()) {
-			// wait for completion
-		}
-
-		logic_analyzer::ch3_clear();
 
 		m_pWS28xxMulti->Update();
 
@@ -125,6 +108,12 @@ public:
 	void Blackout(bool bBlackout) override;
 	void FullOn() override;
 
+	void Run() {
+		if (__builtin_expect((!m_bBlackout), 1)) {
+			m_pWS28xxMulti->Run();
+		}
+	}
+
 	void Print() override {
 		PixelDmxConfiguration::Get().Print();
 	}
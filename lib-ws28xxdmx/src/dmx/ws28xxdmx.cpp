@@ -33,6 +33,7 @@
 #pragma GCC optimize ("-fprefetch-loop-arrays")
 
 #include <cstdint>
+#include <cstring>
 #include <algorithm>
 #include <cassert>
 
@@ -40,8 +41,10 @@
 #include "ws28xx.h"
 
 #include "lightset.h"
+#include "lightsetdata.h"
 
 #include "pixeldmxconfiguration.h"
+#include "pixeldmxmapping.h"
 #include "pixeldmxstore.h"
 
 #if defined (PIXELDMXSTARTSTOP_GPIO)
@@ -59,6 +62,7 @@ WS28xxDmx::WS28xxDmx() {
 	s_pThis = this;
 
 	PixelDmxConfiguration::Get().Validate(1);
+	m_Mapping.Compile(PixelDmxConfiguration::Get());
 
 	m_pWS28xx = new WS28xx();
 	assert(m_pWS28xx != nullptr);
@@ -109,118 +113,136 @@ void WS28xxDmx::SetData([[maybe_unused]] uint32_t nPortIndex, const uint8_t *pDa
 	assert(pData != nullptr);
 	assert(nLength <= lightset::dmx::UNIVERSE_SIZE);
 
-	if (m_pWS28xx->IsUpdating()) {
-		return;
-	}
-
-	auto &pixelDmxConfiguration = PixelDmxConfiguration::Get();
-	auto &portInfo = pixelDmxConfiguration.GetPortInfo();
-	uint32_t d = 0;
-
 #if !defined(LIGHTSET_PORTS)
 	static constexpr uint32_t nSwitch = 0;
 #else
 	const auto nSwitch = nPortIndex & 0x03;
 #endif
-	const auto nGroups = pixelDmxConfiguration.GetGroups();
-#if !defined(LIGHTSET_PORTS)
-	static constexpr uint32_t beginIndex = 0;
-#else
-	const auto beginIndex = portInfo.nBeginIndexPort[nSwitch];
-#endif
-	const auto nChannelsPerPixel = pixelDmxConfiguration.GetLedsPerPixel();
-	const auto endIndex = std::min(nGroups, (beginIndex + (nLength / nChannelsPerPixel)));
-
-	if ((nSwitch == 0) && (nGroups < portInfo.nBeginIndexPort[1])) {
-		d = (pixelDmxConfiguration.GetDmxStartAddress() - 1U);
+	const auto& universe = m_Mapping.GetUniverse(nSwitch);
+	const auto nChannelsPerPixel = m_Mapping.GetChannelsPerPixel();
+	const auto nGroupingCount = m_Mapping.GetGroupingCount();
+	uint32_t d = universe.nSlotBegin;
+	uint32_t nStart, nEnd;
+
+	/*
+	 * Only the pixels with a changed slot are encoded again.
+	 */
+	if (!GetChangedSlots(nPortIndex, nSwitch, pData, nLength, nStart, nEnd) || (nEnd <= d)) {
+		Update(nPortIndex, doUpdate);
+		return;
 	}
 
-	const auto nGroupingCount = pixelDmxConfiguration.GetGroupingCount();
+	const auto nFirstPixel = (nStart > d) ? ((nStart - d) / nChannelsPerPixel) : 0;
+	const auto nLastPixel = (nEnd - d + nChannelsPerPixel - 1) / nChannelsPerPixel;
+	const auto beginIndex = universe.nGroupBegin + nFirstPixel;
+	const auto endIndex = std::min(static_cast<uint32_t>(universe.nGroupEnd), universe.nGroupBegin + nLastPixel);
+
+	d += nFirstPixel * nChannelsPerPixel;
+
+	m_bFrameChanged = true;
+
+	const auto *pOffset = m_Mapping.GetColourOffsets();
 
 	if (nChannelsPerPixel == 3) {
-		switch (pixelDmxConfiguration.GetMap()) {
-		case pixel::Map::RGB:
-			for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength); j++) {
-				auto const nPixelIndexStart = (j * nGroupingCount);
-				for (uint32_t k = 0; k < nGroupingCount; k++) {
-					m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d + 0], pData[d + 1], pData[d + 2]);
-				}
-				d = d + 3;
-			}
-			break;
-		case pixel::Map::RBG:
-			for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength); j++) {
-				auto const nPixelIndexStart = (j * nGroupingCount);
-				for (uint32_t k = 0; k < nGroupingCount; k++) {
-					m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d + 0], pData[d + 2], pData[d + 1]);
-				}
-				d = d + 3;
-			}
-			break;
-		case pixel::Map::GRB:
-			for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength); j++) {
-				auto const nPixelIndexStart = (j * nGroupingCount);
-				for (uint32_t k = 0; k < nGroupingCount; k++) {
-					m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d + 1], pData[d + 0], pData[d + 2]);
-				}
-				d = d + 3;
-			}
-			break;
-		case pixel::Map::GBR:
-			for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength); j++) {
-				auto const nPixelIndexStart = (j * nGroupingCount);
-				for (uint32_t k = 0; k < nGroupingCount; k++) {
-					m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d + 2], pData[d + 0], pData[d + 1]);
-				}
-				d = d + 3;
-			}
-			break;
-		case pixel::Map::BRG:
-			for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength); j++) {
-				auto const nPixelIndexStart = (j * nGroupingCount);
-				for (uint32_t k = 0; k < nGroupingCount; k++) {
-					m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d + 1], pData[d + 2], pData[d + 0]);
-				}
-				d = d + 3;
-			}
-			break;
-		case pixel::Map::BGR:
-			for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength); j++) {
-				auto const nPixelIndexStart = (j * nGroupingCount);
-				for (uint32_t k = 0; k < nGroupingCount; k++) {
-					m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d + 2], pData[d + 1], pData[d + 0]);
-				}
-				d = d + 3;
+		for (auto j = beginIndex; (j < endIndex) && (d < nLength); j++, d += 3) {
+			const auto *pPixels = m_Mapping.GetPixels(j);
+			const auto nRed = pData[d + pOffset[0]];
+			const auto nGreen = pData[d + pOffset[1]];
+			const auto nBlue = pData[d + pOffset[2]];
+
+			for (uint32_t k = 0; k < nGroupingCount; k++) {
+				m_pWS28xx->SetPixel(pPixels[k], nRed, nGreen, nBlue);
 			}
-			break;
-		default:
-			assert(0);
-			__builtin_unreachable();
-			break;
 		}
 	} else {
 		assert(nChannelsPerPixel == 4);
-		for (auto j = beginIndex; (j < endIndex) && (d < nLength); j++) {
-			auto const nPixelIndexStart = (j * nGroupingCount);
+		for (auto j = beginIndex; (j < endIndex) && (d < nLength); j++, d += 4) {
+			const auto *pPixels = m_Mapping.GetPixels(j);
+			const auto nRed = pData[d + pOffset[0]];
+			const auto nGreen = pData[d + pOffset[1]];
+			const auto nBlue = pData[d + pOffset[2]];
+			const auto nWhite = pData[d + pOffset[3]];
+
 			for (uint32_t k = 0; k < nGroupingCount; k++) {
-				m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d], pData[d + 1], pData[d + 2], pData[d + 3]);
+				m_pWS28xx->SetPixel(pPixels[k], nRed, nGreen, nBlue, nWhite);
 			}
-			d = d + 4;
 		}
 	}
 
+	Update(nPortIndex, doUpdate);
+}
+
+void WS28xxDmx::Update([[maybe_unused]] const uint32_t nPortIndex, const bool doUpdate) {
 #if !defined(LIGHTSET_PORTS)
 	if (doUpdate) {
 #else
-	if ((doUpdate) && (nPortIndex == portInfo.nProtocolPortIndexLast)) {
+	if ((doUpdate) && (nPortIndex == PixelDmxConfiguration::Get().GetPortInfo().nProtocolPortIndexLast)) {
 #endif
 		if (__builtin_expect((m_bBlackout), 0)) {
 			return;
 		}
-		m_pWS28xx->Update();
+		if (m_bFrameChanged) {
+			m_bFrameChanged = false;
+			m_pWS28xx->Update();
+		}
 	}
 }
 
+/**
+ * Compares with the previous payload of this universe and saves the new one.
+ * When the data comes from lightset::Data, its dirty range is used instead of comparing.
+ * @return false when nothing has changed, otherwise [nStart, nEnd) are the changed slots
+ */
+bool WS28xxDmx::GetChangedSlots([[maybe_unused]] const uint32_t nPortIndex, const uint32_t nSwitch, const uint8_t *pData, const uint32_t nLength, uint32_t& nStart, uint32_t& nEnd) {
+	assert(nSwitch < UNIVERSES);
+	auto& universe = m_Universe[nSwitch];
+
+	if (!universe.bValid || (universe.nLength != nLength)) {
+		memcpy(universe.data, pData, nLength);
+		universe.nLength = nLength;
+		universe.bValid = true;
+
+		nStart = 0;
+		nEnd = nLength;
+		return (nLength != 0);
+	}
+
+	if (lightset::Data::IsOutput(nPortIndex, pData)) {
+		if (!lightset::Data::GetDirtyRange(nPortIndex, nStart, nEnd)) {
+			return false;
+		}
+
+		nEnd = std::min(nEnd, nLength);
+
+		if (nStart >= nEnd) {
+			return false;
+		}
+
+		memcpy(&universe.data[nStart], &pData[nStart], nEnd - nStart);
+		return true;
+	}
+
+	nStart = 0;
+
+	while ((nStart < nLength) && (pData[nStart] == universe.data[nStart])) {
+		nStart++;
+	}
+
+	if (nStart == nLength) {
+		return false;
+	}
+
+	nEnd = nLength;
+
+	while (pData[nEnd - 1] == universe.data[nEnd - 1]) {
+		nEnd--;
+	}
+
+	memcpy(&universe.data[nStart], &pData[nStart], nEnd - nStart);
+
+	return true;
+}
+
 void WS28xxDmx::Blackout(bool bBlackout) {
 	m_bBlackout = bBlackout;
 
@@ -241,6 +263,7 @@ void WS28xxDmx::FullOn() {
 	}
 
 	m_pWS28xx->FullOn();
+	Invalidate();
 }
 
 // DMX
@@ -260,6 +283,8 @@ bool WS28xxDmx::SetDmxStartAddress(uint16_t nDmxStartAddress) {
 
 	if ((nDmxStartAddress != 0) && (nDmxStartAddress <= lightset::dmx::UNIVERSE_SIZE)) {
 		pixelDmxConfiguration.SetDmxStartAddress(nDmxStartAddress);
+		m_Mapping.CompileUniverses(pixelDmxConfiguration);
+		Invalidate();
 		PixelDmxStore::SaveDmxStartAddress(nDmxStartAddress);
 		return true;
 	}
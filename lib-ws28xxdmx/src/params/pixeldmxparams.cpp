@@ -72,6 +72,8 @@ PixelDmxParams::PixelDmxParams() {
 	m_Params.nHighCode = 0;
 	m_Params.nGammaValue = 0;
 	m_Params.nTestPattern = 0;
+	m_Params.nLayout = static_cast<uint8_t>(pixeldmxconfiguration::Layout::LINEAR);
+	m_Params.nSegmentLength = 0;
 
 	for (uint32_t nPortIndex = 0; nPortIndex < pixeldmxparams::MAX_PORTS; nPortIndex++) {
 		m_Params.nStartUniverse[nPortIndex] = static_cast<uint16_t>(1 + (nPortIndex * 4));
@@ -202,6 +204,32 @@ void PixelDmxParams::callbackFunction(const char *pLine) {
 		return;
 	}
 
+	nLength = 10;
+	if (Sscan::Char(pLine, DevicesParamsConst::LAYOUT, cBuffer, nLength) == Sscan::OK) {
+		cBuffer[nLength] = '\0';
+		const auto layout = pixeldmxconfiguration::get_layout(cBuffer);
+
+		if ((layout != pixeldmxconfiguration::Layout::UNDEFINED) && (layout != pixeldmxconfiguration::Layout::LINEAR)) {
+			m_Params.nLayout = static_cast<uint8_t>(layout);
+			m_Params.nSetList |= pixeldmxparams::Mask::LAYOUT;
+		} else {
+			m_Params.nLayout = static_cast<uint8_t>(pixeldmxconfiguration::Layout::LINEAR);
+			m_Params.nSetList &= ~pixeldmxparams::Mask::LAYOUT;
+		}
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, DevicesParamsConst::SEGMENT_LENGTH, nValue16) == Sscan::OK) {
+		if ((nValue16 != 0) && (nValue16 <= std::max(max::ledcount::RGB, max::ledcount::RGBW))) {
+			m_Params.nSegmentLength = nValue16;
+			m_Params.nSetList |= pixeldmxparams::Mask::SEGMENT_LENGTH;
+		} else {
+			m_Params.nSegmentLength = 0;
+			m_Params.nSetList &= ~pixeldmxparams::Mask::SEGMENT_LENGTH;
+		}
+		return;
+	}
+
 	uint32_t nValue32;
 
 	if (Sscan::Uint32(pLine, DevicesParamsConst::SPI_SPEED_HZ, nValue32) == Sscan::OK) {
@@ -348,6 +376,10 @@ void PixelDmxParams::Builder(const struct pixeldmxparams::Params *ptWS28xxParams
 	builder.AddComment("Grouping");
 	builder.Add(DevicesParamsConst::GROUPING_COUNT, m_Params.nGroupingCount, isMaskSet(pixeldmxparams::Mask::GROUPING_COUNT));
 
+	builder.AddComment("Layout: linear, reversed or serpentine");
+	builder.Add(DevicesParamsConst::LAYOUT, pixeldmxconfiguration::get_layout(static_cast<pixeldmxconfiguration::Layout>(m_Params.nLayout)), isMaskSet(pixeldmxparams::Mask::LAYOUT));
+	builder.Add(DevicesParamsConst::SEGMENT_LENGTH, m_Params.nSegmentLength, isMaskSet(pixeldmxparams::Mask::SEGMENT_LENGTH));
+
 	builder.AddComment("Clock based chips");
 	builder.Add(DevicesParamsConst::SPI_SPEED_HZ, m_Params.nSpiSpeedHz, isMaskSet(pixeldmxparams::Mask::SPI_SPEED));
 
@@ -426,6 +458,14 @@ void PixelDmxParams::Set() {
 		pixelDmxConfiguration.SetGroupingCount(m_Params.nGroupingCount);
 	}
 
+	if (isMaskSet(pixeldmxparams::Mask::LAYOUT)) {
+		pixelDmxConfiguration.SetLayout(static_cast<pixeldmxconfiguration::Layout>(m_Params.nLayout));
+	}
+
+	if (isMaskSet(pixeldmxparams::Mask::SEGMENT_LENGTH)) {
+		pixelDmxConfiguration.SetSegmentLength(m_Params.nSegmentLength);
+	}
+
 #if defined(OUTPUT_DMX_PIXEL_MULTI)
 	if (isMaskSet(pixeldmxparams::Mask::ACTIVE_OUT)) {
 		pixelDmxConfiguration.SetOutputPorts(m_Params.nActiveOutputs);
@@ -454,6 +494,8 @@ void PixelDmxParams::Dump() {
 
 	printf(" %s=%d\n", DevicesParamsConst::ACTIVE_OUT, m_Params.nActiveOutputs);
 	printf(" %s=%d\n", DevicesParamsConst::GROUPING_COUNT, m_Params.nGroupingCount);
+	printf(" %s=%s [%d]\n", DevicesParamsConst::LAYOUT, pixeldmxconfiguration::get_layout(static_cast<pixeldmxconfiguration::Layout>(m_Params.nLayout)), static_cast<int>(m_Params.nLayout));
+	printf(" %s=%d\n", DevicesParamsConst::SEGMENT_LENGTH, m_Params.nSegmentLength);
 	printf(" %s=%u\n", DevicesParamsConst::SPI_SPEED_HZ, static_cast<unsigned int>(m_Params.nSpiSpeedHz));
 	printf(" %s=%d\n", DevicesParamsConst::GLOBAL_BRIGHTNESS, m_Params.nGlobalBrightness);
 	printf(" %s=%d\n", LightSetParamsConst::DMX_START_ADDRESS, m_Params.nDmxStartAddress);
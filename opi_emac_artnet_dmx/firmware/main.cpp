@@ -78,6 +78,7 @@ static constexpr uint32_t DMXPORT_OFFSET = 0;
 void Hardware::RebootHandler() {
 	Dmx::Get()->Blackout();
 	ArtNetNode::Get()->Stop();
+	FlashCodeInstall::Get()->FirmwareDrain();
 }
 
 void main() {
@@ -90,6 +90,7 @@ static constexpr auto DMXPORT_OFFSET = 4U;
 void Hardware::RebootHandler() {
 	WS28xx::Get()->Blackout();
 	ArtNetNode::Get()->Stop();
+	FlashCodeInstall::Get()->FirmwareDrain();
 }
 
 void main() {
@@ -266,6 +267,7 @@ void main() {
 		hw.WatchdogFeed();
 		nw.Run();
 		node.Run();
+		pixelDmx.Run();
 		remoteConfig.Run();
 #if defined (NODE_RDMNET_LLRP_ONLY)
 		llrpOnlyDevice.Run();